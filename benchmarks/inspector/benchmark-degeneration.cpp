@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <chrono>
+#include <string>
+
+#include <absl/flags/flag.h>
+#include <absl/flags/parse.h>
+#include <absl/flags/usage.h>
+#include <absl/strings/numbers.h>
+#include <absl/strings/str_cat.h>
+#include <absl/strings/str_split.h>
+
+#include <geode/basic/assert.hpp>
+#include <geode/basic/logger.hpp>
+
+#include <geode/inspector/criterion/degeneration/solid_degeneration.hpp>
+#include <geode/inspector/criterion/degeneration/surface_degeneration.hpp>
+
+#include "benchmark_meshes.hpp"
+
+ABSL_FLAG( std::string,
+    sizes,
+    "1000000,10000000,100000000",
+    "Comma-separated numbers of elements of the benchmarked meshes" );
+
+template < typename Functor >
+void benchmark( std::string_view name, const Functor& functor )
+{
+    const auto start = std::chrono::steady_clock::now();
+    const auto nb_issues = functor();
+    const std::chrono::duration< double > duration =
+        std::chrono::steady_clock::now() - start;
+    geode::Logger::info(
+        name, ": ", duration.count(), "s (", nb_issues, " issues)" );
+}
+
+void benchmark_surface( geode::index_t nb_elements )
+{
+    const auto surface =
+        geode::benchmark::create_grid_surface< 2 >( nb_elements );
+    geode::Logger::info( "Surface with ", surface->nb_polygons(), " polygons" );
+    const geode::SurfaceMeshDegeneration2D inspector{ *surface };
+    benchmark( "  is_mesh_degenerated", [&inspector] {
+        return inspector.is_mesh_degenerated() ? 1 : 0;
+    } );
+    benchmark( "  degenerated_edges_and_polygons", [&inspector] {
+        const auto degenerations = inspector.degenerated_edges_and_polygons();
+        return degenerations.degenerated_edges.nb_issues()
+               + degenerations.degenerated_polygons.nb_issues();
+    } );
+}
+
+void benchmark_solid( geode::index_t nb_elements )
+{
+    const auto solid = geode::benchmark::create_grid_solid( nb_elements );
+    geode::Logger::info( "Solid with ", solid->nb_polyhedra(), " polyhedra" );
+    const geode::SolidMeshDegeneration3D inspector{ *solid };
+    benchmark( "  is_mesh_degenerated", [&inspector] {
+        return inspector.is_mesh_degenerated() ? 1 : 0;
+    } );
+    benchmark( "  degenerated_edges_and_polyhedra", [&inspector] {
+        const auto degenerations = inspector.degenerated_edges_and_polyhedra();
+        return degenerations.degenerated_edges.nb_issues()
+               + degenerations.degenerated_polyhedra.nb_issues();
+    } );
+}
+
+int main( int argc, char* argv[] )
+{
+    try
+    {
+        absl::SetProgramUsageMessage(
+            absl::StrCat( "Degeneration benchmark from Geode-solutions.\n",
+                "Sample usage:\n", argv[0], " --sizes 1000000,10000000" ) );
+        absl::ParseCommandLine( argc, argv );
+
+        geode::InspectorInspectorLibrary::initialize();
+        for( const auto size :
+            absl::StrSplit( absl::GetFlag( FLAGS_sizes ), ',' ) )
+        {
+            geode::index_t nb_elements;
+            OPENGEODE_EXCEPTION( absl::SimpleAtoi( size, &nb_elements ),
+                "[benchmark] Wrong size: ", size );
+            benchmark_surface( nb_elements );
+            benchmark_solid( nb_elements );
+        }
+
+        return 0;
+    }
+    catch( ... )
+    {
+        return geode::geode_lippincott();
+    }
+}
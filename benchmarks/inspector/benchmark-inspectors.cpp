@@ -0,0 +1,445 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <absl/flags/flag.h>
+#include <absl/flags/parse.h>
+#include <absl/flags/usage.h>
+#include <absl/strings/numbers.h>
+#include <absl/strings/str_cat.h>
+#include <absl/strings/str_split.h>
+
+#include <geode/basic/assert.hpp>
+#include <geode/basic/logger.hpp>
+
+#include <geode/inspector/brep_inspector.hpp>
+#include <geode/inspector/criterion/adjacency/solid_adjacency.hpp>
+#include <geode/inspector/criterion/adjacency/surface_adjacency.hpp>
+#include <geode/inspector/criterion/brep_meshes_inspector.hpp>
+#include <geode/inspector/criterion/colocation/edgedcurve_colocation.hpp>
+#include <geode/inspector/criterion/colocation/pointset_colocation.hpp>
+#include <geode/inspector/criterion/colocation/solid_colocation.hpp>
+#include <geode/inspector/criterion/colocation/surface_colocation.hpp>
+#include <geode/inspector/criterion/degeneration/edgedcurve_degeneration.hpp>
+#include <geode/inspector/criterion/degeneration/solid_degeneration.hpp>
+#include <geode/inspector/criterion/degeneration/surface_degeneration.hpp>
+#include <geode/inspector/criterion/intersections/model_intersections.hpp>
+#include <geode/inspector/criterion/intersections/surface_curve_intersections.hpp>
+#include <geode/inspector/criterion/intersections/surface_intersections.hpp>
+#include <geode/inspector/criterion/manifold/solid_edge_manifold.hpp>
+#include <geode/inspector/criterion/manifold/solid_facet_manifold.hpp>
+#include <geode/inspector/criterion/manifold/solid_vertex_manifold.hpp>
+#include <geode/inspector/criterion/manifold/surface_edge_manifold.hpp>
+#include <geode/inspector/criterion/manifold/surface_vertex_manifold.hpp>
+#include <geode/inspector/criterion/negative_elements/solid_negative_elements.hpp>
+#include <geode/inspector/criterion/negative_elements/surface_negative_elements.hpp>
+#include <geode/inspector/defects_injection.hpp>
+#include <geode/inspector/edgedcurve_inspector.hpp>
+#include <geode/inspector/pointset_inspector.hpp>
+#include <geode/inspector/solid_inspector.hpp>
+#include <geode/inspector/surface_inspector.hpp>
+#include <geode/inspector/topology/brep_topology.hpp>
+
+#include "benchmark_meshes.hpp"
+
+ABSL_FLAG( std::string,
+    sizes,
+    "1000,100000,1000000",
+    "Comma-separated numbers of elements of the benchmarked meshes" );
+ABSL_FLAG( double,
+    defect_ratio,
+    0.,
+    "Ratio of mesh vertices moved onto their previous vertex, creating "
+    "colocated points and degenerated elements (0 for valid meshes)" );
+ABSL_FLAG( geode::index_t,
+    nb_defects,
+    0,
+    "Number of isolated defects of each kind injected in the surfaces, "
+    "solids and BReps (see geode::InjectedDefects)" );
+ABSL_FLAG( geode::index_t,
+    nb_blocks,
+    8,
+    "Number of blocks of the benchmarked BReps" );
+ABSL_FLAG( std::string,
+    json,
+    "",
+    "File in which results are saved as JSON (no file if empty)" );
+
+struct BenchmarkResult
+{
+    std::string mesh;
+    std::string name;
+    geode::index_t nb_elements;
+    double seconds;
+    geode::index_t nb_issues;
+};
+
+class Benchmarks
+{
+public:
+    void set_mesh( std::string mesh, geode::index_t nb_elements )
+    {
+        geode::Logger::info( mesh, " with ", nb_elements, " elements" );
+        mesh_ = std::move( mesh );
+        nb_elements_ = nb_elements;
+    }
+
+    template < typename Functor >
+    void run( std::string name, const Functor& functor )
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const geode::index_t nb_issues = functor();
+        const std::chrono::duration< double > duration =
+            std::chrono::steady_clock::now() - start;
+        geode::Logger::info(
+            "  ", name, ": ", duration.count(), "s (", nb_issues, " issues)" );
+        results_.push_back( { mesh_, std::move( name ), nb_elements_,
+            duration.count(), nb_issues } );
+    }
+
+    void save_json( const std::string& filename,
+        double defect_ratio,
+        geode::index_t nb_defects ) const
+    {
+        std::ofstream file{ filename };
+        OPENGEODE_EXCEPTION(
+            file.good(), "[benchmark] Cannot open file ", filename );
+        file << "{\n  \"defect_ratio\": " << defect_ratio
+             << ",\n  \"nb_defects\": " << nb_defects
+             << ",\n  \"benchmarks\": [";
+        for( const auto result : geode::Indices{ results_ } )
+        {
+            const auto& benchmark = results_[result];
+            file << ( result == 0 ? "\n" : ",\n" ) << "    { \"mesh\": \""
+                 << benchmark.mesh << "\", \"name\": \"" << benchmark.name
+                 << "\", \"nb_elements\": " << benchmark.nb_elements
+                 << ", \"seconds\": " << benchmark.seconds
+                 << ", \"nb_issues\": " << benchmark.nb_issues << " }";
+        }
+        file << "\n  ]\n}\n";
+    }
+
+private:
+    std::string mesh_;
+    geode::index_t nb_elements_{ 0 };
+    std::vector< BenchmarkResult > results_;
+};
+
+template < typename Criterion, typename Mesh, typename Issues >
+void run_criterion( Benchmarks& benchmarks,
+    std::string_view name,
+    const Mesh& mesh,
+    const Issues& issues )
+{
+    const Criterion criterion{ mesh };
+    benchmarks.run( absl::StrCat( name, "::issues" ), [&] {
+        return issues( criterion );
+    } );
+}
+
+geode::InjectedDefects injected_defects( geode::index_t nb_defects )
+{
+    geode::InjectedDefects defects;
+    defects.nb_colocated_points = nb_defects;
+    defects.nb_degenerated_elements = nb_defects;
+    defects.nb_negative_elements = nb_defects;
+    defects.nb_non_manifold_elements = nb_defects;
+    defects.nb_intersections = nb_defects;
+    defects.nb_topology_violations = nb_defects;
+    return defects;
+}
+
+void benchmark_surface2d( Benchmarks& benchmarks,
+    geode::index_t nb_elements,
+    double defect_ratio,
+    geode::index_t nb_defects )
+{
+    const auto surface =
+        geode::benchmark::create_grid_surface< 2 >( nb_elements );
+    geode::benchmark::collapse_vertices( *surface,
+        *geode::TriangulatedSurfaceBuilder2D::create( *surface ),
+        defect_ratio );
+    auto defects = injected_defects( nb_defects );
+    defects.nb_topology_violations = 0;
+    geode::inject_surface_defects( *surface, defects );
+    benchmarks.set_mesh( "TriangulatedSurface2D", surface->nb_polygons() );
+    run_criterion< geode::SurfaceMeshNegativeElements2D >( benchmarks,
+        "SurfaceMeshNegativeElements::negative_polygons", *surface,
+        []( const geode::SurfaceMeshNegativeElements2D& criterion ) {
+            return criterion.negative_polygons().nb_issues();
+        } );
+    const geode::SurfaceMeshInspector2D inspector{ *surface };
+    benchmarks.run( "SurfaceMeshInspector::inspect_surface", [&] {
+        return inspector.inspect_surface().nb_issues();
+    } );
+}
+
+void benchmark_surface3d( Benchmarks& benchmarks,
+    geode::index_t nb_elements,
+    double defect_ratio,
+    geode::index_t nb_defects )
+{
+    const auto surface =
+        geode::benchmark::create_grid_surface< 3 >( nb_elements );
+    geode::benchmark::collapse_vertices( *surface,
+        *geode::TriangulatedSurfaceBuilder3D::create( *surface ),
+        defect_ratio );
+    auto defects = injected_defects( nb_defects );
+    defects.nb_negative_elements = 0;
+    defects.nb_topology_violations = 0;
+    geode::inject_surface_defects( *surface, defects );
+    benchmarks.set_mesh( "TriangulatedSurface3D", surface->nb_polygons() );
+    run_criterion< geode::SurfaceMeshAdjacency3D >( benchmarks,
+        "SurfaceMeshAdjacency::polygon_edges_with_wrong_adjacency", *surface,
+        []( const geode::SurfaceMeshAdjacency3D& criterion ) {
+            return criterion.polygon_edges_with_wrong_adjacency()
+                .nb_issues();
+        } );
+    run_criterion< geode::SurfaceMeshColocation3D >( benchmarks,
+        "SurfaceMeshColocation::colocated_points_groups", *surface,
+        []( const geode::SurfaceMeshColocation3D& criterion ) {
+            return criterion.colocated_points_groups().nb_issues();
+        } );
+    run_criterion< geode::SurfaceMeshDegeneration3D >( benchmarks,
+        "SurfaceMeshDegeneration::degenerated_edges_and_polygons", *surface,
+        []( const geode::SurfaceMeshDegeneration3D& criterion ) {
+            const auto degenerations =
+                criterion.degenerated_edges_and_polygons();
+            return degenerations.degenerated_edges.nb_issues()
+                   + degenerations.degenerated_polygons.nb_issues();
+        } );
+    run_criterion< geode::SurfaceMeshEdgeManifold3D >( benchmarks,
+        "SurfaceMeshEdgeManifold::non_manifold_edges", *surface,
+        []( const geode::SurfaceMeshEdgeManifold3D& criterion ) {
+            return criterion.non_manifold_edges().nb_issues();
+        } );
+    run_criterion< geode::SurfaceMeshVertexManifold3D >( benchmarks,
+        "SurfaceMeshVertexManifold::non_manifold_vertices", *surface,
+        []( const geode::SurfaceMeshVertexManifold3D& criterion ) {
+            return criterion.non_manifold_vertices().nb_issues();
+        } );
+    run_criterion< geode::SurfaceMeshIntersections3D >( benchmarks,
+        "SurfaceMeshIntersections::intersecting_elements", *surface,
+        []( const geode::SurfaceMeshIntersections3D& criterion ) {
+            return criterion.intersecting_elements().nb_issues();
+        } );
+    const geode::SurfaceMeshInspector3D inspector{ *surface };
+    benchmarks.run( "SurfaceMeshInspector::inspect_surface", [&] {
+        return inspector.inspect_surface().nb_issues();
+    } );
+}
+
+void benchmark_solid( Benchmarks& benchmarks,
+    geode::index_t nb_elements,
+    double defect_ratio,
+    geode::index_t nb_defects )
+{
+    const auto solid = geode::benchmark::create_grid_solid( nb_elements );
+    geode::benchmark::collapse_vertices( *solid,
+        *geode::TetrahedralSolidBuilder3D::create( *solid ), defect_ratio );
+    auto defects = injected_defects( nb_defects );
+    defects.nb_intersections = 0;
+    defects.nb_topology_violations = 0;
+    geode::inject_solid_defects( *solid, defects );
+    benchmarks.set_mesh( "TetrahedralSolid3D", solid->nb_polyhedra() );
+    run_criterion< geode::SolidMeshAdjacency3D >( benchmarks,
+        "SolidMeshAdjacency::polyhedron_facets_with_wrong_adjacency", *solid,
+        []( const geode::SolidMeshAdjacency3D& criterion ) {
+            return criterion.polyhedron_facets_with_wrong_adjacency()
+                .nb_issues();
+        } );
+    run_criterion< geode::SolidMeshColocation3D >( benchmarks,
+        "SolidMeshColocation::colocated_points_groups", *solid,
+        []( const geode::SolidMeshColocation3D& criterion ) {
+            return criterion.colocated_points_groups().nb_issues();
+        } );
+    run_criterion< geode::SolidMeshDegeneration3D >( benchmarks,
+        "SolidMeshDegeneration::degenerated_edges_and_polyhedra", *solid,
+        []( const geode::SolidMeshDegeneration3D& criterion ) {
+            const auto degenerations =
+                criterion.degenerated_edges_and_polyhedra();
+            return degenerations.degenerated_edges.nb_issues()
+                   + degenerations.degenerated_polyhedra.nb_issues();
+        } );
+    run_criterion< geode::SolidMeshEdgeManifold3D >( benchmarks,
+        "SolidMeshEdgeManifold::non_manifold_edges", *solid,
+        []( const geode::SolidMeshEdgeManifold3D& criterion ) {
+            return criterion.non_manifold_edges().nb_issues();
+        } );
+    run_criterion< geode::SolidMeshFacetManifold3D >( benchmarks,
+        "SolidMeshFacetManifold::non_manifold_facets", *solid,
+        []( const geode::SolidMeshFacetManifold3D& criterion ) {
+            return criterion.non_manifold_facets().nb_issues();
+        } );
+    run_criterion< geode::SolidMeshVertexManifold3D >( benchmarks,
+        "SolidMeshVertexManifold::non_manifold_vertices", *solid,
+        []( const geode::SolidMeshVertexManifold3D& criterion ) {
+            return criterion.non_manifold_vertices().nb_issues();
+        } );
+    run_criterion< geode::SolidMeshNegativeElements3D >( benchmarks,
+        "SolidMeshNegativeElements::negative_polyhedra", *solid,
+        []( const geode::SolidMeshNegativeElements3D& criterion ) {
+            return criterion.negative_polyhedra().nb_issues();
+        } );
+    const geode::SolidMeshInspector3D inspector{ *solid };
+    benchmarks.run( "SolidMeshInspector::inspect_solid", [&] {
+        return inspector.inspect_solid().nb_issues();
+    } );
+}
+
+void benchmark_point_set( Benchmarks& benchmarks,
+    geode::index_t nb_elements,
+    double defect_ratio )
+{
+    const auto point_set =
+        geode::benchmark::create_grid_point_set( nb_elements );
+    geode::benchmark::collapse_vertices( *point_set,
+        *geode::PointSetBuilder3D::create( *point_set ), defect_ratio );
+    benchmarks.set_mesh( "PointSet3D", point_set->nb_vertices() );
+    run_criterion< geode::PointSetColocation3D >( benchmarks,
+        "PointSetColocation::colocated_points_groups", *point_set,
+        []( const geode::PointSetColocation3D& criterion ) {
+            return criterion.colocated_points_groups().nb_issues();
+        } );
+    const geode::PointSetInspector3D inspector{ *point_set };
+    benchmarks.run( "PointSetInspector::inspect_point_set", [&] {
+        return inspector.inspect_point_set().nb_issues();
+    } );
+}
+
+void benchmark_curve( Benchmarks& benchmarks,
+    geode::index_t nb_elements,
+    double defect_ratio )
+{
+    const auto curve = geode::benchmark::create_grid_curve( nb_elements );
+    geode::benchmark::collapse_vertices( *curve,
+        *geode::EdgedCurveBuilder3D::create( *curve ), defect_ratio );
+    benchmarks.set_mesh( "EdgedCurve3D", curve->nb_edges() );
+    run_criterion< geode::EdgedCurveColocation3D >( benchmarks,
+        "EdgedCurveColocation::colocated_points_groups", *curve,
+        []( const geode::EdgedCurveColocation3D& criterion ) {
+            return criterion.colocated_points_groups().nb_issues();
+        } );
+    run_criterion< geode::EdgedCurveDegeneration3D >( benchmarks,
+        "EdgedCurveDegeneration::degenerated_edges", *curve,
+        []( const geode::EdgedCurveDegeneration3D& criterion ) {
+            return criterion.degenerated_edges().nb_issues();
+        } );
+    const auto surface =
+        geode::benchmark::create_grid_surface< 3 >( nb_elements );
+    const geode::SurfaceCurveIntersections3D intersections{ *surface,
+        *curve };
+    benchmarks.run( "SurfaceCurveIntersections::intersecting_elements", [&] {
+        return intersections.intersecting_elements().nb_issues();
+    } );
+    const geode::EdgedCurveInspector3D inspector{ *curve };
+    benchmarks.run( "EdgedCurveInspector::inspect_edged_curve", [&] {
+        return inspector.inspect_edged_curve().nb_issues();
+    } );
+}
+
+void benchmark_brep( Benchmarks& benchmarks,
+    geode::index_t nb_elements,
+    geode::index_t nb_blocks,
+    double defect_ratio,
+    geode::index_t nb_defects )
+{
+    auto brep = geode::benchmark::create_grid_brep(
+        nb_elements, nb_blocks, defect_ratio );
+    geode::inject_brep_defects( brep, injected_defects( nb_defects ) );
+    benchmarks.set_mesh( absl::StrCat( "BRep", nb_blocks, "Blocks" ),
+        nb_elements );
+    run_criterion< geode::BRepTopologyInspector >( benchmarks,
+        "BRepTopologyInspector::inspect_brep_topology", brep,
+        []( const geode::BRepTopologyInspector& criterion ) {
+            return criterion.inspect_brep_topology().nb_issues();
+        } );
+    run_criterion< geode::BRepMeshesInspector >( benchmarks,
+        "BRepMeshesInspector::inspect_brep_meshes", brep,
+        []( const geode::BRepMeshesInspector& criterion ) {
+            return criterion.inspect_brep_meshes().nb_issues();
+        } );
+    run_criterion< geode::BRepMeshesIntersections >( benchmarks,
+        "BRepMeshesIntersections::inspect_intersections", brep,
+        []( const geode::BRepMeshesIntersections& criterion ) {
+            return criterion.inspect_intersections().nb_issues();
+        } );
+    const geode::BRepInspector inspector{ brep };
+    benchmarks.run( "BRepInspector::inspect_brep", [&] {
+        return inspector.inspect_brep().nb_issues();
+    } );
+}
+
+int main( int argc, char* argv[] )
+{
+    try
+    {
+        absl::SetProgramUsageMessage(
+            absl::StrCat( "Inspectors benchmark from Geode-solutions.\n",
+                "Sample usage:\n", argv[0],
+                " --sizes 1000,1000000 --defect_ratio 0.001 --json "
+                "results.json" ) );
+        absl::ParseCommandLine( argc, argv );
+
+        geode::InspectorInspectorLibrary::initialize();
+        const auto defect_ratio = absl::GetFlag( FLAGS_defect_ratio );
+        const auto nb_defects = absl::GetFlag( FLAGS_nb_defects );
+        const auto nb_blocks = absl::GetFlag( FLAGS_nb_blocks );
+        OPENGEODE_EXCEPTION(
+            nb_blocks > 0, "[benchmark] At least one block is required" );
+        Benchmarks benchmarks;
+        for( const auto size :
+            absl::StrSplit( absl::GetFlag( FLAGS_sizes ), ',' ) )
+        {
+            geode::index_t nb_elements;
+            OPENGEODE_EXCEPTION( absl::SimpleAtoi( size, &nb_elements ),
+                "[benchmark] Wrong size: ", size );
+            benchmark_point_set( benchmarks, nb_elements, defect_ratio );
+            benchmark_curve( benchmarks, nb_elements, defect_ratio );
+            benchmark_surface2d(
+                benchmarks, nb_elements, defect_ratio, nb_defects );
+            benchmark_surface3d(
+                benchmarks, nb_elements, defect_ratio, nb_defects );
+            benchmark_solid(
+                benchmarks, nb_elements, defect_ratio, nb_defects );
+            benchmark_brep(
+                benchmarks, nb_elements, nb_blocks, defect_ratio, nb_defects );
+        }
+        const auto json = absl::GetFlag( FLAGS_json );
+        if( !json.empty() )
+        {
+            benchmarks.save_json( json, defect_ratio, nb_defects );
+        }
+
+        return 0;
+    }
+    catch( ... )
+    {
+        return geode::geode_lippincott();
+    }
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <absl/flags/flag.h>
+#include <absl/flags/parse.h>
+#include <absl/flags/usage.h>
+#include <absl/strings/numbers.h>
+#include <absl/strings/str_cat.h>
+#include <absl/strings/str_split.h>
+
+#include <geode/basic/assert.hpp>
+#include <geode/basic/logger.hpp>
+
+#include <geode/inspector/inspection_threads.hpp>
+#include <geode/inspector/solid_inspector.hpp>
+
+#include "benchmark_meshes.hpp"
+
+ABSL_FLAG( geode::index_t,
+    size,
+    1000000,
+    "Number of elements of each benchmarked solid" );
+ABSL_FLAG( std::string,
+    threads,
+    "0,1,2,4,8",
+    "Comma-separated sizes of the inspection thread pool (0 for the default "
+    "thread pool)" );
+ABSL_FLAG( std::string,
+    concurrency,
+    "1,2,4,8",
+    "Comma-separated numbers of inspections running at the same time" );
+
+std::vector< geode::index_t > parse_list( std::string_view list )
+{
+    std::vector< geode::index_t > values;
+    for( const auto value : absl::StrSplit( list, ',' ) )
+    {
+        geode::index_t number;
+        OPENGEODE_EXCEPTION( absl::SimpleAtoi( value, &number ),
+            "[benchmark] Wrong number: ", value );
+        values.push_back( number );
+    }
+    return values;
+}
+
+void benchmark_throughput( const geode::TetrahedralSolid3D& solid,
+    geode::index_t nb_threads,
+    geode::index_t nb_concurrent_inspections )
+{
+    geode::set_inspection_nb_threads( nb_threads );
+    const geode::SolidMeshInspector< 3 > inspector{ solid };
+    std::vector< geode::index_t > nb_issues( nb_concurrent_inspections, 0 );
+    std::vector< std::thread > clients;
+    clients.reserve( nb_concurrent_inspections );
+    const auto start = std::chrono::steady_clock::now();
+    for( const auto client : geode::Range{ nb_concurrent_inspections } )
+    {
+        clients.emplace_back( [&inspector, &nb_issues, client] {
+            nb_issues[client] = inspector.inspect_solid().nb_issues();
+        } );
+    }
+    for( auto& client : clients )
+    {
+        client.join();
+    }
+    const std::chrono::duration< double > duration =
+        std::chrono::steady_clock::now() - start;
+    geode::Logger::info( "  ", nb_threads, " threads, ",
+        nb_concurrent_inspections, " concurrent inspections: ",
+        duration.count(), "s (",
+        nb_concurrent_inspections / duration.count(), " inspections/s)" );
+}
+
+int main( int argc, char* argv[] )
+{
+    try
+    {
+        absl::SetProgramUsageMessage( absl::StrCat(
+            "Inspection throughput benchmark from Geode-solutions.\n",
+            "Sample usage:\n", argv[0],
+            " --size 1000000 --threads 1,4 --concurrency 1,2,4" ) );
+        absl::ParseCommandLine( argc, argv );
+
+        geode::InspectorInspectorLibrary::initialize();
+        const auto solid =
+            geode::benchmark::create_grid_solid( absl::GetFlag( FLAGS_size ) );
+        geode::Logger::info(
+            "Solid with ", solid->nb_polyhedra(), " polyhedra" );
+        for( const auto nb_threads :
+            parse_list( absl::GetFlag( FLAGS_threads ) ) )
+        {
+            for( const auto nb_concurrent_inspections :
+                parse_list( absl::GetFlag( FLAGS_concurrency ) ) )
+            {
+                benchmark_throughput(
+                    *solid, nb_threads, nb_concurrent_inspections );
+            }
+        }
+        geode::set_inspection_nb_threads( 0 );
+
+        return 0;
+    }
+    catch( ... )
+    {
+        return geode::geode_lippincott();
+    }
+}
@@ -0,0 +1,368 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <geode/basic/uuid.hpp>
+
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/builder/edged_curve_builder.hpp>
+#include <geode/mesh/builder/point_set_builder.hpp>
+#include <geode/mesh/builder/tetrahedral_solid_builder.hpp>
+#include <geode/mesh/builder/triangulated_surface_builder.hpp>
+#include <geode/mesh/core/edged_curve.hpp>
+#include <geode/mesh/core/point_set.hpp>
+#include <geode/mesh/core/tetrahedral_solid.hpp>
+#include <geode/mesh/core/triangulated_surface.hpp>
+
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+#include <geode/model/mixin/core/vertex_identifier.hpp>
+#include <geode/model/representation/builder/brep_builder.hpp>
+#include <geode/model/representation/core/brep.hpp>
+
+namespace geode
+{
+    namespace benchmark
+    {
+        /*!
+         * Creates the two triangles of each cell of a grid of
+         * ( nb_cells + 1 )^2 vertices, vertex ( u, v ) being u + v * ( nb_cells
+         * + 1 ). Each cell is split along its ( 0, 0 ) - ( 1, 1 ) diagonal.
+         */
+        template < index_t dimension >
+        void create_grid_triangles(
+            TriangulatedSurfaceBuilder< dimension >& builder, index_t nb_cells )
+        {
+            const auto nb_points = nb_cells + 1;
+            for( const auto v : Range{ nb_cells } )
+            {
+                for( const auto u : Range{ nb_cells } )
+                {
+                    const auto v00 = u + v * nb_points;
+                    const auto v10 = v00 + 1;
+                    const auto v01 = v00 + nb_points;
+                    const auto v11 = v01 + 1;
+                    builder.create_triangle( { v00, v10, v11 } );
+                    builder.create_triangle( { v00, v11, v01 } );
+                }
+            }
+        }
+
+        /*!
+         * Creates a regular grid of positively oriented triangles holding at
+         * least nb_triangles triangles, in the z = 0 plane in 3D.
+         */
+        template < index_t dimension >
+        std::unique_ptr< TriangulatedSurface< dimension > > create_grid_surface(
+            index_t nb_triangles )
+        {
+            const auto nb_cells = static_cast< index_t >(
+                std::ceil( std::sqrt( nb_triangles / 2. ) ) );
+            const auto nb_points = nb_cells + 1;
+            auto surface = TriangulatedSurface< dimension >::create();
+            auto builder =
+                TriangulatedSurfaceBuilder< dimension >::create( *surface );
+            builder->create_vertices( nb_points * nb_points );
+            for( const auto j : Range{ nb_points } )
+            {
+                for( const auto i : Range{ nb_points } )
+                {
+                    Point< dimension > point;
+                    point.set_value( 0, static_cast< double >( i ) );
+                    point.set_value( 1, static_cast< double >( j ) );
+                    builder->set_point( i + j * nb_points, point );
+                }
+            }
+            create_grid_triangles( *builder, nb_cells );
+            return surface;
+        }
+
+        /*!
+         * Creates a regular grid of nb_cells^3 cubes starting at origin, each
+         * cube being split into six positively oriented tetrahedra. Vertex
+         * ( i, j, k ) is i + j * ( nb_cells + 1 ) + k * ( nb_cells + 1 )^2.
+         */
+        inline std::unique_ptr< TetrahedralSolid3D > create_cells_grid_solid(
+            index_t nb_cells, const Point3D& origin )
+        {
+            const auto nb_points = nb_cells + 1;
+            const auto vertex = [nb_points]( index_t i, index_t j, index_t k ) {
+                return i + j * nb_points + k * nb_points * nb_points;
+            };
+            auto solid = TetrahedralSolid3D::create();
+            auto builder = TetrahedralSolidBuilder3D::create( *solid );
+            builder->create_vertices( nb_points * nb_points * nb_points );
+            for( const auto k : Range{ nb_points } )
+            {
+                for( const auto j : Range{ nb_points } )
+                {
+                    for( const auto i : Range{ nb_points } )
+                    {
+                        builder->set_point( vertex( i, j, k ),
+                            Point3D{ { origin.value( 0 ) + i,
+                                origin.value( 1 ) + j,
+                                origin.value( 2 ) + k } } );
+                    }
+                }
+            }
+            // Cube corner c is at offset ( c & 1, ( c >> 1 ) & 1, c >> 2 ).
+            // Each tetrahedron follows a path from corner 0 to corner 7,
+            // ordered to be positive.
+            static constexpr std::array< std::array< local_index_t, 4 >, 6 >
+                TETRAHEDRA{ { { 0, 1, 3, 7 }, { 0, 2, 6, 7 }, { 0, 4, 5, 7 },
+                    { 0, 1, 7, 5 }, { 0, 4, 7, 6 }, { 0, 2, 7, 3 } } };
+            for( const auto k : Range{ nb_cells } )
+            {
+                for( const auto j : Range{ nb_cells } )
+                {
+                    for( const auto i : Range{ nb_cells } )
+                    {
+                        for( const auto& corners : TETRAHEDRA )
+                        {
+                            std::array< index_t, 4 > vertices;
+                            for( const auto v : LRange{ 4 } )
+                            {
+                                vertices[v] = vertex( i + ( corners[v] & 1 ),
+                                    j + ( ( corners[v] >> 1 ) & 1 ),
+                                    k + ( corners[v] >> 2 ) );
+                            }
+                            builder->create_tetrahedron( vertices );
+                        }
+                    }
+                }
+            }
+            return solid;
+        }
+
+        /*!
+         * Creates a regular grid of cubes, each split into six positively
+         * oriented tetrahedra, holding at least nb_tetrahedra tetrahedra.
+         */
+        inline std::unique_ptr< TetrahedralSolid3D > create_grid_solid(
+            index_t nb_tetrahedra )
+        {
+            const auto nb_cells = static_cast< index_t >(
+                std::ceil( std::cbrt( nb_tetrahedra / 6. ) ) );
+            return create_cells_grid_solid( nb_cells, Point3D{} );
+        }
+
+        /*!
+         * Creates a regular grid of at least nb_points points.
+         */
+        inline std::unique_ptr< PointSet3D > create_grid_point_set(
+            index_t nb_points )
+        {
+            const auto nb_axis_points =
+                static_cast< index_t >( std::ceil( std::cbrt( nb_points ) ) );
+            auto point_set = PointSet3D::create();
+            auto builder = PointSetBuilder3D::create( *point_set );
+            builder->create_vertices(
+                nb_axis_points * nb_axis_points * nb_axis_points );
+            index_t vertex{ 0 };
+            for( const auto k : Range{ nb_axis_points } )
+            {
+                for( const auto j : Range{ nb_axis_points } )
+                {
+                    for( const auto i : Range{ nb_axis_points } )
+                    {
+                        builder->set_point( vertex++,
+                            Point3D{ { static_cast< double >( i ),
+                                static_cast< double >( j ),
+                                static_cast< double >( k ) } } );
+                    }
+                }
+            }
+            return point_set;
+        }
+
+        /*!
+         * Creates a polyline of at least nb_edges edges, zigzagging row by
+         * row over a square grid lying in the z = 0.5 plane, i.e. just above
+         * the surfaces of create_grid_surface.
+         */
+        inline std::unique_ptr< EdgedCurve3D > create_grid_curve(
+            index_t nb_edges )
+        {
+            const auto nb_row_points = static_cast< index_t >(
+                std::ceil( std::sqrt( nb_edges + 1. ) ) );
+            auto curve = EdgedCurve3D::create();
+            auto builder = EdgedCurveBuilder3D::create( *curve );
+            builder->create_vertices( nb_row_points * nb_row_points );
+            index_t vertex{ 0 };
+            for( const auto j : Range{ nb_row_points } )
+            {
+                for( const auto i : Range{ nb_row_points } )
+                {
+                    const auto x = j % 2 == 0 ? i : nb_row_points - 1 - i;
+                    builder->set_point(
+                        vertex, Point3D{ { static_cast< double >( x ),
+                                    static_cast< double >( j ), 0.5 } } );
+                    if( vertex != 0 )
+                    {
+                        builder->create_edge( vertex - 1, vertex );
+                    }
+                    vertex++;
+                }
+            }
+            return curve;
+        }
+
+        /*!
+         * Moves one vertex out of 1 / defect_ratio onto the point of the
+         * previous vertex, creating colocated points and degenerated
+         * elements around the moved vertices. Nothing is moved if
+         * defect_ratio is not positive.
+         */
+        template < typename Mesh, typename Builder >
+        void collapse_vertices(
+            const Mesh& mesh, Builder& builder, double defect_ratio )
+        {
+            if( defect_ratio <= 0. )
+            {
+                return;
+            }
+            const auto stride = std::max( index_t{ 2 },
+                static_cast< index_t >( std::round( 1. / defect_ratio ) ) );
+            for( index_t vertex = 1; vertex < mesh.nb_vertices();
+                 vertex += stride )
+            {
+                builder.set_point( vertex, mesh.point( vertex - 1 ) );
+            }
+        }
+
+        /*!
+         * Creates a BRep of nb_blocks blocks aligned along the x axis,
+         * holding at least nb_tetrahedra tetrahedra. Each block is a grid of
+         * cubes bounded by six grid surfaces, two consecutive blocks sharing
+         * the surface between them. Unique vertices are identified between
+         * all the meshes. The block meshes have collapsed vertices following
+         * defect_ratio (see collapse_vertices). Lines and corners are not
+         * created, so the topology inspection reports the surface borders.
+         */
+        inline BRep create_grid_brep(
+            index_t nb_tetrahedra, index_t nb_blocks, double defect_ratio )
+        {
+            const auto nb_cells = static_cast< index_t >( std::ceil(
+                std::cbrt( nb_tetrahedra / ( 6. * nb_blocks ) ) ) );
+            const auto nb_points = nb_cells + 1;
+            const auto nb_x_points = nb_blocks * nb_cells + 1;
+            using GridVertex = std::array< index_t, 3 >;
+            const auto unique_vertex =
+                [nb_points, nb_x_points]( const GridVertex& ijk ) {
+                    return ijk[0] + ijk[1] * nb_x_points
+                           + ijk[2] * nb_x_points * nb_points;
+                };
+            BRep brep;
+            BRepBuilder builder{ brep };
+            builder.create_unique_vertices(
+                nb_x_points * nb_points * nb_points );
+            const auto add_surface =
+                [&brep, &builder, &unique_vertex, nb_cells, nb_points](
+                    const GridVertex& origin, local_index_t u_axis,
+                    local_index_t v_axis ) {
+                    auto mesh = TriangulatedSurface3D::create();
+                    auto mesh_builder =
+                        TriangulatedSurfaceBuilder3D::create( *mesh );
+                    mesh_builder->create_vertices( nb_points * nb_points );
+                    std::vector< index_t > unique_vertices;
+                    unique_vertices.reserve( nb_points * nb_points );
+                    for( const auto v : Range{ nb_points } )
+                    {
+                        for( const auto u : Range{ nb_points } )
+                        {
+                            auto ijk = origin;
+                            ijk[u_axis] += u;
+                            ijk[v_axis] += v;
+                            mesh_builder->set_point( u + v * nb_points,
+                                Point3D{ { static_cast< double >( ijk[0] ),
+                                    static_cast< double >( ijk[1] ),
+                                    static_cast< double >( ijk[2] ) } } );
+                            unique_vertices.push_back( unique_vertex( ijk ) );
+                        }
+                    }
+                    create_grid_triangles( *mesh_builder, nb_cells );
+                    const auto surface_id = builder.add_surface();
+                    const auto& surface = brep.surface( surface_id );
+                    builder.update_surface_mesh( surface, std::move( mesh ) );
+                    for( const auto vertex : Range{ nb_points * nb_points } )
+                    {
+                        builder.set_unique_vertex(
+                            { surface.component_id(), vertex },
+                            unique_vertices[vertex] );
+                    }
+                    return surface_id;
+                };
+            std::vector< uuid > x_surfaces;
+            x_surfaces.reserve( nb_blocks + 1 );
+            for( const auto block : Range{ nb_blocks + 1 } )
+            {
+                x_surfaces.push_back(
+                    add_surface( { block * nb_cells, 0, 0 }, 1, 2 ) );
+            }
+            for( const auto block : Range{ nb_blocks } )
+            {
+                const auto x_origin = block * nb_cells;
+                auto mesh = create_cells_grid_solid( nb_cells,
+                    Point3D{ { static_cast< double >( x_origin ), 0., 0. } } );
+                auto mesh_builder = TetrahedralSolidBuilder3D::create( *mesh );
+                collapse_vertices( *mesh, *mesh_builder, defect_ratio );
+                const auto block_id = builder.add_block();
+                const auto& block_component = brep.block( block_id );
+                builder.update_block_mesh( block_component, std::move( mesh ) );
+                index_t vertex{ 0 };
+                for( const auto k : Range{ nb_points } )
+                {
+                    for( const auto j : Range{ nb_points } )
+                    {
+                        for( const auto i : Range{ nb_points } )
+                        {
+                            builder.set_unique_vertex(
+                                { block_component.component_id(), vertex++ },
+                                unique_vertex( { x_origin + i, j, k } ) );
+                        }
+                    }
+                }
+                const std::array< uuid, 6 > boundaries{ x_surfaces[block],
+                    x_surfaces[block + 1],
+                    add_surface( { x_origin, 0, 0 }, 0, 2 ),
+                    add_surface( { x_origin, nb_cells, 0 }, 0, 2 ),
+                    add_surface( { x_origin, 0, 0 }, 0, 1 ),
+                    add_surface( { x_origin, 0, nb_cells }, 0, 1 ) };
+                for( const auto& boundary : boundaries )
+                {
+                    builder.add_surface_block_boundary_relationship(
+                        brep.surface( boundary ), block_component );
+                }
+            }
+            return brep;
+        }
+    } // namespace benchmark
+} // namespace geode
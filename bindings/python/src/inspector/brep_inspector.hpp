@@ -34,13 +34,28 @@ namespace geode
             .def( pybind11::init<>() )
             .def_readwrite( "meshes", &BRepInspectionResult::meshes )
             .def_readwrite( "topology", &BRepInspectionResult::topology )
+            .def_readwrite( "status", &BRepInspectionResult::status )
+            .def_readwrite( "profile", &BRepInspectionResult::profile )
             .def( "string", &BRepInspectionResult::string )
             .def( "inspection_type", &BRepInspectionResult::inspection_type );
 
         pybind11::class_< BRepInspector, BRepMeshesInspector,
             BRepTopologyInspector >( module, "BRepInspector" )
             .def( pybind11::init< const BRep& >() )
-            .def( "inspect_brep", &BRepInspector::inspect_brep );
+            .def( "is_valid",
+                pybind11::overload_cast<>(
+                    &BRepInspector::is_valid, pybind11::const_ ) )
+            .def( "is_valid",
+                pybind11::overload_cast< const InspectionOptions& >(
+                    &BRepInspector::is_valid, pybind11::const_ ),
+                pybind11::call_guard< pybind11::gil_scoped_release >() )
+            .def( "inspect_brep",
+                pybind11::overload_cast<>(
+                    &BRepInspector::inspect_brep, pybind11::const_ ) )
+            .def( "inspect_brep",
+                pybind11::overload_cast< const InspectionOptions& >(
+                    &BRepInspector::inspect_brep, pybind11::const_ ),
+                pybind11::call_guard< pybind11::gil_scoped_release >() );
 
         module.def( "inspect_brep", []( const BRep& brep ) {
             BRepInspector inspector{ brep };
@@ -46,7 +46,8 @@ namespace geode
             module, "BRepComponentMeshesAdjacency" )
             .def( pybind11::init< const BRep& >() )
             .def( "inspect_brep_meshes_adjacencies",
-                &BRepComponentMeshesAdjacency::
-                    inspect_brep_meshes_adjacencies );
+                pybind11::overload_cast<>( &BRepComponentMeshesAdjacency::
+                                               inspect_brep_meshes_adjacencies,
+                    pybind11::const_ ) );
     }
 } // namespace geode
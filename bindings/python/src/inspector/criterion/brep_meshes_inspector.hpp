@@ -44,6 +44,8 @@ namespace geode
                 &BRepMeshesInspectionResult::meshes_intersections )
             .def_readwrite( "meshes_non_manifolds",
                 &BRepMeshesInspectionResult::meshes_non_manifolds )
+            .def_readwrite( "status", &BRepMeshesInspectionResult::status )
+            .def_readwrite( "profile", &BRepMeshesInspectionResult::profile )
             .def( "string", &BRepMeshesInspectionResult::string )
             .def( "inspection_type",
                 &BRepMeshesInspectionResult::inspection_type );
@@ -54,6 +56,13 @@ namespace geode
             BRepMeshesIntersections >( module, "BRepMeshesInspector" )
             .def( pybind11::init< const BRep& >() )
             .def( "inspect_brep_meshes",
-                &BRepMeshesInspector::inspect_brep_meshes );
+                pybind11::overload_cast<>(
+                    &BRepMeshesInspector::inspect_brep_meshes,
+                    pybind11::const_ ) )
+            .def( "inspect_brep_meshes",
+                pybind11::overload_cast< const InspectionOptions& >(
+                    &BRepMeshesInspector::inspect_brep_meshes,
+                    pybind11::const_ ),
+                pybind11::call_guard< pybind11::gil_scoped_release >() );
     }
 } // namespace geode
@@ -33,8 +33,9 @@
         module, name##type.c_str() )                                           \
         .def( pybind11::init< const type& >() )                                \
         .def( "inspect_meshes_point_colocations",                              \
-            &suffix##ComponentMeshesColocation::                               \
-                inspect_meshes_point_colocations )
+            pybind11::overload_cast<>( &suffix##ComponentMeshesColocation::    \
+                                           inspect_meshes_point_colocations,   \
+                pybind11::const_ ) )
 
 namespace geode
 {
@@ -46,7 +46,8 @@ namespace geode
             module, "BRepComponentMeshesDegeneration" )
             .def( pybind11::init< const BRep& >() )
             .def( "inspect_elements_degeneration",
-                &BRepComponentMeshesDegeneration::
-                    inspect_elements_degeneration );
+                pybind11::overload_cast<>( &BRepComponentMeshesDegeneration::
+                                               inspect_elements_degeneration,
+                    pybind11::const_ ) );
     }
 } // namespace geode
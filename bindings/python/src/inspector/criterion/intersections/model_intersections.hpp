@@ -35,7 +35,9 @@
         .def( "model_has_intersecting_surfaces",                               \
             &suffix##MeshesIntersections::model_has_intersecting_surfaces )    \
         .def( "inspect_intersections",                                         \
-            &suffix##MeshesIntersections::inspect_intersections )
+            pybind11::overload_cast<>(                                         \
+                &suffix##MeshesIntersections::inspect_intersections,           \
+                pybind11::const_ ) )
 
 namespace geode
 {
@@ -56,6 +56,8 @@ namespace geode
             module, "BRepComponentMeshesManifold" )
             .def( pybind11::init< const BRep& >() )
             .def( "inspect_brep_manifold",
-                &BRepComponentMeshesManifold::inspect_brep_manifold );
+                pybind11::overload_cast<>(
+                    &BRepComponentMeshesManifold::inspect_brep_manifold,
+                    pybind11::const_ ) );
     }
 } // namespace geode
@@ -44,6 +44,8 @@ namespace geode
                 &SectionMeshesInspectionResult::meshes_intersections )
             .def_readwrite( "meshes_non_manifolds",
                 &SectionMeshesInspectionResult::meshes_non_manifolds )
+            .def_readwrite( "status", &SectionMeshesInspectionResult::status )
+            .def_readwrite( "profile", &SectionMeshesInspectionResult::profile )
             .def( "string", &SectionMeshesInspectionResult::string )
             .def( "inspection_type",
                 &SectionMeshesInspectionResult::inspection_type );
@@ -55,6 +57,13 @@ namespace geode
             SectionMeshesIntersections >( module, "SectionMeshesInspector" )
             .def( pybind11::init< const Section& >() )
             .def( "inspect_section_meshes",
-                &SectionMeshesInspector::inspect_section_meshes );
+                pybind11::overload_cast<>(
+                    &SectionMeshesInspector::inspect_section_meshes,
+                    pybind11::const_ ) )
+            .def( "inspect_section_meshes",
+                pybind11::overload_cast< const InspectionOptions& >(
+                    &SectionMeshesInspector::inspect_section_meshes,
+                    pybind11::const_ ),
+                pybind11::call_guard< pybind11::gil_scoped_release >() );
     }
 } // namespace geode
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/mesh/core/tetrahedral_solid.hpp>
+#include <geode/mesh/core/triangulated_surface.hpp>
+
+#include <geode/model/representation/core/brep.hpp>
+
+#include <geode/inspector/defects_injection.hpp>
+
+namespace geode
+{
+    void define_defects_injection( pybind11::module& module )
+    {
+        pybind11::class_< InjectedDefects >( module, "InjectedDefects" )
+            .def( pybind11::init<>() )
+            .def_readwrite(
+                "nb_colocated_points", &InjectedDefects::nb_colocated_points )
+            .def_readwrite( "nb_degenerated_elements",
+                &InjectedDefects::nb_degenerated_elements )
+            .def_readwrite(
+                "nb_negative_elements", &InjectedDefects::nb_negative_elements )
+            .def_readwrite( "nb_non_manifold_elements",
+                &InjectedDefects::nb_non_manifold_elements )
+            .def_readwrite(
+                "nb_intersections", &InjectedDefects::nb_intersections )
+            .def_readwrite( "nb_topology_violations",
+                &InjectedDefects::nb_topology_violations )
+            .def_readwrite( "seed", &InjectedDefects::seed );
+        module
+            .def( "inject_surface_defects2D", &inject_surface_defects< 2 > )
+            .def( "inject_surface_defects3D", &inject_surface_defects< 3 > )
+            .def( "inject_solid_defects", &inject_solid_defects )
+            .def( "inject_brep_defects", &inject_brep_defects );
+    }
+} // namespace geode
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/inspector/inspection_options.hpp>
+
+namespace geode
+{
+    void define_inspection_options( pybind11::module& module )
+    {
+        pybind11::enum_< InspectionCriterion >( module, "InspectionCriterion" )
+            .value( "adjacency", InspectionCriterion::adjacency )
+            .value( "colocation", InspectionCriterion::colocation )
+            .value( "degeneration", InspectionCriterion::degeneration )
+            .value( "intersections", InspectionCriterion::intersections )
+            .value( "manifold", InspectionCriterion::manifold )
+            .value(
+                "negative_elements", InspectionCriterion::negative_elements )
+            .value( "topology", InspectionCriterion::topology );
+
+        pybind11::enum_< InspectionStatus >( module, "InspectionStatus" )
+            .value( "complete", InspectionStatus::complete )
+            .value( "truncated", InspectionStatus::truncated );
+
+        pybind11::class_< InspectionCancellation >(
+            module, "InspectionCancellation" )
+            .def( pybind11::init<>() )
+            .def( "cancel", &InspectionCancellation::cancel )
+            .def( "is_cancelled", &InspectionCancellation::is_cancelled );
+
+        pybind11::class_< InspectionProgress >( module, "InspectionProgress" )
+            .def_readonly( "criterion", &InspectionProgress::criterion )
+            .def_readonly( "component", &InspectionProgress::component )
+            .def_readonly( "nb_processed", &InspectionProgress::nb_processed )
+            .def_readonly( "nb_elements", &InspectionProgress::nb_elements );
+
+        pybind11::class_< InspectionOptions >( module, "InspectionOptions" )
+            .def( pybind11::init<>() )
+            .def_static( "no_criterion", &InspectionOptions::no_criterion )
+            .def( "is_enabled", &InspectionOptions::is_enabled )
+            .def( "enable", &InspectionOptions::enable )
+            .def( "disable", &InspectionOptions::disable )
+            .def( "set_enabled", &InspectionOptions::set_enabled )
+            .def( "is_profiled", &InspectionOptions::is_profiled )
+            .def( "set_profiled", &InspectionOptions::set_profiled )
+            .def( "set_progress_callback",
+                &InspectionOptions::set_progress_callback )
+            .def( "set_time_limit", &InspectionOptions::set_time_limit )
+            .def( "cancellation", &InspectionOptions::cancellation )
+            .def( "set_cancellation", &InspectionOptions::set_cancellation );
+    }
+} // namespace geode
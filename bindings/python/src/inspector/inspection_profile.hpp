@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#include <geode/inspector/inspection_profile.hpp>
+
+namespace geode
+{
+    void define_inspection_profile( pybind11::module& module )
+    {
+        pybind11::class_< ComponentProfile >( module, "ComponentProfile" )
+            .def( pybind11::init<>() )
+            .def( "throughput", &ComponentProfile::throughput )
+            .def_readwrite( "task", &ComponentProfile::task )
+            .def_readwrite( "component", &ComponentProfile::component )
+            .def_readwrite( "wall_time", &ComponentProfile::wall_time )
+            .def_readwrite( "nb_elements", &ComponentProfile::nb_elements );
+
+        pybind11::class_< CriterionProfile >( module, "CriterionProfile" )
+            .def( pybind11::init<>() )
+            .def( "throughput", &CriterionProfile::throughput )
+            .def_readwrite( "criterion", &CriterionProfile::criterion )
+            .def_readwrite( "wall_time", &CriterionProfile::wall_time )
+            .def_readwrite( "cpu_time", &CriterionProfile::cpu_time )
+            .def_readwrite(
+                "critical_path", &CriterionProfile::critical_path )
+            .def_readwrite( "process_peak_memory",
+                &CriterionProfile::process_peak_memory )
+            .def_readwrite( "process_peak_memory_increase",
+                &CriterionProfile::process_peak_memory_increase )
+            .def_readwrite( "nb_elements", &CriterionProfile::nb_elements )
+            .def_readwrite( "components", &CriterionProfile::components );
+
+        pybind11::class_< InspectionProfile >( module, "InspectionProfile" )
+            .def( pybind11::init<>() )
+            .def( "empty", &InspectionProfile::empty )
+            .def( "criteria", &InspectionProfile::criteria )
+            .def( "string", &InspectionProfile::string )
+            .def( "csv", &InspectionProfile::csv );
+    }
+} // namespace geode
@@ -21,6 +21,8 @@
  *
  */
 
+#include "pybind11/chrono.h"
+#include "pybind11/functional.h"
 #include "pybind11/iostream.h"
 #include "pybind11/pybind11.h"
 #include "pybind11/stl.h"
@@ -62,8 +64,13 @@
 #include "topology/section_topology.hpp"
 
 #include "brep_inspector.hpp"
+#include "defects_injection.hpp"
 #include "edgedcurve_inspector.hpp"
 #include "information.hpp"
+#include "inspection_options.hpp"
+#include "inspection_profile.hpp"
+#include "inspection_threads.hpp"
+#include "inspection_trace.hpp"
 #include "pointset_inspector.hpp"
 #include "section_inspector.hpp"
 #include "solid_inspector.hpp"
@@ -89,6 +96,10 @@ PYBIND11_MODULE( opengeode_inspector_py_inspector, module )
         module, "InspectorInspectorLibrary" )
         .def( "initialize", &geode::InspectorInspectorLibrary::initialize );
     geode::define_information( module );
+    geode::define_inspection_options( module );
+    geode::define_inspection_profile( module );
+    geode::define_inspection_threads( module );
+    geode::define_inspection_trace( module );
     geode::define_surface_adjacency( module );
     geode::define_solid_adjacency( module );
     geode::define_section_meshes_adjacency( module );
@@ -124,4 +135,5 @@ PYBIND11_MODULE( opengeode_inspector_py_inspector, module )
     geode::define_edged_curve_inspector( module );
     geode::define_surface_inspector( module );
     geode::define_solid_inspector( module );
+    geode::define_defects_injection( module );
 }
\ No newline at end of file
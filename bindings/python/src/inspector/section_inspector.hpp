@@ -36,6 +36,8 @@ namespace geode
             .def( pybind11::init<>() )
             .def_readwrite( "meshes", &SectionInspectionResult::meshes )
             .def_readwrite( "topology", &SectionInspectionResult::topology )
+            .def_readwrite( "status", &SectionInspectionResult::status )
+            .def_readwrite( "profile", &SectionInspectionResult::profile )
             .def( "string", &SectionInspectionResult::string )
             .def(
                 "inspection_type", &SectionInspectionResult::inspection_type );
@@ -43,7 +45,20 @@ namespace geode
         pybind11::class_< SectionInspector, SectionMeshesInspector,
             SectionTopologyInspector >( module, "SectionInspector" )
             .def( pybind11::init< const Section& >() )
-            .def( "inspect_section", &SectionInspector::inspect_section );
+            .def( "is_valid",
+                pybind11::overload_cast<>(
+                    &SectionInspector::is_valid, pybind11::const_ ) )
+            .def( "is_valid",
+                pybind11::overload_cast< const InspectionOptions& >(
+                    &SectionInspector::is_valid, pybind11::const_ ),
+                pybind11::call_guard< pybind11::gil_scoped_release >() )
+            .def( "inspect_section",
+                pybind11::overload_cast<>(
+                    &SectionInspector::inspect_section, pybind11::const_ ) )
+            .def( "inspect_section",
+                pybind11::overload_cast< const InspectionOptions& >(
+                    &SectionInspector::inspect_section, pybind11::const_ ),
+                pybind11::call_guard< pybind11::gil_scoped_release >() );
 
         module.def( "inspect_section", []( const Section& section ) {
             SectionInspector inspector{ section };
@@ -41,7 +41,13 @@ namespace geode
             SolidMeshEdgeManifold< dimension >,
             SolidMeshFacetManifold< dimension > >( module, name.c_str() )
             .def( pybind11::init< const SolidMesh& >() )
-            .def( "inspect_solid", &SolidMeshInspector::inspect_solid );
+            .def( "inspect_solid",
+                pybind11::overload_cast<>(
+                    &SolidMeshInspector::inspect_solid, pybind11::const_ ) )
+            .def( "inspect_solid",
+                pybind11::overload_cast< const InspectionOptions& >(
+                    &SolidMeshInspector::inspect_solid, pybind11::const_ ),
+                pybind11::call_guard< pybind11::gil_scoped_release >() );
 
         const auto inspect_function_name =
             absl::StrCat( "inspect_solid", dimension, "D" );
@@ -71,6 +77,8 @@ namespace geode
                 &SolidInspectionResult::non_manifold_edges )
             .def_readwrite( "non_manifold_facets",
                 &SolidInspectionResult::non_manifold_facets )
+            .def_readwrite( "status", &SolidInspectionResult::status )
+            .def_readwrite( "profile", &SolidInspectionResult::profile )
             .def( "string", &SolidInspectionResult::string )
             .def( "inspection_type", &SolidInspectionResult::inspection_type );
         do_define_solid_inspector< 3 >( module );
@@ -43,7 +43,14 @@ namespace geode
             SurfaceMeshVertexManifold< dimension >,
             SurfaceMeshIntersections< dimension > >( module, name.c_str() )
             .def( pybind11::init< const SurfaceMesh& >() )
-            .def( "inspect_surface", &SurfaceMeshInspector::inspect_surface );
+            .def( "inspect_surface",
+                pybind11::overload_cast<>(
+                    &SurfaceMeshInspector::inspect_surface, pybind11::const_ ) )
+            .def( "inspect_surface",
+                pybind11::overload_cast< const InspectionOptions& >(
+                    &SurfaceMeshInspector::inspect_surface,
+                    pybind11::const_ ),
+                pybind11::call_guard< pybind11::gil_scoped_release >() );
 
         const auto inspect_function_name =
             absl::StrCat( "inspect_surface", dimension, "D" );
@@ -73,6 +80,8 @@ namespace geode
                 &SurfaceInspectionResult::non_manifold_vertices )
             .def_readwrite( "intersecting_elements",
                 &SurfaceInspectionResult::intersecting_elements )
+            .def_readwrite( "status", &SurfaceInspectionResult::status )
+            .def_readwrite( "profile", &SurfaceInspectionResult::profile )
             .def( "string", &SurfaceInspectionResult::string )
             .def(
                 "inspection_type", &SurfaceInspectionResult::inspection_type );
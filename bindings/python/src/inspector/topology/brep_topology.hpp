@@ -160,6 +160,8 @@ namespace geode
                 &BRepTopologyInspector::
                     brep_unique_vertices_are_bijectively_linked_to_an_existing_component_vertex )
             .def( "inspect_brep_topology",
-                &BRepTopologyInspector::inspect_brep_topology );
+                pybind11::overload_cast<>(
+                    &BRepTopologyInspector::inspect_brep_topology,
+                    pybind11::const_ ) );
     }
 } // namespace geode
@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <geode/inspector/common.hpp>
 #include <geode/inspector/criterion/brep_meshes_inspector.hpp>
 #include <geode/inspector/mixin/add_inspectors.hpp>
@@ -39,6 +41,8 @@ namespace geode
     {
         BRepMeshesInspectionResult meshes;
         BRepTopologyInspectionResult topology;
+        InspectionStatus status{ InspectionStatus::complete };
+        InspectionProfile profile;
 
         [[nodiscard]] index_t nb_issues() const;
 
@@ -61,5 +65,76 @@ namespace geode
         explicit BRepInspector( const BRep& brep );
 
         [[nodiscard]] BRepInspectionResult inspect_brep() const;
+
+        /*!
+         * Returns true if the BRep has no issue. Criteria are checked
+         * concurrently from the cheapest to the most expensive one, the
+         * mesh intersections last, without building their issues. All of
+         * them stop as soon as one issue is found.
+         */
+        [[nodiscard]] bool is_valid() const;
+
+        /*!
+         * Same as is_valid(), stopped by the deadline or the cancellation of
+         * the options. A stopped validation returns false.
+         */
+        [[nodiscard]] bool is_valid( const InspectionOptions& options ) const;
+
+        /*!
+         * Inspects the BRep with the criteria enabled in the options only.
+         */
+        [[nodiscard]] BRepInspectionResult inspect_brep(
+            const InspectionOptions& options ) const;
+
+        /*!
+         * Inspects the given modified components, the unique vertices they
+         * are linked to and the intersections of their surfaces only.
+         */
+        [[nodiscard]] BRepInspectionResult inspect_brep(
+            absl::Span< const uuid > modified_components ) const;
+
+        /*!
+         * Same as above, the given unique vertices being inspected too.
+         */
+        [[nodiscard]] BRepInspectionResult inspect_brep(
+            absl::Span< const uuid > modified_components,
+            absl::Span< const index_t > unique_vertices ) const;
+
+        /*!
+         * Updates the result of a previous inspection of the whole BRep after
+         * the meshes of the given components have been modified: the issues
+         * related to these components are inspected again, the other ones
+         * are kept from the previous result.
+         * Block boundary surfaces only depend on the BRep relationships and
+         * are kept from the previous result. Edits deleting or relinking
+         * mesh vertices need the overload below.
+         */
+        [[nodiscard]] BRepInspectionResult inspect_brep(
+            absl::Span< const uuid > modified_components,
+            BRepInspectionResult previous_result ) const;
+
+        /*!
+         * Same as above for edits deleting or relinking mesh vertices:
+         * previous_unique_vertices are the unique vertices linked to the
+         * modified components before the edit, as returned by
+         * components_unique_vertices(). The unique vertices unlinked by the
+         * edit are inspected again, and the issues of the unique vertices
+         * removed from the BRep are dropped.
+         */
+        [[nodiscard]] BRepInspectionResult inspect_brep(
+            absl::Span< const uuid > modified_components,
+            absl::Span< const index_t > previous_unique_vertices,
+            BRepInspectionResult previous_result ) const;
+
+        /*!
+         * Returns the sorted unique vertices linked to the mesh vertices of
+         * the given components, to be given to the incremental inspection
+         * above before editing their meshes.
+         */
+        [[nodiscard]] std::vector< index_t > components_unique_vertices(
+            absl::Span< const uuid > components ) const;
+
+    private:
+        const BRep& brep_;
     };
 } // namespace geode
\ No newline at end of file
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/types/span.h>
 
 #include <geode/basic/pimpl.hpp>
 #include <geode/basic/uuid.hpp>
@@ -33,6 +34,7 @@
 
 #include <geode/inspector/common.hpp>
 #include <geode/inspector/information.hpp>
+#include <geode/inspector/inspection_context.hpp>
 
 namespace geode
 {
@@ -72,9 +74,32 @@ namespace geode
 
         ~BRepComponentMeshesAdjacency();
 
+        /*!
+         * Returns true as soon as one component mesh has a wrong adjacency,
+         * without building the issues.
+         */
+        [[nodiscard]] bool model_has_wrong_adjacencies() const;
+
+        [[nodiscard]] bool model_has_wrong_adjacencies(
+            const BRepInspectionContext& context ) const;
+
         [[nodiscard]] BRepMeshesAdjacencyInspectionResult
             inspect_brep_meshes_adjacencies() const;
 
+        /*!
+         * Inspects the meshes of the given components only.
+         */
+        [[nodiscard]] BRepMeshesAdjacencyInspectionResult
+            inspect_brep_meshes_adjacencies(
+                absl::Span< const uuid > components ) const;
+
+        /*!
+         * Inspects the meshes reusing the data of the given context.
+         */
+        [[nodiscard]] BRepMeshesAdjacencyInspectionResult
+            inspect_brep_meshes_adjacencies(
+                const BRepInspectionContext& context ) const;
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
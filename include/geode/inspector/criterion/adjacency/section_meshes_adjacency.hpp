@@ -67,6 +67,12 @@ namespace geode
 
         ~SectionComponentMeshesAdjacency();
 
+        /*!
+         * Returns true as soon as one component mesh has a wrong adjacency,
+         * without building the issues.
+         */
+        [[nodiscard]] bool model_has_wrong_adjacencies() const;
+
         [[nodiscard]] SectionMeshesAdjacencyInspectionResult
             inspect_section_meshes_adjacencies() const;
 
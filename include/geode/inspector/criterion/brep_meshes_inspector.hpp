@@ -31,6 +31,8 @@
 #include <geode/inspector/criterion/intersections/model_intersections.hpp>
 #include <geode/inspector/criterion/manifold/brep_meshes_manifold.hpp>
 #include <geode/inspector/criterion/negative_elements/brep_meshes_negative_elements.hpp>
+#include <geode/inspector/inspection_options.hpp>
+#include <geode/inspector/inspection_profile.hpp>
 
 namespace geode
 {
@@ -43,6 +45,8 @@ namespace geode
         ElementsIntersectionsInspectionResult meshes_intersections;
         BRepMeshesManifoldInspectionResult meshes_non_manifolds;
         BRepMeshesNegativeElementsInspectionResult meshes_negative_elements;
+        InspectionStatus status{ InspectionStatus::complete };
+        InspectionProfile profile;
 
         [[nodiscard]] index_t nb_issues() const;
 
@@ -70,5 +74,29 @@ namespace geode
         explicit BRepMeshesInspector( const BRep& brep );
 
         [[nodiscard]] BRepMeshesInspectionResult inspect_brep_meshes() const;
+
+        /*!
+         * Inspects the meshes with the criteria enabled in the options only.
+         */
+        [[nodiscard]] BRepMeshesInspectionResult inspect_brep_meshes(
+            const InspectionOptions& options ) const;
+
+        /*!
+         * Inspects the meshes of the given components only. Unique vertices
+         * colocation is inspected on the whole model.
+         */
+        [[nodiscard]] BRepMeshesInspectionResult inspect_brep_meshes(
+            absl::Span< const uuid > components ) const;
+
+        /*!
+         * Same as above, model non manifold edges and facets being also
+         * inspected around the given unique vertices.
+         */
+        [[nodiscard]] BRepMeshesInspectionResult inspect_brep_meshes(
+            absl::Span< const uuid > components,
+            absl::Span< const index_t > unique_vertices ) const;
+
+    private:
+        const BRep& brep_;
     };
 } // namespace geode
\ No newline at end of file
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/types/span.h>
 #include <geode/basic/pimpl.hpp>
 #include <geode/basic/uuid.hpp>
 
@@ -65,9 +66,22 @@ namespace geode
 
         ~ComponentMeshesColocation();
 
+        /*!
+         * Returns true as soon as one component mesh has colocated points
+         * linked to different unique vertices, without building the issues.
+         */
+        [[nodiscard]] bool model_has_colocated_points() const;
+
         [[nodiscard]] MeshesColocationInspectionResult
             inspect_meshes_point_colocations() const;
 
+        /*!
+         * Inspects the meshes of the given components only.
+         */
+        [[nodiscard]] MeshesColocationInspectionResult
+            inspect_meshes_point_colocations(
+                absl::Span< const uuid > components ) const;
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
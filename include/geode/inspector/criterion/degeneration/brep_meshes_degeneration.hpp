@@ -24,6 +24,7 @@
 #pragma once
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/types/span.h>
 
 #include <geode/basic/pimpl.hpp>
 #include <geode/basic/uuid.hpp>
@@ -71,9 +72,22 @@ namespace geode
 
         ~BRepComponentMeshesDegeneration();
 
+        /*!
+         * Returns true as soon as one component mesh has a degenerated
+         * element, without building the issues.
+         */
+        [[nodiscard]] bool model_has_degenerated_elements() const;
+
         [[nodiscard]] BRepMeshesDegenerationInspectionResult
             inspect_elements_degeneration() const;
 
+        /*!
+         * Inspects the meshes of the given components only.
+         */
+        [[nodiscard]] BRepMeshesDegenerationInspectionResult
+            inspect_elements_degeneration(
+                absl::Span< const uuid > components ) const;
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
@@ -68,6 +68,12 @@ namespace geode
 
         ~SectionComponentMeshesDegeneration();
 
+        /*!
+         * Returns true as soon as one component mesh has a degenerated
+         * element, without building the issues.
+         */
+        [[nodiscard]] bool model_has_degenerated_elements() const;
+
         [[nodiscard]] SectionMeshesDegenerationInspectionResult
             inspect_elements_degeneration() const;
 
@@ -35,6 +35,12 @@ namespace geode
 
 namespace geode
 {
+    struct SolidMeshDegenerationIssues
+    {
+        InspectionIssues< index_t > degenerated_edges;
+        InspectionIssues< index_t > degenerated_polyhedra;
+    };
+
     /*!
      * Class for inspecting the degeneration of a SolidMesh
      */
@@ -55,6 +61,13 @@ namespace geode
 
         [[nodiscard]] InspectionIssues< index_t > degenerated_polyhedra() const;
 
+        /*!
+         * Returns the degenerated edges and polyhedra, both gathered during a
+         * single traversal of the mesh polyhedra.
+         */
+        [[nodiscard]] SolidMeshDegenerationIssues
+            degenerated_edges_and_polyhedra() const;
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
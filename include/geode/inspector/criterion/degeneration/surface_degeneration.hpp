@@ -35,6 +35,12 @@ namespace geode
 
 namespace geode
 {
+    struct SurfaceMeshDegenerationIssues
+    {
+        InspectionIssues< index_t > degenerated_edges;
+        InspectionIssues< index_t > degenerated_polygons;
+    };
+
     /*!
      * Class for inspecting the degeneration of a SurfaceMesh
      */
@@ -55,6 +61,13 @@ namespace geode
 
         [[nodiscard]] InspectionIssues< index_t > degenerated_polygons() const;
 
+        /*!
+         * Returns the degenerated edges and polygons, both gathered during a
+         * single traversal of the mesh polygons.
+         */
+        [[nodiscard]] SurfaceMeshDegenerationIssues
+            degenerated_edges_and_polygons() const;
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
@@ -30,8 +30,13 @@
 
 namespace geode
 {
+    FORWARD_DECLARATION_DIMENSION_CLASS( Surface );
     struct uuid;
     struct PolygonEdge;
+    namespace internal
+    {
+        class InspectedComponents;
+    } // namespace internal
 } // namespace geode
 
 namespace geode
@@ -49,13 +54,29 @@ namespace geode
 
         public:
             void add_surfaces_edges_with_wrong_adjacencies(
+                const InspectedComponents& components,
                 InspectionIssuesMap< PolygonEdge >& issues_map ) const;
 
+            /*!
+             * Returns true as soon as one Surface mesh has an edge with a
+             * wrong adjacency.
+             */
+            [[nodiscard]] bool has_surfaces_edges_with_wrong_adjacencies()
+                const;
+
         protected:
             explicit ComponentMeshesAdjacency( const Model& model );
 
             [[nodiscard]] const Model& model() const;
 
+        private:
+            [[nodiscard]] InspectionIssues< PolygonEdge >
+                surface_edges_with_wrong_adjacencies(
+                    const Surface< Model::dim >& surface ) const;
+
+            [[nodiscard]] bool surface_has_wrong_adjacencies(
+                const Surface< Model::dim >& surface ) const;
+
         private:
             const Model& model_;
         };
@@ -32,6 +32,10 @@ namespace geode
 {
     struct uuid;
     struct PolygonEdge;
+    namespace internal
+    {
+        class InspectedComponents;
+    } // namespace internal
 } // namespace geode
 
 namespace geode
@@ -48,11 +52,21 @@ namespace geode
             OPENGEODE_DISABLE_COPY( ComponentMeshesDegeneration );
 
         public:
-            void add_degenerated_edges(
-                InspectionIssuesMap< index_t >& issues_map ) const;
+            /*!
+             * Adds the degenerated edges of the Lines and Surfaces and the
+             * degenerated polygons of the Surfaces. Components are inspected
+             * in parallel, each Surface mesh being traversed once.
+             */
+            void add_degenerated_edges_and_polygons(
+                const InspectedComponents& components,
+                InspectionIssuesMap< index_t >& edges_issues_map,
+                InspectionIssuesMap< index_t >& polygons_issues_map ) const;
 
-            void add_degenerated_polygons(
-                InspectionIssuesMap< index_t >& issues_map ) const;
+            /*!
+             * Returns true as soon as one Line or Surface mesh has a
+             * degenerated edge or polygon.
+             */
+            [[nodiscard]] bool has_degenerated_edges_or_polygons() const;
 
         protected:
             explicit ComponentMeshesDegeneration( const Model& model );
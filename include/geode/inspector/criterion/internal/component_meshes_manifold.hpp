@@ -30,6 +30,14 @@
 #include <geode/inspector/common.hpp>
 #include <geode/inspector/information.hpp>
 
+namespace geode
+{
+    namespace internal
+    {
+        class InspectedComponents;
+    } // namespace internal
+} // namespace geode
+
 namespace geode
 {
     namespace internal
@@ -45,12 +53,21 @@ namespace geode
 
         public:
             void add_surfaces_meshes_non_manifold_vertices(
+                const InspectedComponents& components,
                 InspectionIssuesMap< index_t >& issues_map ) const;
 
             void add_surfaces_meshes_non_manifold_edges(
+                const InspectedComponents& components,
                 InspectionIssuesMap< std::array< index_t, 2 > >& issues_map )
                 const;
 
+            /*!
+             * Returns true as soon as one Surface mesh has a non manifold
+             * vertex or edge.
+             */
+            [[nodiscard]] bool has_surfaces_meshes_non_manifold_elements()
+                const;
+
         protected:
             explicit ComponentMeshesManifold( const Model& model );
 
@@ -23,6 +23,10 @@
 
 #pragma once
 
+#include <array>
+#include <utility>
+#include <vector>
+
 #include <geode/inspector/common.hpp>
 #include <geode/inspector/information.hpp>
 
@@ -31,7 +35,10 @@ namespace geode
     namespace internal
     {
         /*!
-         * Implementation of the inspection of the degeneration of a Mesh
+         * Implementation of the inspection of the degeneration of a Mesh,
+         * its elements being the polygons or the polyhedra of the mesh.
+         * The mesh is never modified: when its edges are not enabled, unique
+         * edges are enumerated from the polygon or polyhedron connectivity.
          */
         template < typename Mesh >
         class DegenerationImpl
@@ -39,12 +46,35 @@ namespace geode
         public:
             virtual ~DegenerationImpl();
 
-            [[nodiscard]] virtual bool is_mesh_degenerated() const;
+            [[nodiscard]] bool is_mesh_degenerated() const;
 
             [[nodiscard]] InspectionIssues< index_t > degenerated_edges() const;
 
+            [[nodiscard]] InspectionIssues< index_t >
+                degenerated_elements() const;
+
+            /*!
+             * Returns the degenerated edges and the degenerated elements,
+             * both gathered during a single traversal of the mesh elements.
+             */
+            [[nodiscard]] std::pair< InspectionIssues< index_t >,
+                InspectionIssues< index_t > >
+                degenerated_edges_and_elements() const;
+
         private:
-            [[nodiscard]] bool edge_is_degenerated( index_t edge_index ) const;
+            [[nodiscard]] bool edge_is_degenerated(
+                const std::array< index_t, 2 >& edge_vertices ) const;
+
+            void add_degenerated_edge( index_t edge_index,
+                const std::array< index_t, 2 >& edge_vertices,
+                InspectionIssues< index_t >& issues ) const;
+
+            void add_degenerated_edges(
+                const std::vector< std::array< index_t, 2 > >& unique_edges,
+                InspectionIssues< index_t >& issues ) const;
+
+            void add_degenerated_element(
+                index_t element_id, InspectionIssues< index_t >& issues ) const;
 
         protected:
             explicit DegenerationImpl( const Mesh& mesh );
@@ -53,7 +83,6 @@ namespace geode
 
         private:
             const Mesh& mesh_;
-            bool enabled_edges_;
         };
     } // namespace internal
 } // namespace geode
@@ -23,10 +23,13 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/basic/pimpl.hpp>
 
 #include <geode/inspector/common.hpp>
 #include <geode/inspector/information.hpp>
+#include <geode/inspector/inspection_context.hpp>
 
 #include <geode/model/mixin/core/component_mesh_element.hpp>
 
@@ -70,6 +73,20 @@ namespace geode
         [[nodiscard]] ElementsIntersectionsInspectionResult
             inspect_intersections() const;
 
+        /*!
+         * Inspects the intersections involving the surfaces of the given
+         * components only.
+         */
+        [[nodiscard]] ElementsIntersectionsInspectionResult
+            inspect_intersections( absl::Span< const uuid > components ) const;
+
+        /*!
+         * Inspects the intersections reusing the data of the given context.
+         */
+        [[nodiscard]] ElementsIntersectionsInspectionResult
+            inspect_intersections(
+                const InspectionContext< Model >& context ) const;
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
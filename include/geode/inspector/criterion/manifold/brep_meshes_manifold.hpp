@@ -24,6 +24,7 @@
 #pragma once
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/types/span.h>
 
 #include <geode/basic/pimpl.hpp>
 #include <geode/basic/uuid.hpp>
@@ -35,6 +36,7 @@
 
 #include <geode/inspector/common.hpp>
 #include <geode/inspector/information.hpp>
+#include <geode/inspector/inspection_context.hpp>
 
 namespace geode
 {
@@ -95,9 +97,41 @@ namespace geode
 
         ~BRepComponentMeshesManifold();
 
+        /*!
+         * Returns true as soon as one component mesh has a non manifold
+         * element, without building their issues. The model edges and facets
+         * are inspected only if all the component meshes are manifold.
+         */
+        [[nodiscard]] bool model_has_non_manifold_elements() const;
+
+        [[nodiscard]] bool model_has_non_manifold_elements(
+            const BRepInspectionContext& context ) const;
+
         [[nodiscard]] BRepMeshesManifoldInspectionResult
             inspect_brep_manifold() const;
 
+        /*!
+         * Inspects the meshes of the given components only. Model edges and
+         * facets are inspected only if all their unique vertices belong to
+         * these components.
+         */
+        [[nodiscard]] BRepMeshesManifoldInspectionResult
+            inspect_brep_manifold( absl::Span< const uuid > components ) const;
+
+        /*!
+         * Same as above, model edges and facets being also inspected if
+         * their unique vertices belong to the given unique vertices.
+         */
+        [[nodiscard]] BRepMeshesManifoldInspectionResult inspect_brep_manifold(
+            absl::Span< const uuid > components,
+            absl::Span< const index_t > unique_vertices ) const;
+
+        /*!
+         * Inspects the meshes reusing the data of the given context.
+         */
+        [[nodiscard]] BRepMeshesManifoldInspectionResult
+            inspect_brep_manifold( const BRepInspectionContext& context ) const;
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
@@ -65,6 +65,12 @@ namespace geode
 
         ~SectionComponentMeshesManifold();
 
+        /*!
+         * Returns true as soon as one component mesh has a non manifold
+         * element, without building the issues.
+         */
+        [[nodiscard]] bool model_has_non_manifold_elements() const;
+
         [[nodiscard]] SectionMeshesManifoldInspectionResult
             inspect_section_manifold() const;
 
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/types/span.h>
 
 #include <geode/basic/pimpl.hpp>
 #include <geode/basic/uuid.hpp>
@@ -65,9 +66,22 @@ namespace geode
 
         ~BRepComponentMeshesNegativeElements();
 
+        /*!
+         * Returns true as soon as one component mesh has a negative element,
+         * without building the issues.
+         */
+        [[nodiscard]] bool model_has_negative_elements() const;
+
         [[nodiscard]] BRepMeshesNegativeElementsInspectionResult
             inspect_negative_elements() const;
 
+        /*!
+         * Inspects the meshes of the given components only.
+         */
+        [[nodiscard]] BRepMeshesNegativeElementsInspectionResult
+            inspect_negative_elements(
+                absl::Span< const uuid > components ) const;
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
@@ -67,6 +67,12 @@ namespace geode
 
         ~SectionComponentMeshesNegativeElements();
 
+        /*!
+         * Returns true as soon as one component mesh has a negative element,
+         * without building the issues.
+         */
+        [[nodiscard]] bool model_has_negative_elements() const;
+
         [[nodiscard]] SectionMeshesNegativeElementsInspectionResult
             inspect_negative_elements() const;
 
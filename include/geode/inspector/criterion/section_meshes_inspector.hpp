@@ -32,6 +32,8 @@
 #include <geode/inspector/criterion/manifold/section_meshes_manifold.hpp>
 #include <geode/inspector/criterion/negative_elements/section_meshes_negative_elements.hpp>
 #include <geode/inspector/information.hpp>
+#include <geode/inspector/inspection_options.hpp>
+#include <geode/inspector/inspection_profile.hpp>
 
 namespace geode
 {
@@ -44,6 +46,8 @@ namespace geode
         ElementsIntersectionsInspectionResult meshes_intersections;
         SectionMeshesManifoldInspectionResult meshes_non_manifolds;
         SectionMeshesNegativeElementsInspectionResult meshes_negative_elements;
+        InspectionStatus status{ InspectionStatus::complete };
+        InspectionProfile profile;
 
         [[nodiscard]] index_t nb_issues() const;
 
@@ -71,5 +75,14 @@ namespace geode
 
         [[nodiscard]] SectionMeshesInspectionResult
             inspect_section_meshes() const;
+
+        /*!
+         * Inspects the meshes with the criteria enabled in the options only.
+         */
+        [[nodiscard]] SectionMeshesInspectionResult inspect_section_meshes(
+            const InspectionOptions& options ) const;
+
+    private:
+        const Section& section_;
     };
 } // namespace geode
\ No newline at end of file
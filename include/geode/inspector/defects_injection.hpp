@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <geode/inspector/common.hpp>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( TriangulatedSurface );
+    FORWARD_DECLARATION_DIMENSION_CLASS( TetrahedralSolid );
+    ALIAS_3D( TetrahedralSolid );
+    class BRep;
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Numbers of defects to inject in a mesh or a model. Each defect is made
+     * of new vertices and elements, so the existing elements are left
+     * untouched and the defects can be counted by the matching criterion:
+     * - a colocated point is a new vertex at the position of a distinct
+     * existing vertex;
+     * - a degenerated element is a flat triangle or tetrahedron;
+     * - a negative element is an inverted triangle (2D only) or tetrahedron;
+     * - a non manifold element is an edge shared by three triangles or a
+     * facet shared by three tetrahedra, making their vertices non manifold
+     * too;
+     * - an intersection is a pair of crossing triangles;
+     * - a topology violation (models only) detaches a component mesh vertex
+     * from its unique vertex and adds exactly one topology issue. If the
+     * blocks are meshed, the surface vertex of a unique vertex only linked
+     * to one surface and to two blocks it bounds is detached, leaving a
+     * unique vertex part of two blocks and of no boundary surface.
+     * Otherwise, the line vertex of a unique vertex only linked to one line
+     * and to two surfaces it bounds is detached, leaving a unique vertex
+     * part of several surfaces and of no line.
+     * Defects other than colocated points are laid out in distinct cells of
+     * a grid next to the mesh bounding box, so that they intersect neither
+     * the mesh nor each other, except in 2D where a non manifold edge also
+     * makes two of its triangles overlap. Locations are drawn from a random
+     * generator initialized with seed, the same seed giving the same
+     * defects on every platform.
+     */
+    struct InjectedDefects
+    {
+        index_t nb_colocated_points{ 0 };
+        index_t nb_degenerated_elements{ 0 };
+        index_t nb_negative_elements{ 0 };
+        index_t nb_non_manifold_elements{ 0 };
+        index_t nb_intersections{ 0 };
+        index_t nb_topology_violations{ 0 };
+        index_t seed{ 0 };
+    };
+
+    /*!
+     * Injects defects in a surface. Negative elements are only available
+     * in 2D and topology violations are not available.
+     */
+    template < index_t dimension >
+    void opengeode_inspector_inspector_api inject_surface_defects(
+        TriangulatedSurface< dimension >& surface,
+        const InjectedDefects& defects );
+
+    /*!
+     * Injects defects in a solid. Intersections and topology violations are
+     * not available.
+     */
+    void opengeode_inspector_inspector_api inject_solid_defects(
+        TetrahedralSolid3D& solid, const InjectedDefects& defects );
+
+    /*!
+     * Injects defects in the component meshes of a BRep. Negative elements
+     * go to the tetrahedral blocks, the other mesh defects go to the
+     * triangulated surfaces, each defect to a randomly chosen component. New
+     * component vertices are linked to new unique vertices, so the topology
+     * inspection may also report the isolated defects.
+     */
+    void opengeode_inspector_inspector_api inject_brep_defects(
+        BRep& brep, const InjectedDefects& defects );
+} // namespace geode
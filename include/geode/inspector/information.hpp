@@ -23,12 +23,14 @@
 
 #pragma once
 
+#include <iterator>
 #include <string>
 #include <vector>
 
 #include <absl/container/flat_hash_map.h>
 
 #include <geode/basic/logger.hpp>
+#include <geode/basic/range.hpp>
 #include <geode/basic/types.hpp>
 #include <geode/basic/uuid.hpp>
 
@@ -63,6 +65,40 @@ namespace geode
             messages_.emplace_back( std::move( message ) );
         }
 
+        void add_issues( InspectionIssues< IssueType > other_issues )
+        {
+            issues_.insert( issues_.end(),
+                std::make_move_iterator( other_issues.issues_.begin() ),
+                std::make_move_iterator( other_issues.issues_.end() ) );
+            messages_.insert( messages_.end(),
+                std::make_move_iterator( other_issues.messages_.begin() ),
+                std::make_move_iterator( other_issues.messages_.end() ) );
+        }
+
+        /*!
+         * Removes the issues for which predicate( issue ) is true.
+         */
+        template < typename Predicate >
+        void remove_issues_if( const Predicate& predicate )
+        {
+            index_t nb_kept{ 0 };
+            for( const auto issue_id : Indices{ issues_ } )
+            {
+                if( predicate( issues_[issue_id] ) )
+                {
+                    continue;
+                }
+                if( nb_kept != issue_id )
+                {
+                    issues_[nb_kept] = std::move( issues_[issue_id] );
+                    messages_[nb_kept] = std::move( messages_[issue_id] );
+                }
+                nb_kept++;
+            }
+            issues_.resize( nb_kept );
+            messages_.resize( nb_kept );
+        }
+
         [[nodiscard]] std::string_view description() const
         {
             return description_;
@@ -133,6 +169,27 @@ namespace geode
             issues_map_.emplace( id_to_issues, std::move( issues ) );
         }
 
+        void add_issues( InspectionIssuesMap< IssueType > other_issues )
+        {
+            for( auto& issues : other_issues.issues_map_ )
+            {
+                issues_map_.insert_or_assign(
+                    issues.first, std::move( issues.second ) );
+            }
+        }
+
+        /*!
+         * Removes the issues of the components for which
+         * predicate( component_id ) is true.
+         */
+        template < typename Predicate >
+        void remove_issues_if( const Predicate& predicate )
+        {
+            absl::erase_if( issues_map_, [&predicate]( const auto& issues ) {
+                return predicate( issues.first );
+            } );
+        }
+
         [[nodiscard]] std::string string() const
         {
             if( issues_map_.empty() )
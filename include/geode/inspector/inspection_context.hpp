@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#pragma once
+
+#include <absl/types/span.h>
+
+#include <geode/basic/pimpl.hpp>
+
+#include <geode/inspector/common.hpp>
+
+namespace geode
+{
+    struct ComponentID;
+    class Section;
+    class BRep;
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Data derived from the component meshes of a Model and shared by the
+     * criteria of one inspection. The data is built when the context is
+     * created, one parallel task per component mesh.
+     * A context must not be used after the model meshes are modified.
+     */
+    template < typename Model >
+    class InspectionContext
+    {
+        OPENGEODE_DISABLE_COPY( InspectionContext );
+
+    public:
+        explicit InspectionContext( const Model& model );
+
+        ~InspectionContext();
+
+        /*!
+         * Returns the unique vertex of each vertex of the component mesh,
+         * NO_ID if the vertex is not linked to a unique vertex.
+         */
+        [[nodiscard]] absl::Span< const index_t > component_unique_vertices(
+            const ComponentID& component_id ) const;
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
+    };
+
+    using SectionInspectionContext = InspectionContext< Section >;
+    using BRepInspectionContext = InspectionContext< BRep >;
+} // namespace geode
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#include <geode/basic/uuid.hpp>
+
+#include <geode/inspector/common.hpp>
+
+namespace geode
+{
+    /*!
+     * Criteria which can be enabled or disabled in an inspection.
+     * Each criterion is a bit of the InspectionOptions mask.
+     */
+    enum struct InspectionCriterion : index_t
+    {
+        adjacency = 1u << 0,
+        colocation = 1u << 1,
+        degeneration = 1u << 2,
+        intersections = 1u << 3,
+        manifold = 1u << 4,
+        negative_elements = 1u << 5,
+        topology = 1u << 6
+    };
+
+    /*!
+     * Status of an inspection result. A truncated result has been stopped
+     * by its deadline or its cancellation before every element has been
+     * inspected: its issues are valid but may be incomplete.
+     */
+    enum struct InspectionStatus : local_index_t
+    {
+        complete,
+        truncated
+    };
+
+    /*!
+     * Token used to cancel inspections from another thread. Copies share the
+     * same state: cancelling one copy cancels every inspection using any of
+     * them.
+     */
+    class opengeode_inspector_inspector_api InspectionCancellation
+    {
+    public:
+        InspectionCancellation();
+
+        void cancel();
+
+        [[nodiscard]] bool is_cancelled() const;
+
+    private:
+        std::shared_ptr< std::atomic< bool > > cancelled_;
+    };
+
+    /*!
+     * Progress of the loop currently run by an inspection criterion. The
+     * component is set when the loop inspects the mesh of a single model
+     * component. The criterion name is only valid during the callback.
+     */
+    struct InspectionProgress
+    {
+        std::string_view criterion;
+        std::optional< uuid > component;
+        index_t nb_processed{ 0 };
+        index_t nb_elements{ 0 };
+    };
+
+    using InspectionProgressCallback =
+        std::function< void( const InspectionProgress& ) >;
+
+    /*!
+     * Selection of the criteria run by an inspection. All the criteria are
+     * enabled by default. The issues of a disabled criterion are left empty
+     * in the inspection result.
+     * An inspection can also be bounded by a deadline and a cancellation
+     * token, which are checked between elements by the criteria, and
+     * report its progress to a callback.
+     */
+    class opengeode_inspector_inspector_api InspectionOptions
+    {
+    public:
+        InspectionOptions();
+
+        /*!
+         * Returns options where every criterion is disabled.
+         */
+        [[nodiscard]] static InspectionOptions no_criterion();
+
+        [[nodiscard]] bool is_enabled( InspectionCriterion criterion ) const;
+
+        InspectionOptions& enable( InspectionCriterion criterion );
+
+        InspectionOptions& disable( InspectionCriterion criterion );
+
+        InspectionOptions& set_enabled(
+            InspectionCriterion criterion, bool enabled );
+
+        [[nodiscard]] std::optional< std::chrono::steady_clock::time_point >
+            deadline() const;
+
+        InspectionOptions& set_deadline(
+            std::chrono::steady_clock::time_point deadline );
+
+        /*!
+         * Sets the deadline to the current time plus the given limit.
+         */
+        InspectionOptions& set_time_limit( std::chrono::milliseconds limit );
+
+        [[nodiscard]] const std::optional< InspectionCancellation >&
+            cancellation() const;
+
+        InspectionOptions& set_cancellation(
+            InspectionCancellation cancellation );
+
+        [[nodiscard]] bool is_profiled() const;
+
+        /*!
+         * A profiled inspection records the resources used by each
+         * criterion in its result. Criteria then run one after the other,
+         * each of them still being parallel, so that the process CPU time
+         * and memory can be attributed to each one.
+         */
+        InspectionOptions& set_profiled( bool profiled );
+
+        [[nodiscard]] const InspectionProgressCallback&
+            progress_callback() const;
+
+        /*!
+         * The callback is called from the inspection threads, at most once
+         * per PROGRESS_REPORT_INTERVAL and never concurrently. Criteria
+         * never wait for it: a progress update is dropped while the
+         * callback is running. The final update of each loop is always
+         * reported, possibly from another thread.
+         */
+        InspectionOptions& set_progress_callback(
+            InspectionProgressCallback callback );
+
+        static constexpr std::chrono::milliseconds PROGRESS_REPORT_INTERVAL{
+            1000
+        };
+
+    private:
+        index_t criteria_;
+        bool profiled_{ false };
+        std::optional< std::chrono::steady_clock::time_point > deadline_;
+        std::optional< InspectionCancellation > cancellation_;
+        InspectionProgressCallback progress_callback_;
+    };
+} // namespace geode
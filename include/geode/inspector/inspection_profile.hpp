@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <geode/basic/uuid.hpp>
+
+#include <geode/inspector/common.hpp>
+
+namespace geode
+{
+    /*!
+     * Wall time of one component mesh inspected by a task of a profiled
+     * criterion. The elements are the vertices of the component mesh.
+     */
+    struct opengeode_inspector_inspector_api ComponentProfile
+    {
+        [[nodiscard]] double throughput() const;
+
+        std::string task;
+        uuid component;
+        double wall_time{ 0 };
+        index_t nb_elements{ 0 };
+    };
+
+    /*!
+     * Resources used by one criterion of a profiled inspection.
+     * Memory values are high-water marks of the resident memory of the
+     * whole process, in bytes, not allocations of the criterion: the
+     * increase is zero when the criterion stays below an earlier peak.
+     * Components are sorted by decreasing wall time. The critical path is
+     * the wall time of the longest component task: the criterion cannot
+     * run faster, whatever the number of threads.
+     */
+    struct opengeode_inspector_inspector_api CriterionProfile
+    {
+        [[nodiscard]] double throughput() const;
+
+        std::string criterion;
+        double wall_time{ 0 };
+        double cpu_time{ 0 };
+        double critical_path{ 0 };
+        std::size_t process_peak_memory{ 0 };
+        std::size_t process_peak_memory_increase{ 0 };
+        index_t nb_elements{ 0 };
+        std::vector< ComponentProfile > components;
+    };
+
+    /*!
+     * Profile of an inspection, one entry per criterion in execution order.
+     * Times are in seconds and throughputs in elements per second.
+     */
+    class opengeode_inspector_inspector_api InspectionProfile
+    {
+    public:
+        [[nodiscard]] bool empty() const;
+
+        [[nodiscard]] const std::vector< CriterionProfile >& criteria() const;
+
+        void add_criterion( CriterionProfile criterion );
+
+        void add_profile( InspectionProfile other );
+
+        [[nodiscard]] std::string string() const;
+
+        /*!
+         * Returns the profile as CSV, one header line then one line per
+         * criterion followed by one line per component of this criterion.
+         * Criterion lines have no task nor component, component lines have
+         * no CPU time, critical path nor memory.
+         */
+        [[nodiscard]] std::string csv() const;
+
+    private:
+        std::vector< CriterionProfile > criteria_;
+    };
+} // namespace geode
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#pragma once
+
+#include <geode/inspector/common.hpp>
+
+namespace geode
+{
+    /*!
+     * Sets the number of threads of the pool running the inspection tasks
+     * of the process. Concurrent inspections share this pool, so their
+     * total number of threads stays bounded. Zero restores the default
+     * Async++ pool. Must not be called while an inspection is running.
+     */
+    void opengeode_inspector_inspector_api set_inspection_nb_threads(
+        index_t nb_threads );
+
+    /*!
+     * Returns the number of threads set by set_inspection_nb_threads,
+     * zero if the default Async++ pool is used.
+     */
+    [[nodiscard]] index_t opengeode_inspector_inspector_api
+        inspection_nb_threads();
+} // namespace geode
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#pragma once
+
+#include <string>
+
+#include <geode/inspector/common.hpp>
+
+namespace geode
+{
+    /*!
+     * Starts recording the inspection tasks of the process: criteria,
+     * topology parts, component meshes and AABB tree traversals. Events
+     * recorded by a previous trace are discarded. When no trace is
+     * recording, a task only pays for an atomic load.
+     */
+    void opengeode_inspector_inspector_api start_inspection_trace();
+
+    /*!
+     * Stops recording and returns the recorded tasks in the Chrome Trace
+     * Event JSON format, to be loaded in chrome://tracing or Perfetto.
+     * Each inspection thread is shown on its own track.
+     */
+    [[nodiscard]] std::string opengeode_inspector_inspector_api
+        stop_inspection_trace();
+} // namespace geode
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include <geode/inspector/common.hpp>
+#include <geode/inspector/inspection_profile.hpp>
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Collects the profiles of the component tasks of one profiled
+         * criterion. Tasks may add their profile concurrently.
+         */
+        class ComponentProfiler
+        {
+        public:
+            void add_component( ComponentProfile component )
+            {
+                const std::lock_guard< std::mutex > lock{ mutex_ };
+                components_.emplace_back( std::move( component ) );
+            }
+
+            [[nodiscard]] std::vector< ComponentProfile > components()
+            {
+                const std::lock_guard< std::mutex > lock{ mutex_ };
+                return std::move( components_ );
+            }
+
+        private:
+            std::mutex mutex_;
+            std::vector< ComponentProfile > components_;
+        };
+    } // namespace internal
+} // namespace geode
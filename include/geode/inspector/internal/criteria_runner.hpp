@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string_view>
+
+#include <geode/inspector/common.hpp>
+#include <geode/inspector/inspection_options.hpp>
+#include <geode/inspector/inspection_profile.hpp>
+#include <geode/inspector/internal/component_profiler.hpp>
+#include <geode/inspector/internal/inspection_scheduler.hpp>
+#include <geode/inspector/internal/trace_scope.hpp>
+
+namespace geode
+{
+    class BRep;
+    class Section;
+} // namespace geode
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Criterion run by a CriteriaRunner. A criterion without name is
+         * run but not recorded in the profile nor in the trace.
+         */
+        template < typename Functor >
+        struct CriterionTask
+        {
+            bool enabled;
+            std::string_view name;
+            index_t nb_elements;
+            const Functor& functor;
+        };
+
+        template < typename Functor >
+        [[nodiscard]] CriterionTask< Functor > criterion_task( bool enabled,
+            std::string_view name,
+            index_t nb_elements,
+            const Functor& functor )
+        {
+            return { enabled, name, nb_elements, functor };
+        }
+
+        template < typename Functor >
+        [[nodiscard]] CriterionTask< Functor > unprofiled_task(
+            const Functor& functor )
+        {
+            return { true, {}, 0, functor };
+        }
+
+        /*!
+         * Runs the enabled criteria of an inspection in parallel or, for a
+         * profiled inspection, one after the other while recording their
+         * resources and the wall time of their component tasks.
+         */
+        class CriteriaRunner
+        {
+        public:
+            explicit CriteriaRunner( const InspectionOptions& options );
+
+            [[nodiscard]] bool is_profiled() const;
+
+            template < typename... Functors >
+            void run( const CriterionTask< Functors >&... tasks )
+            {
+                if( !profiled_ )
+                {
+                    parallel_invoke( [&tasks] {
+                        if( tasks.enabled )
+                        {
+                            run_task( tasks );
+                        }
+                    }... );
+                    return;
+                }
+                ( profile_task( tasks ), ... );
+            }
+
+            [[nodiscard]] InspectionProfile profile();
+
+        private:
+            template < typename Functor >
+            static void run_task( const CriterionTask< Functor >& task )
+            {
+                if( task.name.empty() )
+                {
+                    task.functor();
+                    return;
+                }
+                const TraceScope trace{ "criterion", task.name };
+                const ProgressScope progress{ task.name };
+                task.functor();
+            }
+
+            struct ResourceUsage
+            {
+                std::chrono::steady_clock::time_point wall_time;
+                double cpu_time;
+                std::size_t process_peak_memory;
+            };
+
+            template < typename Functor >
+            void profile_task( const CriterionTask< Functor >& task )
+            {
+                if( !task.enabled )
+                {
+                    return;
+                }
+                if( task.name.empty() )
+                {
+                    task.functor();
+                    return;
+                }
+                ComponentProfiler profiler;
+                auto context = current_progress_context();
+                context.profiler = &profiler;
+                const ProgressScope scope{ context };
+                const auto start = current_resource_usage();
+                run_task( task );
+                add_criterion(
+                    task.name, task.nb_elements, start, profiler.components() );
+            }
+
+            [[nodiscard]] static ResourceUsage current_resource_usage();
+
+            void add_criterion( std::string_view name,
+                index_t nb_elements,
+                const ResourceUsage& start,
+                std::vector< ComponentProfile > components );
+
+        private:
+            bool profiled_;
+            InspectionProfile profile_;
+        };
+
+        struct ModelElementCounts
+        {
+            index_t unique_vertices{ 0 };
+            index_t vertices{ 0 };
+            index_t edges{ 0 };
+            index_t polygons{ 0 };
+            index_t polyhedra{ 0 };
+        };
+
+        [[nodiscard]] ModelElementCounts model_element_counts(
+            const Section& section );
+
+        [[nodiscard]] ModelElementCounts model_element_counts(
+            const BRep& brep );
+    } // namespace internal
+} // namespace geode
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <absl/container/flat_hash_set.h>
+#include <absl/types/span.h>
+
+#include <geode/basic/uuid.hpp>
+
+#include <geode/inspector/common.hpp>
+#include <geode/inspector/internal/component_profiler.hpp>
+#include <geode/inspector/internal/inspection_scheduler.hpp>
+#include <geode/inspector/internal/trace_scope.hpp>
+
+namespace geode
+{
+    class BRep;
+} // namespace geode
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Set of the model components whose meshes are inspected. A default
+         * constructed set contains all the components of the model.
+         */
+        class InspectedComponents
+        {
+        public:
+            InspectedComponents() = default;
+
+            explicit InspectedComponents( absl::Span< const uuid > components )
+                : components_{ std::in_place, components.begin(),
+                      components.end() }
+            {
+            }
+
+            [[nodiscard]] bool contains_all() const
+            {
+                return !components_.has_value();
+            }
+
+            [[nodiscard]] bool contains( const uuid& component ) const
+            {
+                return !components_ || components_->contains( component );
+            }
+
+        private:
+            std::optional< absl::flat_hash_set< uuid > > components_;
+        };
+
+        /*!
+         * Returns the sorted unique vertices linked to the mesh vertices of
+         * the given BRep components. Unknown uuids are ignored.
+         */
+        [[nodiscard]] std::vector< index_t > components_unique_vertices(
+            const BRep& brep, absl::Span< const uuid > components );
+
+        /*!
+         * Same as above, merged with the given unique vertices. Unique
+         * vertices no longer in the BRep are ignored.
+         */
+        [[nodiscard]] std::vector< index_t > components_unique_vertices(
+            const BRep& brep,
+            absl::Span< const uuid > components,
+            absl::Span< const index_t > unique_vertices );
+
+        /*!
+         * Returns the inspected components of the range, sorted by decreasing
+         * number of mesh vertices. One task per component started in this
+         * order lets the largest meshes begin first while the small ones
+         * fill the other threads.
+         */
+        template < typename ComponentRange >
+        [[nodiscard]] auto inspected_components_by_decreasing_size(
+            ComponentRange&& components,
+            const InspectedComponents& inspected_components )
+        {
+            using Component = std::remove_cv_t<
+                std::remove_reference_t< decltype( *components.begin() ) > >;
+            std::vector< const Component* > sorted_components;
+            for( const auto& component : components )
+            {
+                if( inspected_components.contains( component.id() ) )
+                {
+                    sorted_components.push_back( &component );
+                }
+            }
+            std::stable_sort( sorted_components.begin(),
+                sorted_components.end(),
+                []( const Component* lhs, const Component* rhs ) {
+                    return lhs->mesh().nb_vertices()
+                           > rhs->mesh().nb_vertices();
+                } );
+            return sorted_components;
+        }
+
+        /*!
+         * Calls functor( id ) on each component of a vector returned by
+         * inspected_components_by_decreasing_size, one task per component.
+         * Whatever the order in which the scheduler starts the tasks, each
+         * task claims the next component of the vector, so the components
+         * start from the largest one. Components not started yet when the
+         * inspection stop is requested are skipped. Each task is recorded in
+         * the inspection trace under the given name and reports its progress
+         * for its component. In a profiled inspection, the wall time of each
+         * task is added to the profiler of the current criterion.
+         */
+        template < typename Component, typename Functor >
+        void parallel_for_components(
+            const std::vector< const Component* >& components,
+            std::string_view name,
+            const Functor& functor )
+        {
+            std::atomic< std::size_t > next_component{ 0 };
+            internal::parallel_for(
+                async::irange( std::size_t{ 0 }, components.size() ),
+                [&components, name, &functor, &next_component](
+                    std::size_t /*task_id*/ ) {
+                    const auto id = next_component.fetch_add(
+                        1, std::memory_order_relaxed );
+                    const TraceScope trace{ "component", name,
+                        { components[id]->id() } };
+                    const ProgressScope progress{ components[id]->id() };
+                    auto* profiler = current_progress_context().profiler;
+                    if( !profiler )
+                    {
+                        functor( id );
+                        return;
+                    }
+                    const auto start = std::chrono::steady_clock::now();
+                    functor( id );
+                    profiler->add_component( { std::string{ name },
+                        components[id]->id(),
+                        std::chrono::duration< double >(
+                            std::chrono::steady_clock::now() - start )
+                            .count(),
+                        components[id]->mesh().nb_vertices() } );
+                } );
+        }
+
+        /*!
+         * Returns true if predicate( id ) is true for at least one component
+         * of a vector returned by inspected_components_by_decreasing_size.
+         * Components are tested in parallel, the ones not started yet are
+         * skipped as soon as one predicate is true.
+         */
+        template < typename Component, typename Predicate >
+        [[nodiscard]] bool parallel_any_of_components(
+            const std::vector< const Component* >& components,
+            std::string_view name,
+            const Predicate& predicate )
+        {
+            std::atomic< bool > found{ false };
+            parallel_for_components(
+                components, name, [&found, &predicate]( std::size_t id ) {
+                    if( found.load( std::memory_order_relaxed ) )
+                    {
+                        return;
+                    }
+                    if( predicate( id ) )
+                    {
+                        found.store( true, std::memory_order_relaxed );
+                    }
+                } );
+            return found.load();
+        }
+    } // namespace internal
+} // namespace geode
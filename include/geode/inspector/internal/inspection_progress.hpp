@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <geode/basic/uuid.hpp>
+
+#include <geode/inspector/common.hpp>
+#include <geode/inspector/inspection_options.hpp>
+
+namespace geode
+{
+    namespace internal
+    {
+        class ComponentProfiler;
+    } // namespace internal
+} // namespace geode
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Forwards the progress of one inspection to its callback. Reports
+         * are throttled and never wait for the callback: a report is dropped
+         * if the callback is already running in another thread. The final
+         * report of a loop is never dropped: it is queued and forwarded by
+         * the thread running the callback.
+         */
+        class ProgressReporter
+        {
+            OPENGEODE_DISABLE_COPY( ProgressReporter );
+
+        public:
+            explicit ProgressReporter( InspectionProgressCallback callback );
+
+            void report( std::string_view criterion,
+                const uuid* component,
+                index_t nb_processed,
+                index_t nb_elements ) const;
+
+        private:
+            struct FinalReport
+            {
+                std::string criterion;
+                std::optional< uuid > component;
+                index_t nb_elements;
+            };
+
+            void forward_final_reports() const;
+
+            [[nodiscard]] bool has_final_reports() const;
+
+        private:
+            InspectionProgressCallback callback_;
+            mutable std::atomic< std::chrono::steady_clock::rep >
+                next_report_{ 0 };
+            mutable std::atomic_flag reporting_ = ATOMIC_FLAG_INIT;
+            mutable std::mutex final_reports_mutex_;
+            mutable std::vector< FinalReport > final_reports_;
+        };
+
+        /*!
+         * Progress reporter, criterion and component of the task run by a
+         * thread. The reporter is null when no progress is reported, the
+         * profiler is null when the components are not profiled.
+         */
+        struct ProgressContext
+        {
+            /*!
+             * Reports that nb_processed of the nb_elements of the current
+             * loop have been processed.
+             */
+            void report( index_t nb_processed, index_t nb_elements ) const
+            {
+                if( reporter )
+                {
+                    reporter->report(
+                        criterion, component, nb_processed, nb_elements );
+                }
+            }
+
+            const ProgressReporter* reporter{ nullptr };
+            std::string_view criterion;
+            const uuid* component{ nullptr };
+            ComponentProfiler* profiler{ nullptr };
+        };
+
+        /*!
+         * Returns the progress context of the current thread, without
+         * reporter outside of any inspection.
+         */
+        [[nodiscard]] const ProgressContext& current_progress_context();
+
+        /*!
+         * Sets the progress context of the current thread until the end of
+         * the scope. The criterion and component constructors keep the other
+         * fields of the current context.
+         */
+        class ProgressScope
+        {
+            OPENGEODE_DISABLE_COPY( ProgressScope );
+
+        public:
+            explicit ProgressScope( const ProgressContext& context );
+
+            explicit ProgressScope( std::string_view criterion );
+
+            explicit ProgressScope( const uuid& component );
+
+            ~ProgressScope();
+
+        private:
+            ProgressContext context_;
+            const ProgressContext* previous_context_;
+        };
+
+        /*!
+         * Reports the progress of an inspection to the callback of its
+         * options until the end of the scope. Does nothing if the options
+         * have no callback or if the current thread already reports the
+         * progress of an enclosing inspection.
+         */
+        class InspectionProgressScope
+        {
+            OPENGEODE_DISABLE_COPY( InspectionProgressScope );
+
+        public:
+            explicit InspectionProgressScope(
+                const InspectionOptions& options );
+
+        private:
+            std::optional< ProgressReporter > reporter_;
+            std::optional< ProgressScope > scope_;
+        };
+    } // namespace internal
+} // namespace geode
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#pragma once
+
+#include <utility>
+
+#include <async++.h>
+
+#include <geode/inspector/common.hpp>
+#include <geode/inspector/internal/inspection_progress.hpp>
+#include <geode/inspector/internal/inspection_stop.hpp>
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Returns the thread pool on which every inspection task is
+         * scheduled.
+         */
+        [[nodiscard]] async::threadpool_scheduler& inspection_scheduler();
+
+        /*!
+         * Runs the functors in parallel on the inspection scheduler, each
+         * task inheriting the inspection stop and the progress context of the
+         * calling thread.
+         */
+        template < typename... Functors >
+        void parallel_invoke( const Functors&... functors )
+        {
+            const auto& stop = current_inspection_stop();
+            const auto& progress = current_progress_context();
+            async::parallel_invoke( inspection_scheduler(),
+                [&stop, &progress, &functors] {
+                    const InspectionStopScope scope{ stop };
+                    const ProgressScope progress_scope{ progress };
+                    functors();
+                }... );
+        }
+
+        /*!
+         * Calls functor( value ) on each value of the range in parallel on
+         * the inspection scheduler, each task inheriting the inspection stop
+         * and the progress context of the calling thread. The values not
+         * started yet when the stop is requested are skipped.
+         */
+        template < typename Range, typename Functor >
+        void parallel_for( Range&& range, const Functor& functor )
+        {
+            const auto& stop = current_inspection_stop();
+            const auto& progress = current_progress_context();
+            async::parallel_for( inspection_scheduler(),
+                std::forward< Range >( range ),
+                [&stop, &progress, &functor]( auto value ) {
+                    if( stop.is_requested() )
+                    {
+                        return;
+                    }
+                    const InspectionStopScope scope{ stop };
+                    const ProgressScope progress_scope{ progress };
+                    functor( value );
+                } );
+        }
+    } // namespace internal
+} // namespace geode
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <optional>
+
+#include <geode/inspector/common.hpp>
+#include <geode/inspector/inspection_options.hpp>
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Deadline and cancellation of one inspection, shared by all its
+         * tasks. Records whether a task has been stopped, so that the
+         * inspection result can be marked as truncated.
+         */
+        class InspectionStop
+        {
+            OPENGEODE_DISABLE_COPY( InspectionStop );
+
+        public:
+            InspectionStop() = default;
+
+            explicit InspectionStop( const InspectionOptions& options );
+
+            /*!
+             * Returns true if the deadline is reached or the inspection is
+             * cancelled. The caller must then stop inspecting.
+             */
+            [[nodiscard]] bool is_requested() const;
+
+            /*!
+             * Stops the inspection, as if its deadline was reached.
+             */
+            void request() const;
+
+            [[nodiscard]] InspectionStatus status() const;
+
+        private:
+            std::optional< std::chrono::steady_clock::time_point > deadline_;
+            std::optional< InspectionCancellation > cancellation_;
+            mutable std::atomic< bool > stopped_{ false };
+        };
+
+        /*!
+         * Returns the stop of the inspection run by the current thread, or a
+         * stop which is never requested outside of any inspection.
+         */
+        [[nodiscard]] const InspectionStop& current_inspection_stop();
+
+        /*!
+         * Sets the stop of the inspection run by the current thread until
+         * the end of the scope.
+         */
+        class InspectionStopScope
+        {
+            OPENGEODE_DISABLE_COPY( InspectionStopScope );
+
+        public:
+            explicit InspectionStopScope( const InspectionStop& stop );
+
+            ~InspectionStopScope();
+
+        private:
+            const InspectionStop* previous_stop_;
+        };
+    } // namespace internal
+} // namespace geode
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+#include <async++.h>
+
+#include <geode/inspector/common.hpp>
+#include <geode/inspector/information.hpp>
+#include <geode/inspector/internal/inspection_scheduler.hpp>
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Number of consecutive elements processed by one task of the chunked
+         * parallel loops.
+         */
+        inline constexpr index_t PARALLEL_CHUNK_SIZE{ 4096 };
+
+        [[nodiscard]] inline index_t nb_parallel_chunks( index_t nb_elements )
+        {
+            return ( nb_elements + PARALLEL_CHUNK_SIZE - 1 )
+                   / PARALLEL_CHUNK_SIZE;
+        }
+
+        /*!
+         * Splits [0, nb_elements) in chunks of PARALLEL_CHUNK_SIZE elements
+         * and calls chunk_functor( chunk_id, begin, end ) on each chunk in
+         * parallel. A single chunk is processed on the calling thread.
+         * Every chunk is processed, even if the inspection stop is requested.
+         * The number of processed elements is reported after each chunk.
+         */
+        template < typename ChunkFunctor >
+        void parallel_for_chunks(
+            index_t nb_elements, const ChunkFunctor& chunk_functor )
+        {
+            const auto nb_chunks = nb_parallel_chunks( nb_elements );
+            if( nb_chunks == 0 )
+            {
+                return;
+            }
+            const auto& progress = current_progress_context();
+            if( nb_chunks == 1 )
+            {
+                chunk_functor( index_t{ 0 }, index_t{ 0 }, nb_elements );
+                progress.report( nb_elements, nb_elements );
+                return;
+            }
+            const auto& stop = current_inspection_stop();
+            std::atomic< index_t > nb_processed{ 0 };
+            async::parallel_for( inspection_scheduler(),
+                async::irange( index_t{ 0 }, nb_chunks ),
+                [&chunk_functor, &stop, &progress, &nb_processed, nb_elements](
+                    index_t chunk_id ) {
+                    const InspectionStopScope scope{ stop };
+                    const ProgressScope progress_scope{ progress };
+                    const auto begin = chunk_id * PARALLEL_CHUNK_SIZE;
+                    const auto end =
+                        std::min( begin + PARALLEL_CHUNK_SIZE, nb_elements );
+                    chunk_functor( chunk_id, begin, end );
+                    if( progress.reporter )
+                    {
+                        const auto nb_chunk_elements = end - begin;
+                        const auto nb_previous = nb_processed.fetch_add(
+                            nb_chunk_elements, std::memory_order_relaxed );
+                        progress.report(
+                            nb_previous + nb_chunk_elements, nb_elements );
+                    }
+                } );
+        }
+
+        /*!
+         * Returns true if predicate( element ) is true for at least one
+         * element in [0, nb_elements). Chunks are scanned in parallel and
+         * share a stop flag, so every chunk stops as soon as one element is
+         * found. Chunks are skipped once the inspection stop is requested.
+         */
+        template < typename Predicate >
+        [[nodiscard]] bool parallel_any_of(
+            index_t nb_elements, const Predicate& predicate )
+        {
+            std::atomic< bool > found{ false };
+            const auto& stop = current_inspection_stop();
+            parallel_for_chunks( nb_elements,
+                [&found, &predicate, &stop](
+                    index_t /*chunk_id*/, index_t begin, index_t end ) {
+                    if( stop.is_requested() )
+                    {
+                        return;
+                    }
+                    for( const auto element : Range{ begin, end } )
+                    {
+                        if( found.load( std::memory_order_relaxed ) )
+                        {
+                            return;
+                        }
+                        if( predicate( element ) )
+                        {
+                            found.store( true, std::memory_order_relaxed );
+                            return;
+                        }
+                    }
+                } );
+            return found.load();
+        }
+
+        /*!
+         * Evaluates the predicates in parallel and returns true if they are
+         * all true. The inspection stop is requested as soon as a predicate
+         * is false, so that the other predicates can return early. A
+         * predicate not evaluated because of the stop is considered false,
+         * and so is a predicate stopped while running, which may have
+         * skipped some of its work: a stopped evaluation returns false.
+         * Predicates are given from the cheapest to the most expensive one.
+         */
+        template < typename... Predicates >
+        [[nodiscard]] bool parallel_all_of( const Predicates&... predicates )
+        {
+            std::atomic< bool > all_true{ true };
+            const auto& stop = current_inspection_stop();
+            parallel_invoke( [&all_true, &stop, &predicates] {
+                if( stop.is_requested() || !predicates() )
+                {
+                    all_true.store( false );
+                    stop.request();
+                }
+            }... );
+            return all_true.load()
+                   && stop.status() == InspectionStatus::complete;
+        }
+
+        /*!
+         * Calls inspect_chunk( begin, end, chunk_issues ) on every chunk of
+         * [0, nb_elements), in parallel. Each chunk fills its own issues
+         * buffer, buffers are then appended to issues in element order so the
+         * result does not depend on the scheduling. Chunks are skipped once
+         * the inspection stop is requested.
+         */
+        template < typename IssueType, typename ChunkInspector >
+        void parallel_add_chunks_issues( index_t nb_elements,
+            InspectionIssues< IssueType >& issues,
+            const ChunkInspector& inspect_chunk )
+        {
+            std::vector< InspectionIssues< IssueType > > chunks_issues(
+                nb_parallel_chunks( nb_elements ) );
+            const auto& stop = current_inspection_stop();
+            parallel_for_chunks( nb_elements,
+                [&chunks_issues, &inspect_chunk, &stop](
+                    index_t chunk_id, index_t begin, index_t end ) {
+                    if( stop.is_requested() )
+                    {
+                        return;
+                    }
+                    inspect_chunk( begin, end, chunks_issues[chunk_id] );
+                } );
+            for( auto& chunk_issues : chunks_issues )
+            {
+                issues.add_issues( std::move( chunk_issues ) );
+            }
+        }
+
+        /*!
+         * Calls inspect_element( element, chunk_issues ) on every element in
+         * [0, nb_elements), in parallel, with the same ordering guarantee as
+         * parallel_add_chunks_issues.
+         */
+        template < typename IssueType, typename ElementInspector >
+        void parallel_add_issues( index_t nb_elements,
+            InspectionIssues< IssueType >& issues,
+            const ElementInspector& inspect_element )
+        {
+            parallel_add_chunks_issues( nb_elements, issues,
+                [&inspect_element]( index_t begin, index_t end,
+                    InspectionIssues< IssueType >& chunk_issues ) {
+                    for( const auto element : Range{ begin, end } )
+                    {
+                        inspect_element( element, chunk_issues );
+                    }
+                } );
+        }
+
+        /*!
+         * Calls inspect_element( element, chunk_result ) on every element in
+         * [0, nb_elements), in parallel, each chunk filling its own default
+         * constructed Result. Chunk results are returned in element order,
+         * to be merged by the caller. Chunks are skipped once the inspection
+         * stop is requested.
+         */
+        template < typename Result, typename ElementInspector >
+        [[nodiscard]] std::vector< Result > parallel_chunks_results(
+            index_t nb_elements, const ElementInspector& inspect_element )
+        {
+            std::vector< Result > chunks_results(
+                nb_parallel_chunks( nb_elements ) );
+            const auto& stop = current_inspection_stop();
+            parallel_for_chunks( nb_elements,
+                [&chunks_results, &inspect_element, &stop](
+                    index_t chunk_id, index_t begin, index_t end ) {
+                    if( stop.is_requested() )
+                    {
+                        return;
+                    }
+                    auto& chunk_result = chunks_results[chunk_id];
+                    for( const auto element : Range{ begin, end } )
+                    {
+                        inspect_element( element, chunk_result );
+                    }
+                } );
+            return chunks_results;
+        }
+
+        /*!
+         * Sorts [begin, end) by sorting one run per hardware thread in
+         * parallel, then merging the runs pairwise, each merge pass being
+         * itself parallel.
+         */
+        template < typename RandomIterator, typename Compare >
+        void parallel_sort(
+            RandomIterator begin, RandomIterator end, const Compare& compare )
+        {
+            const auto nb_elements =
+                static_cast< index_t >( std::distance( begin, end ) );
+            const auto nb_threads = std::max(
+                static_cast< index_t >( std::thread::hardware_concurrency() ),
+                index_t{ 1 } );
+            const auto run_size = std::max( PARALLEL_CHUNK_SIZE,
+                ( nb_elements + nb_threads - 1 ) / nb_threads );
+            const auto nb_runs = ( nb_elements + run_size - 1 ) / run_size;
+            if( nb_runs < 2 )
+            {
+                std::sort( begin, end, compare );
+                return;
+            }
+            async::parallel_for( inspection_scheduler(),
+                async::irange( index_t{ 0 }, nb_runs ),
+                [begin, &compare, run_size, nb_elements]( index_t run_id ) {
+                    const auto run_begin = run_id * run_size;
+                    const auto run_end =
+                        std::min( run_begin + run_size, nb_elements );
+                    std::sort( begin + run_begin, begin + run_end, compare );
+                } );
+            for( auto width = run_size; width < nb_elements; width *= 2 )
+            {
+                const auto nb_merges =
+                    ( nb_elements + 2 * width - 1 ) / ( 2 * width );
+                async::parallel_for( inspection_scheduler(),
+                    async::irange( index_t{ 0 }, nb_merges ),
+                    [begin, &compare, width, nb_elements]( index_t merge_id ) {
+                        const auto merge_begin = merge_id * 2 * width;
+                        const auto merge_middle =
+                            std::min( merge_begin + width, nb_elements );
+                        const auto merge_end =
+                            std::min( merge_middle + width, nb_elements );
+                        if( merge_middle < merge_end )
+                        {
+                            std::inplace_merge( begin + merge_begin,
+                                begin + merge_middle, begin + merge_end,
+                                compare );
+                        }
+                    } );
+            }
+        }
+    } // namespace internal
+} // namespace geode
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <absl/types/span.h>
+
+#include <geode/basic/uuid.hpp>
+
+#include <geode/inspector/common.hpp>
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Records the lifetime of the scope as one event of the inspection
+         * trace, on the track of the current thread. Does nothing when no
+         * trace is recording.
+         */
+        class TraceScope
+        {
+            OPENGEODE_DISABLE_COPY( TraceScope );
+
+        public:
+            TraceScope( std::string_view category, std::string_view name );
+
+            TraceScope( std::string_view category,
+                std::string_view name,
+                absl::Span< const uuid > components );
+
+            ~TraceScope();
+
+        private:
+            std::string_view category_;
+            std::string_view name_;
+            bool recording_;
+            std::chrono::steady_clock::time_point begin_;
+            std::vector< std::string > components_;
+        };
+    } // namespace internal
+} // namespace geode
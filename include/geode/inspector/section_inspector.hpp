@@ -34,6 +34,8 @@ namespace geode
     {
         SectionMeshesInspectionResult meshes;
         SectionTopologyInspectionResult topology;
+        InspectionStatus status{ InspectionStatus::complete };
+        InspectionProfile profile;
 
         [[nodiscard]] index_t nb_issues() const;
 
@@ -56,5 +58,28 @@ namespace geode
         explicit SectionInspector( const Section& section );
 
         [[nodiscard]] SectionInspectionResult inspect_section() const;
+
+        /*!
+         * Returns true if the Section has no issue. Criteria are checked
+         * concurrently from the cheapest to the most expensive one, the
+         * mesh intersections last, without building their issues. All of
+         * them stop as soon as one issue is found.
+         */
+        [[nodiscard]] bool is_valid() const;
+
+        /*!
+         * Same as is_valid(), stopped by the deadline or the cancellation of
+         * the options. A stopped validation returns false.
+         */
+        [[nodiscard]] bool is_valid( const InspectionOptions& options ) const;
+
+        /*!
+         * Inspects the Section with the criteria enabled in the options only.
+         */
+        [[nodiscard]] SectionInspectionResult inspect_section(
+            const InspectionOptions& options ) const;
+
+    private:
+        const Section& section_;
     };
 } // namespace geode
\ No newline at end of file
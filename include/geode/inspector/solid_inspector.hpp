@@ -31,6 +31,8 @@
 #include <geode/inspector/criterion/manifold/solid_facet_manifold.hpp>
 #include <geode/inspector/criterion/manifold/solid_vertex_manifold.hpp>
 #include <geode/inspector/criterion/negative_elements/solid_negative_elements.hpp>
+#include <geode/inspector/inspection_options.hpp>
+#include <geode/inspector/inspection_profile.hpp>
 #include <geode/inspector/mixin/add_inspectors.hpp>
 
 namespace geode
@@ -62,6 +64,8 @@ namespace geode
         InspectionIssues< index_t > negative_polyhedra{
             "Negative polyhedra not tested"
         };
+        InspectionStatus status{ InspectionStatus::complete };
+        InspectionProfile profile;
 
         [[nodiscard]] index_t nb_issues() const;
 
@@ -92,6 +96,15 @@ namespace geode
         explicit SolidMeshInspector( const SolidMesh< dimension >& mesh );
 
         [[nodiscard]] SolidInspectionResult inspect_solid() const;
+
+        /*!
+         * Inspects the solid with the criteria enabled in the options only.
+         */
+        [[nodiscard]] SolidInspectionResult inspect_solid(
+            const InspectionOptions& options ) const;
+
+    private:
+        const SolidMesh< dimension >& mesh_;
     };
     ALIAS_3D( SolidMeshInspector );
 } // namespace geode
\ No newline at end of file
@@ -30,6 +30,8 @@
 #include <geode/inspector/criterion/intersections/surface_intersections.hpp>
 #include <geode/inspector/criterion/manifold/surface_edge_manifold.hpp>
 #include <geode/inspector/criterion/manifold/surface_vertex_manifold.hpp>
+#include <geode/inspector/inspection_options.hpp>
+#include <geode/inspector/inspection_profile.hpp>
 #include <geode/inspector/mixin/add_inspectors.hpp>
 
 namespace geode
@@ -57,6 +59,8 @@ namespace geode
         InspectionIssues< std::pair< index_t, index_t > > intersecting_elements{
             "Intersection between mesh elements not tested"
         };
+        InspectionStatus status{ InspectionStatus::complete };
+        InspectionProfile profile;
 
         [[nodiscard]] index_t nb_issues() const;
 
@@ -89,6 +93,15 @@ namespace geode
         virtual ~SurfaceMeshInspector() = default;
 
         [[nodiscard]] virtual SurfaceInspectionResult inspect_surface() const;
+
+        /*!
+         * Inspects the surface with the criteria enabled in the options only.
+         */
+        [[nodiscard]] virtual SurfaceInspectionResult inspect_surface(
+            const InspectionOptions& options ) const;
+
+    private:
+        const SurfaceMesh< dimension >& mesh_;
     };
     ALIAS_2D_AND_3D( SurfaceMeshInspector );
 } // namespace geode
\ No newline at end of file
@@ -39,6 +39,11 @@ namespace geode
     ALIAS_3D( Block );
     struct ComponentMeshVertex;
     class BRep;
+    namespace internal
+    {
+        class BRepUniqueVerticesSummary;
+        class InspectedComponents;
+    } // namespace internal
 } // namespace geode
 
 namespace geode
@@ -99,6 +104,37 @@ namespace geode
 
         [[nodiscard]] BRepBlocksTopologyInspectionResult inspect_blocks() const;
 
+    private:
+        friend class BRepTopologyInspector;
+
+        [[nodiscard]] bool brep_blocks_topology_is_valid(
+            const internal::BRepUniqueVerticesSummary& summary,
+            index_t unique_vertex_index ) const;
+
+        /*!
+         * Inspects the given blocks and the unique vertices of the summary
+         * only. Block boundary surfaces are checked only if the summary
+         * covers the whole model.
+         */
+        [[nodiscard]] BRepBlocksTopologyInspectionResult inspect_blocks(
+            const internal::BRepUniqueVerticesSummary& summary,
+            const internal::InspectedComponents& components ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            unique_vertex_is_part_of_two_blocks_and_no_boundary_surface(
+                const internal::BRepUniqueVerticesSummary& summary,
+                index_t unique_vertex_index ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            unique_vertex_block_cmvs_count_is_incorrect(
+                const internal::BRepUniqueVerticesSummary& summary,
+                index_t unique_vertex_index ) const;
+
+        void add_unique_vertex_issues(
+            const internal::BRepUniqueVerticesSummary& summary,
+            index_t unique_vertex_id,
+            BRepBlocksTopologyInspectionResult& result ) const;
+
     private:
         const BRep& brep_;
     };
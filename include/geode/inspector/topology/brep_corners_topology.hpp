@@ -36,6 +36,11 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( Corner );
     ALIAS_3D( Corner );
     class BRep;
+    namespace internal
+    {
+        class BRepUniqueVerticesSummary;
+        class InspectedComponents;
+    } // namespace internal
 } // namespace geode
 
 namespace geode
@@ -113,6 +118,47 @@ namespace geode
         [[nodiscard]] BRepCornersTopologyInspectionResult
             inspect_corners_topology() const;
 
+    private:
+        friend class BRepTopologyInspector;
+
+        [[nodiscard]] bool brep_corner_topology_is_valid(
+            const internal::BRepUniqueVerticesSummary& summary,
+            index_t unique_vertex_index ) const;
+
+        /*!
+         * Inspects the given corners and the unique vertices of the summary
+         * only.
+         */
+        [[nodiscard]] BRepCornersTopologyInspectionResult
+            inspect_corners_topology(
+                const internal::BRepUniqueVerticesSummary& summary,
+                const internal::InspectedComponents& components ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            unique_vertex_has_multiple_corners(
+                const internal::BRepUniqueVerticesSummary& summary,
+                index_t unique_vertex_index ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            corner_has_multiple_embeddings(
+                const internal::BRepUniqueVerticesSummary& summary,
+                index_t unique_vertex_index ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            corner_is_not_internal_nor_boundary(
+                const internal::BRepUniqueVerticesSummary& summary,
+                index_t unique_vertex_index ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            corner_is_part_of_line_but_not_boundary(
+                const internal::BRepUniqueVerticesSummary& summary,
+                index_t unique_vertex_index ) const;
+
+        void add_unique_vertex_issues(
+            const internal::BRepUniqueVerticesSummary& summary,
+            index_t unique_vertex_id,
+            BRepCornersTopologyInspectionResult& result ) const;
+
     private:
         const BRep& brep_;
     };
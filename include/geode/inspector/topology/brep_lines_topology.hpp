@@ -36,6 +36,11 @@ namespace geode
     ALIAS_3D( Line );
     struct ComponentMeshVertex;
     class BRep;
+    namespace internal
+    {
+        class BRepUniqueVerticesSummary;
+        class InspectedComponents;
+    } // namespace internal
 } // namespace geode
 
 namespace geode
@@ -121,6 +126,46 @@ namespace geode
         [[nodiscard]] BRepLinesTopologyInspectionResult
             inspect_lines_topology() const;
 
+    private:
+        friend class BRepTopologyInspector;
+
+        [[nodiscard]] bool brep_lines_topology_is_valid(
+            const internal::BRepUniqueVerticesSummary& summary,
+            index_t unique_vertex_index ) const;
+
+        /*!
+         * Inspects the given lines and the unique vertices of the summary
+         * only.
+         */
+        [[nodiscard]] BRepLinesTopologyInspectionResult inspect_lines_topology(
+            const internal::BRepUniqueVerticesSummary& summary,
+            const internal::InspectedComponents& components ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_is_part_of_not_internal_nor_boundary_line(
+                const internal::BRepUniqueVerticesSummary& summary,
+                index_t unique_vertex_index ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_is_part_of_invalid_embedded_line(
+                const internal::BRepUniqueVerticesSummary& summary,
+                index_t unique_vertex_index ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_is_part_of_invalid_single_line(
+                const internal::BRepUniqueVerticesSummary& summary,
+                index_t unique_vertex_index ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_has_lines_but_is_not_a_corner(
+                const internal::BRepUniqueVerticesSummary& summary,
+                index_t unique_vertex_index ) const;
+
+        void add_unique_vertex_issues(
+            const internal::BRepUniqueVerticesSummary& summary,
+            index_t unique_vertex_id,
+            BRepLinesTopologyInspectionResult& result ) const;
+
     private:
         const BRep& brep_;
     };
@@ -34,6 +34,11 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( Surface );
     ALIAS_3D( Surface );
     class BRep;
+    namespace internal
+    {
+        class BRepUniqueVerticesSummary;
+        class InspectedComponents;
+    } // namespace internal
 } // namespace geode
 
 namespace geode
@@ -135,6 +140,52 @@ namespace geode
         [[nodiscard]] BRepSurfacesTopologyInspectionResult
             inspect_surfaces_topology() const;
 
+    private:
+        friend class BRepTopologyInspector;
+
+        [[nodiscard]] bool brep_surfaces_topology_is_valid(
+            const internal::BRepUniqueVerticesSummary& summary,
+            index_t unique_vertex_index ) const;
+
+        /*!
+         * Inspects the given surfaces and the unique vertices of the summary
+         * only.
+         */
+        [[nodiscard]] BRepSurfacesTopologyInspectionResult
+            inspect_surfaces_topology(
+                const internal::BRepUniqueVerticesSummary& summary,
+                const internal::InspectedComponents& components ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_is_part_of_not_internal_nor_boundary_surface(
+                const internal::BRepUniqueVerticesSummary& summary,
+                index_t unique_vertex_index ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_is_part_of_invalid_embedded_surface(
+                const internal::BRepUniqueVerticesSummary& summary,
+                index_t unique_vertex_index ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_is_part_of_invalid_single_surface(
+                const internal::BRepUniqueVerticesSummary& summary,
+                index_t unique_vertex_index ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_is_part_of_invalid_multiple_surfaces(
+                const internal::BRepUniqueVerticesSummary& summary,
+                index_t unique_vertex_index ) const;
+
+        [[nodiscard]] std::optional< std::string >
+            vertex_is_part_of_line_and_not_on_surface_border(
+                const internal::BRepUniqueVerticesSummary& summary,
+                index_t unique_vertex_index ) const;
+
+        void add_unique_vertex_issues(
+            const internal::BRepUniqueVerticesSummary& summary,
+            index_t unique_vertex_id,
+            BRepSurfacesTopologyInspectionResult& result ) const;
+
     private:
         const BRep& brep_;
     };
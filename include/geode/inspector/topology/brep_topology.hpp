@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/basic/pimpl.hpp>
 
 #include <geode/inspector/common.hpp>
@@ -93,6 +95,21 @@ namespace geode
         [[nodiscard]] BRepTopologyInspectionResult
             inspect_brep_topology() const;
 
+        /*!
+         * Inspects the topology of the given components and of their unique
+         * vertices only. Block boundary surfaces are not checked.
+         */
+        [[nodiscard]] BRepTopologyInspectionResult inspect_brep_topology(
+            absl::Span< const uuid > components ) const;
+
+        /*!
+         * Same as above, the given unique vertices being inspected too, e.g.
+         * the ones linked to the components before their meshes were edited.
+         */
+        [[nodiscard]] BRepTopologyInspectionResult inspect_brep_topology(
+            absl::Span< const uuid > components,
+            absl::Span< const index_t > unique_vertices ) const;
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
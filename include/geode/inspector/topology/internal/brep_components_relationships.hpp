@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/types/span.h>
+
+#include <geode/basic/uuid.hpp>
+
+#include <geode/model/mixin/core/component_type.hpp>
+
+#include <geode/inspector/common.hpp>
+
+namespace geode
+{
+    class BRep;
+} // namespace geode
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Immutable snapshot of the boundary and internal relationships
+         * between BRep components. Components are given dense indices,
+         * grouped by kind (corners, lines, surfaces, blocks) and sorted by
+         * uuid within a kind. Related components are stored in sorted
+         * adjacency lists, so that relationship queries do not hash uuids.
+         */
+        class BRepComponentsRelationships
+        {
+        public:
+            enum struct ComponentKind : local_index_t
+            {
+                corner,
+                line,
+                surface,
+                block,
+                other
+            };
+
+            enum struct Scope : local_index_t
+            {
+                /*!
+                 * Relationships of all the BRep components.
+                 */
+                whole_model,
+                /*!
+                 * Relationships of the given components and of the
+                 * components related to them only.
+                 */
+                neighborhood
+            };
+
+            /*!
+             * The given components are always indexed, even the ones which
+             * do not belong to the BRep (they have no relationship).
+             */
+            BRepComponentsRelationships( const BRep& brep,
+                absl::Span< const ComponentID > components,
+                Scope scope );
+
+            [[nodiscard]] Scope scope() const;
+
+            [[nodiscard]] index_t nb_components() const;
+
+            [[nodiscard]] const ComponentID& component_id(
+                index_t component ) const;
+
+            /*!
+             * Returns the dense index of the component, or NO_ID if it is not
+             * indexed.
+             */
+            [[nodiscard]] index_t component_index(
+                const uuid& component_id ) const;
+
+            /*!
+             * Returns the first dense index of the components of the given
+             * kind, the components of a kind being contiguous.
+             */
+            [[nodiscard]] index_t kind_begin( ComponentKind kind ) const;
+
+            [[nodiscard]] index_t kind_end( ComponentKind kind ) const;
+
+            [[nodiscard]] bool is_kind(
+                index_t component, ComponentKind kind ) const;
+
+            [[nodiscard]] ComponentKind kind( index_t component ) const;
+
+            [[nodiscard]] absl::Span< const index_t > boundaries(
+                index_t component ) const;
+
+            [[nodiscard]] absl::Span< const index_t > incidences(
+                index_t component ) const;
+
+            [[nodiscard]] absl::Span< const index_t > internals(
+                index_t component ) const;
+
+            [[nodiscard]] absl::Span< const index_t > embeddings(
+                index_t component ) const;
+
+            [[nodiscard]] bool is_boundary(
+                index_t boundary, index_t incidence ) const;
+
+            [[nodiscard]] bool is_internal(
+                index_t internal, index_t embedding ) const;
+
+        private:
+            /*!
+             * Compressed adjacency lists: the related components of component
+             * c are values[offsets[c], offsets[c + 1]), sorted by index.
+             */
+            struct Adjacency
+            {
+                [[nodiscard]] absl::Span< const index_t > related(
+                    index_t component ) const;
+
+                std::vector< index_t > offsets;
+                std::vector< index_t > values;
+            };
+
+            using Relation = std::pair< index_t, index_t >;
+
+            void index_components( std::vector< ComponentID > components );
+
+            static Adjacency build_adjacency( index_t nb_components,
+                absl::Span< const Relation > relations );
+
+        private:
+            Scope scope_;
+            std::vector< ComponentID > components_;
+            absl::flat_hash_map< uuid, index_t > component_indices_;
+            std::array< index_t, 6 > kinds_begin_{};
+            Adjacency boundaries_;
+            Adjacency incidences_;
+            Adjacency internals_;
+            Adjacency embeddings_;
+        };
+    } // namespace internal
+} // namespace geode
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/inlined_vector.h>
+#include <absl/types/span.h>
+
+#include <geode/inspector/common.hpp>
+#include <geode/inspector/topology/internal/brep_components_relationships.hpp>
+
+namespace geode
+{
+    class BRep;
+} // namespace geode
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Flat description of the components of a set of BRep unique
+         * vertices, built once and shared by all the topology checks.
+         * Components are identified by their dense index in the
+         * relationships snapshot. The component mesh vertices of each unique
+         * vertex are grouped by component kind, so that the components of a
+         * given kind are a contiguous range, and keep the BRep order within
+         * a kind.
+         */
+        class BRepUniqueVerticesSummary
+        {
+        public:
+            using ComponentKind = BRepComponentsRelationships::ComponentKind;
+
+            struct VertexComponent
+            {
+                index_t component{ NO_ID };
+                index_t vertex{ NO_ID };
+            };
+
+            /*!
+             * Summary of all the unique vertices of the BRep.
+             */
+            explicit BRepUniqueVerticesSummary( const BRep& brep );
+
+            /*!
+             * Summary restricted to the given unique vertices, only those can
+             * be queried. Relationships are only known around the components
+             * of these vertices.
+             */
+            BRepUniqueVerticesSummary(
+                const BRep& brep, absl::Span< const index_t > unique_vertices );
+
+            /*!
+             * Returns the number of summarized unique vertices.
+             */
+            [[nodiscard]] index_t nb_unique_vertices() const;
+
+            /*!
+             * Returns the summarized unique vertex at the given position, in
+             * [0, nb_unique_vertices()).
+             */
+            [[nodiscard]] index_t unique_vertex( index_t position ) const;
+
+            [[nodiscard]] bool blocks_are_meshed() const;
+
+            [[nodiscard]] const BRepComponentsRelationships&
+                relationships() const;
+
+            /*!
+             * Returns the component mesh vertices of the unique vertex.
+             */
+            [[nodiscard]] absl::Span< const VertexComponent >
+                vertex_components( index_t unique_vertex ) const;
+
+            /*!
+             * Returns the dense component index of every component mesh
+             * vertex of the unique vertex, in BRep order.
+             */
+            [[nodiscard]] absl::Span< const index_t > cmv_components(
+                index_t unique_vertex ) const;
+
+            /*!
+             * Returns the component mesh vertices of the unique vertex
+             * belonging to components of the given kind, in BRep order.
+             */
+            [[nodiscard]] absl::Span< const VertexComponent >
+                vertex_components(
+                    index_t unique_vertex, ComponentKind kind ) const;
+
+            /*!
+             * Returns the dense indices of the distinct components of the
+             * given kind the unique vertex belongs to, in uuid order.
+             */
+            [[nodiscard]] absl::InlinedVector< index_t, 4 > components(
+                index_t unique_vertex, ComponentKind kind ) const;
+
+            /*!
+             * Returns the number of component mesh vertices of the unique
+             * vertex in the given component.
+             */
+            [[nodiscard]] index_t nb_component_vertices(
+                index_t unique_vertex, index_t component_index ) const;
+
+            [[nodiscard]] bool has_component(
+                index_t unique_vertex, index_t component_index ) const;
+
+        private:
+            template < typename UniqueVertexFunctor >
+            void build( const BRep& brep,
+                index_t nb_vertices,
+                const UniqueVertexFunctor& unique_vertex );
+
+            [[nodiscard]] index_t position( index_t unique_vertex ) const;
+
+        private:
+            bool all_unique_vertices_{ true };
+            std::vector< index_t > unique_vertices_;
+            absl::flat_hash_map< index_t, index_t > positions_;
+            std::optional< BRepComponentsRelationships > relationships_;
+            std::vector< index_t > offsets_;
+            std::vector< VertexComponent > vertex_components_;
+            std::vector< index_t > cmv_components_;
+            bool blocks_are_meshed_{ true };
+        };
+    } // namespace internal
+} // namespace geode
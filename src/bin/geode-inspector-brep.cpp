@@ -38,14 +38,20 @@
 #include <geode/io/model/common.hpp>
 
 #include <geode/inspector/brep_inspector.hpp>
+#include <geode/inspector/inspection_threads.hpp>
+
+#include "inspection_flags.hpp"
 
 ABSL_FLAG( std::string, input, "/path/my/model.og_brep", "Input model" );
 
 void inspect_brep( const geode::BRep& brep )
 {
     const geode::BRepInspector brep_inspector{ brep };
-    auto result = brep_inspector.inspect_brep();
+    start_trace();
+    auto result = brep_inspector.inspect_brep( inspection_options() );
+    save_trace();
     geode::Logger::info( result.string() );
+    report_profile( result.profile );
 }
 
 int main( int argc, char* argv[] )
@@ -56,8 +62,9 @@ int main( int argc, char* argv[] )
             absl::StrCat( "BRep inspector from Geode-solutions.\n",
                 "Sample usage:\n", argv[0], " --input my_brep.og_brep\n",
                 "Default behavior tests all available criteria, to disable one "
-                "use --noXXX, e.g. --nocomponent_linking" ) );
+                "use --noXXX, e.g. --nointersections" ) );
         absl::ParseCommandLine( argc, argv );
+        geode::set_inspection_nb_threads( absl::GetFlag( FLAGS_threads ) );
 
         geode::IOModelLibrary::initialize();
         const auto filename = absl::GetFlag( FLAGS_input );
@@ -36,16 +36,22 @@
 
 #include <geode/geosciences_io/model/common.hpp>
 
+#include <geode/inspector/inspection_threads.hpp>
 #include <geode/inspector/section_inspector.hpp>
 
+#include "inspection_flags.hpp"
+
 ABSL_FLAG( std::string, input, "/path/my/model.og_xsctn", "Input model" );
 
 void inspect_cross_section( const geode::CrossSection& cross_section )
 {
     const geode::SectionInspector cross_section_inspector{ cross_section };
-    auto result = cross_section_inspector.inspect_section();
-
+    start_trace();
+    const auto result =
+        cross_section_inspector.inspect_section( inspection_options() );
+    save_trace();
     geode::Logger::info( result.string() );
+    report_profile( result.profile );
 }
 
 int main( int argc, char* argv[] )
@@ -56,8 +62,9 @@ int main( int argc, char* argv[] )
             "CrossSection inspector from Geode-solutions.\n", "Sample usage:\n",
             argv[0], " --input my_cross_section.og_xsctn\n",
             "Default behavior tests all available criteria, to disable one "
-            "use --noXXX, e.g. --nocomponent_linking" ) );
+            "use --noXXX, e.g. --nointersections" ) );
         absl::ParseCommandLine( argc, argv );
+        geode::set_inspection_nb_threads( absl::GetFlag( FLAGS_threads ) );
 
         geode::GeosciencesIOModelLibrary::initialize();
         const auto filename = absl::GetFlag( FLAGS_input );
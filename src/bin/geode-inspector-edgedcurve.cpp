@@ -38,8 +38,13 @@
 #include <geode/io/mesh/common.hpp>
 
 #include <geode/inspector/edgedcurve_inspector.hpp>
+#include <geode/inspector/inspection_threads.hpp>
 
 ABSL_FLAG( std::string, input, "/path/my/curve.og_edc3d", "Input edged curve" );
+ABSL_FLAG( geode::index_t,
+    threads,
+    0,
+    "Number of inspection threads (0 for the default thread pool)" );
 
 template < geode::index_t dimension >
 void inspect_edged_curve( const geode::EdgedCurve< dimension >& edged_curve )
@@ -60,6 +65,7 @@ int main( int argc, char* argv[] )
                 "Default behavior test all available criteria, to disable one "
                 "use --noXXX, e.g. --nocolocation" ) );
         absl::ParseCommandLine( argc, argv );
+        geode::set_inspection_nb_threads( absl::GetFlag( FLAGS_threads ) );
 
         geode::IOMeshLibrary::initialize();
         const auto filename = absl::GetFlag( FLAGS_input );
@@ -37,6 +37,9 @@
 #include <geode/geosciences_io/model/common.hpp>
 
 #include <geode/inspector/brep_inspector.hpp>
+#include <geode/inspector/inspection_threads.hpp>
+
+#include "inspection_flags.hpp"
 
 ABSL_FLAG( std::string, input, "/path/my/model.og_istrm", "Input model" );
 
@@ -44,8 +47,11 @@ void inspect_implicit_structural_model(
     const geode::ImplicitStructuralModel& model )
 {
     const geode::BRepInspector model_inspector{ model };
-    auto result = model_inspector.inspect_brep();
+    start_trace();
+    const auto result = model_inspector.inspect_brep( inspection_options() );
+    save_trace();
     geode::Logger::info( result.string() );
+    report_profile( result.profile );
 }
 
 int main( int argc, char* argv[] )
@@ -57,8 +63,9 @@ int main( int argc, char* argv[] )
             "Sample usage:\n", argv[0],
             " --input my_implicit_structural_model.og_istrm\n",
             "Default behavior tests all available criteria, to disable one "
-            "use --noXXX, e.g. --nocomponent_linking" ) );
+            "use --noXXX, e.g. --nointersections" ) );
         absl::ParseCommandLine( argc, argv );
+        geode::set_inspection_nb_threads( absl::GetFlag( FLAGS_threads ) );
 
         geode::GeosciencesIOModelLibrary::initialize();
         const auto filename = absl::GetFlag( FLAGS_input );
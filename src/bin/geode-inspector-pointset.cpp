@@ -37,9 +37,14 @@
 
 #include <geode/io/mesh/common.hpp>
 
+#include <geode/inspector/inspection_threads.hpp>
 #include <geode/inspector/pointset_inspector.hpp>
 
 ABSL_FLAG( std::string, input, "/path/my/pointset.og_pts3d", "Input pointset" );
+ABSL_FLAG( geode::index_t,
+    threads,
+    0,
+    "Number of inspection threads (0 for the default thread pool)" );
 
 template < geode::index_t dimension >
 void inspect_point_set( const geode::PointSet< dimension >& pointset )
@@ -58,6 +63,7 @@ int main( int argc, char* argv[] )
             "PointSet inspector from Geode-solutions.\n", "Sample usage:\n",
             argv[0], " --input my_pointset.og_pts3d\n" ) );
         absl::ParseCommandLine( argc, argv );
+        geode::set_inspection_nb_threads( absl::GetFlag( FLAGS_threads ) );
 
         geode::IOMeshLibrary::initialize();
         const auto filename = absl::GetFlag( FLAGS_input );
@@ -36,16 +36,23 @@
 
 #include <geode/io/model/common.hpp>
 
+#include <geode/inspector/inspection_threads.hpp>
 #include <geode/inspector/section_inspector.hpp>
 
+#include "inspection_flags.hpp"
+
 ABSL_FLAG( std::string, input, "/path/my/model.og_sctn", "Input model" );
 
 void inspect_section( const geode::Section& section )
 {
     const geode::SectionInspector section_inspector{ section };
 
-    const auto result = section_inspector.inspect_section();
+    start_trace();
+    const auto result =
+        section_inspector.inspect_section( inspection_options() );
+    save_trace();
     geode::Logger::info( result.string() );
+    report_profile( result.profile );
 }
 
 int main( int argc, char* argv[] )
@@ -56,8 +63,9 @@ int main( int argc, char* argv[] )
             absl::StrCat( "Section inspector from Geode-solutions.\n",
                 "Sample usage:\n", argv[0], " --input my_section.og_sctn\n",
                 "Default behavior tests all available criteria, to disable one "
-                "use --noXXX, e.g. --nocomponent_linking" ) );
+                "use --noXXX, e.g. --nointersections" ) );
         absl::ParseCommandLine( argc, argv );
+        geode::set_inspection_nb_threads( absl::GetFlag( FLAGS_threads ) );
 
         geode::IOModelLibrary::initialize();
         const auto filename = absl::GetFlag( FLAGS_input );
@@ -43,16 +43,22 @@
 
 #include <geode/io/mesh/common.hpp>
 
+#include <geode/inspector/inspection_threads.hpp>
 #include <geode/inspector/solid_inspector.hpp>
 
+#include "inspection_flags.hpp"
+
 ABSL_FLAG( std::string, input, "/path/my/solid.og_tso3d", "Input solid" );
 
 template < geode::index_t dimension >
 void inspect_solid( const geode::SolidMesh< dimension >& solid )
 {
     const geode::SolidMeshInspector< dimension > inspector{ solid };
-    const auto result = inspector.inspect_solid();
+    start_trace();
+    const auto result = inspector.inspect_solid( inspection_options() );
+    save_trace();
     geode::Logger::info( result.string() );
+    report_profile( result.profile );
 }
 
 int main( int argc, char* argv[] )
@@ -65,6 +71,7 @@ int main( int argc, char* argv[] )
                 "Default behavior test all available criteria, to disable one "
                 "use --noXXX, e.g. --noadjacency" ) );
         absl::ParseCommandLine( argc, argv );
+        geode::set_inspection_nb_threads( absl::GetFlag( FLAGS_threads ) );
 
         geode::IOMeshLibrary::initialize();
         const auto filename = absl::GetFlag( FLAGS_input );
@@ -44,12 +44,17 @@
 #include <geode/io/mesh/common.hpp>
 
 #include <geode/inspector/criterion/intersections/surface_curve_intersections.hpp>
+#include <geode/inspector/inspection_threads.hpp>
 
 ABSL_FLAG( std::string,
     surface,
     "/path/my/surface.og_tsf3d",
     "Input triangulated surface" );
 ABSL_FLAG( std::string, curve, "/path/my/curve.og_edc3d", "Input curve" );
+ABSL_FLAG( geode::index_t,
+    threads,
+    0,
+    "Number of inspection threads (0 for the default thread pool)" );
 
 template < geode::index_t dimension >
 void inspect_surface_curve(
@@ -71,6 +76,7 @@ int main( int argc, char* argv[] )
             "Sample usage:\n", argv[0],
             " --surface my_surface.og_tsf3d --curve my_curve.og_edc3d\n" ) );
         absl::ParseCommandLine( argc, argv );
+        geode::set_inspection_nb_threads( absl::GetFlag( FLAGS_threads ) );
 
         geode::IOMeshLibrary::initialize();
         const auto filename_surf = absl::GetFlag( FLAGS_surface );
@@ -41,16 +41,22 @@
 
 #include <geode/io/mesh/common.hpp>
 
+#include <geode/inspector/inspection_threads.hpp>
 #include <geode/inspector/surface_inspector.hpp>
 
+#include "inspection_flags.hpp"
+
 ABSL_FLAG( std::string, input, "/path/my/surface.og_tsf3d", "Input surface" );
 
 template < geode::index_t dimension >
 void inspect_surface( const geode::SurfaceMesh< dimension >& surface )
 {
     const geode::SurfaceMeshInspector< dimension > inspector{ surface };
-    const auto result = inspector.inspect_surface();
+    start_trace();
+    const auto result = inspector.inspect_surface( inspection_options() );
+    save_trace();
     geode::Logger::info( result.string() );
+    report_profile( result.profile );
 }
 
 int main( int argc, char* argv[] )
@@ -63,6 +69,7 @@ int main( int argc, char* argv[] )
                 "Default behavior test all available criteria, to disable one "
                 "use --noXXX, e.g. --noadjacency" ) );
         absl::ParseCommandLine( argc, argv );
+        geode::set_inspection_nb_threads( absl::GetFlag( FLAGS_threads ) );
 
         geode::IOMeshLibrary::initialize();
         const auto filename = absl::GetFlag( FLAGS_input );
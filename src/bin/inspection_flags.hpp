@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#pragma once
+
+#include <fstream>
+#include <string>
+
+#include <absl/flags/flag.h>
+#include <absl/strings/str_cat.h>
+
+#include <geode/basic/assert.hpp>
+#include <geode/basic/logger.hpp>
+#include <geode/basic/uuid.hpp>
+
+#include <geode/inspector/inspection_options.hpp>
+#include <geode/inspector/inspection_profile.hpp>
+#include <geode/inspector/inspection_trace.hpp>
+
+/*!
+ * Flags and helpers shared by the inspector binaries. Each binary is a single
+ * translation unit including this file once.
+ */
+
+ABSL_FLAG( bool, adjacency, true, "Toggle adjacency criterion" );
+ABSL_FLAG( bool, colocation, true, "Toggle colocation criterion" );
+ABSL_FLAG( bool, degeneration, true, "Toggle degeneration criterion" );
+ABSL_FLAG( bool, intersections, true, "Toggle intersections criterion" );
+ABSL_FLAG( bool, manifold, true, "Toggle manifold criterion" );
+ABSL_FLAG( bool, negative_elements, true, "Toggle negative element criterion" );
+ABSL_FLAG( bool, topology, true, "Toggle topology criterion" );
+ABSL_FLAG( geode::index_t,
+    threads,
+    0,
+    "Number of inspection threads (0 for the default thread pool)" );
+ABSL_FLAG( bool,
+    profile,
+    false,
+    "Run the criteria one after the other and log their time and memory" );
+ABSL_FLAG( std::string,
+    profile_csv,
+    "",
+    "Output CSV file of the criteria profile (enables --profile)" );
+ABSL_FLAG( std::string,
+    trace,
+    "",
+    "Output Chrome trace JSON file of the inspection tasks" );
+ABSL_FLAG( bool, progress, false, "Log the progress of the inspection" );
+
+void log_progress( const geode::InspectionProgress& progress )
+{
+    geode::Logger::info( "[", progress.criterion, "] ",
+        progress.component
+            ? absl::StrCat( "component ", progress.component->string(), ": " )
+            : "",
+        progress.nb_processed, "/", progress.nb_elements, " elements" );
+}
+
+/*!
+ * Criteria which do not apply to the inspected mesh or model are ignored.
+ */
+geode::InspectionOptions inspection_options()
+{
+    geode::InspectionOptions options;
+    options.set_enabled( geode::InspectionCriterion::adjacency,
+        absl::GetFlag( FLAGS_adjacency ) );
+    options.set_enabled( geode::InspectionCriterion::colocation,
+        absl::GetFlag( FLAGS_colocation ) );
+    options.set_enabled( geode::InspectionCriterion::degeneration,
+        absl::GetFlag( FLAGS_degeneration ) );
+    options.set_enabled( geode::InspectionCriterion::intersections,
+        absl::GetFlag( FLAGS_intersections ) );
+    options.set_enabled( geode::InspectionCriterion::manifold,
+        absl::GetFlag( FLAGS_manifold ) );
+    options.set_enabled( geode::InspectionCriterion::negative_elements,
+        absl::GetFlag( FLAGS_negative_elements ) );
+    options.set_enabled( geode::InspectionCriterion::topology,
+        absl::GetFlag( FLAGS_topology ) );
+    options.set_profiled( absl::GetFlag( FLAGS_profile )
+                          || !absl::GetFlag( FLAGS_profile_csv ).empty() );
+    if( absl::GetFlag( FLAGS_progress ) )
+    {
+        options.set_progress_callback( log_progress );
+    }
+    return options;
+}
+
+void report_profile( const geode::InspectionProfile& profile )
+{
+    if( profile.empty() )
+    {
+        return;
+    }
+    geode::Logger::info( profile.string() );
+    const auto csv_filename = absl::GetFlag( FLAGS_profile_csv );
+    if( csv_filename.empty() )
+    {
+        return;
+    }
+    std::ofstream csv_file{ csv_filename };
+    OPENGEODE_EXCEPTION( csv_file.good(),
+        "[report_profile] Cannot open file ", csv_filename );
+    csv_file << profile.csv();
+}
+
+void start_trace()
+{
+    if( !absl::GetFlag( FLAGS_trace ).empty() )
+    {
+        geode::start_inspection_trace();
+    }
+}
+
+void save_trace()
+{
+    const auto trace_filename = absl::GetFlag( FLAGS_trace );
+    if( trace_filename.empty() )
+    {
+        return;
+    }
+    std::ofstream trace_file{ trace_filename };
+    OPENGEODE_EXCEPTION( trace_file.good(),
+        "[save_trace] Cannot open file ", trace_filename );
+    trace_file << geode::stop_inspection_trace();
+}
@@ -23,10 +23,303 @@
 
 #include <geode/inspector/brep_inspector.hpp>
 
-#include <async++.h>
+#include <absl/algorithm/container.h>
 
 #include <geode/model/representation/core/brep.hpp>
 
+#include <geode/inspector/internal/criteria_runner.hpp>
+#include <geode/inspector/internal/inspected_components.hpp>
+#include <geode/inspector/internal/inspection_scheduler.hpp>
+#include <geode/inspector/internal/inspection_stop.hpp>
+#include <geode/inspector/internal/parallel.hpp>
+
+namespace
+{
+    class AffectedRegion
+    {
+    public:
+        AffectedRegion( const geode::BRep& brep,
+            absl::Span< const geode::uuid > modified_components,
+            absl::Span< const geode::index_t > previous_unique_vertices )
+            : components_{ modified_components },
+              unique_vertices_{ geode::internal::components_unique_vertices(
+                  brep, modified_components, previous_unique_vertices ) },
+              nb_unique_vertices_{ brep.nb_unique_vertices() }
+        {
+        }
+
+        [[nodiscard]] bool contains_component(
+            const geode::uuid& component ) const
+        {
+            return components_.contains( component );
+        }
+
+        /*!
+         * Unique vertices removed from the BRep are contained, so that their
+         * previous issues are dropped.
+         */
+        [[nodiscard]] bool contains_unique_vertex(
+            geode::index_t unique_vertex ) const
+        {
+            return unique_vertex >= nb_unique_vertices_
+                   || absl::c_binary_search( unique_vertices_, unique_vertex );
+        }
+
+        [[nodiscard]] bool contains_unique_vertices(
+            absl::Span< const geode::index_t > unique_vertices ) const
+        {
+            return absl::c_any_of( unique_vertices,
+                       [this]( geode::index_t unique_vertex ) {
+                           return unique_vertex >= nb_unique_vertices_;
+                       } )
+                   || absl::c_all_of( unique_vertices,
+                       [this]( geode::index_t unique_vertex ) {
+                           return contains_unique_vertex( unique_vertex );
+                       } );
+        }
+
+    private:
+        geode::internal::InspectedComponents components_;
+        std::vector< geode::index_t > unique_vertices_;
+        geode::index_t nb_unique_vertices_;
+    };
+
+    template < typename IssueType >
+    void update_issues( geode::InspectionIssuesMap< IssueType >& previous,
+        geode::InspectionIssuesMap< IssueType > current,
+        const AffectedRegion& region )
+    {
+        previous.remove_issues_if( [&region]( const geode::uuid& component ) {
+            return region.contains_component( component );
+        } );
+        previous.add_issues( std::move( current ) );
+    }
+
+    void update_issues( geode::InspectionIssues< geode::uuid >& previous,
+        geode::InspectionIssues< geode::uuid > current,
+        const AffectedRegion& region )
+    {
+        previous.remove_issues_if( [&region]( const geode::uuid& component ) {
+            return region.contains_component( component );
+        } );
+        previous.add_issues( std::move( current ) );
+    }
+
+    void update_issues( geode::InspectionIssues< geode::index_t >& previous,
+        geode::InspectionIssues< geode::index_t > current,
+        const AffectedRegion& region )
+    {
+        previous.remove_issues_if( [&region]( geode::index_t unique_vertex ) {
+            return region.contains_unique_vertex( unique_vertex );
+        } );
+        previous.add_issues( std::move( current ) );
+    }
+
+    void update_meshes( geode::BRepMeshesInspectionResult& previous,
+        geode::BRepMeshesInspectionResult current,
+        const AffectedRegion& region )
+    {
+        previous.unique_vertices_colocation =
+            std::move( current.unique_vertices_colocation );
+        update_issues( previous.meshes_colocation.colocated_points_groups,
+            std::move( current.meshes_colocation.colocated_points_groups ),
+            region );
+        auto& adjacencies = previous.meshes_adjacencies;
+        update_issues( adjacencies.surfaces_edges_with_wrong_adjacencies,
+            std::move( current.meshes_adjacencies
+                           .surfaces_edges_with_wrong_adjacencies ),
+            region );
+        update_issues( adjacencies.blocks_facets_with_wrong_adjacencies,
+            std::move( current.meshes_adjacencies
+                           .blocks_facets_with_wrong_adjacencies ),
+            region );
+        auto& degenerations = previous.meshes_degenerations;
+        update_issues( degenerations.degenerated_edges,
+            std::move( current.meshes_degenerations.degenerated_edges ),
+            region );
+        update_issues( degenerations.degenerated_polygons,
+            std::move( current.meshes_degenerations.degenerated_polygons ),
+            region );
+        update_issues( degenerations.degenerated_polyhedra,
+            std::move( current.meshes_degenerations.degenerated_polyhedra ),
+            region );
+        auto& intersections = previous.meshes_intersections;
+        intersections.elements_intersections.remove_issues_if(
+            [&region]( const std::pair< geode::ComponentMeshElement,
+                geode::ComponentMeshElement >& polygons ) {
+                return region.contains_component(
+                           polygons.first.component_id.id() )
+                       || region.contains_component(
+                           polygons.second.component_id.id() );
+            } );
+        intersections.elements_intersections.add_issues(
+            std::move( current.meshes_intersections.elements_intersections ) );
+        auto& non_manifolds = previous.meshes_non_manifolds;
+        auto& current_non_manifolds = current.meshes_non_manifolds;
+        update_issues( non_manifolds.meshes_non_manifold_vertices,
+            std::move( current_non_manifolds.meshes_non_manifold_vertices ),
+            region );
+        update_issues( non_manifolds.meshes_non_manifold_edges,
+            std::move( current_non_manifolds.meshes_non_manifold_edges ),
+            region );
+        update_issues( non_manifolds.meshes_non_manifold_facets,
+            std::move( current_non_manifolds.meshes_non_manifold_facets ),
+            region );
+        non_manifolds.brep_non_manifold_edges.remove_issues_if(
+            [&region]( const geode::BRepNonManifoldEdge& edge ) {
+                return region.contains_unique_vertices( edge.edge );
+            } );
+        non_manifolds.brep_non_manifold_edges.add_issues(
+            std::move( current_non_manifolds.brep_non_manifold_edges ) );
+        non_manifolds.brep_non_manifold_facets.remove_issues_if(
+            [&region]( const geode::BRepNonManifoldFacet& facet ) {
+                return region.contains_unique_vertices( facet.facet );
+            } );
+        non_manifolds.brep_non_manifold_facets.add_issues(
+            std::move( current_non_manifolds.brep_non_manifold_facets ) );
+        update_issues( previous.meshes_negative_elements.negative_polyhedra,
+            std::move( current.meshes_negative_elements.negative_polyhedra ),
+            region );
+    }
+
+    void update_corners( geode::BRepCornersTopologyInspectionResult& previous,
+        geode::BRepCornersTopologyInspectionResult current,
+        const AffectedRegion& region )
+    {
+        update_issues( previous.corners_not_meshed,
+            std::move( current.corners_not_meshed ), region );
+        update_issues( previous.corners_not_linked_to_a_unique_vertex,
+            std::move( current.corners_not_linked_to_a_unique_vertex ),
+            region );
+        update_issues( previous.unique_vertices_linked_to_multiple_corners,
+            std::move( current.unique_vertices_linked_to_multiple_corners ),
+            region );
+        update_issues(
+            previous.unique_vertices_linked_to_multiple_internals_corner,
+            std::move(
+                current.unique_vertices_linked_to_multiple_internals_corner ),
+            region );
+        update_issues(
+            previous.unique_vertices_linked_to_not_internal_nor_boundary_corner,
+            std::move( current
+                    .unique_vertices_linked_to_not_internal_nor_boundary_corner ),
+            region );
+        update_issues(
+            previous.unique_vertices_liked_to_not_boundary_line_corner,
+            std::move(
+                current.unique_vertices_liked_to_not_boundary_line_corner ),
+            region );
+    }
+
+    void update_lines( geode::BRepLinesTopologyInspectionResult& previous,
+        geode::BRepLinesTopologyInspectionResult current,
+        const AffectedRegion& region )
+    {
+        update_issues( previous.lines_not_meshed,
+            std::move( current.lines_not_meshed ), region );
+        update_issues( previous.lines_not_linked_to_a_unique_vertex,
+            std::move( current.lines_not_linked_to_a_unique_vertex ), region );
+        update_issues(
+            previous.unique_vertices_linked_to_not_internal_nor_boundary_line,
+            std::move( current
+                    .unique_vertices_linked_to_not_internal_nor_boundary_line ),
+            region );
+        update_issues(
+            previous.unique_vertices_linked_to_a_line_with_invalid_embeddings,
+            std::move( current
+                    .unique_vertices_linked_to_a_line_with_invalid_embeddings ),
+            region );
+        update_issues(
+            previous.unique_vertices_linked_to_a_single_and_invalid_line,
+            std::move(
+                current.unique_vertices_linked_to_a_single_and_invalid_line ),
+            region );
+        update_issues( previous
+                .unique_vertices_linked_to_several_lines_but_not_linked_to_a_corner,
+            std::move( current
+                    .unique_vertices_linked_to_several_lines_but_not_linked_to_a_corner ),
+            region );
+    }
+
+    void update_surfaces(
+        geode::BRepSurfacesTopologyInspectionResult& previous,
+        geode::BRepSurfacesTopologyInspectionResult current,
+        const AffectedRegion& region )
+    {
+        update_issues( previous.surfaces_not_meshed,
+            std::move( current.surfaces_not_meshed ), region );
+        update_issues( previous.surfaces_not_linked_to_a_unique_vertex,
+            std::move( current.surfaces_not_linked_to_a_unique_vertex ),
+            region );
+        update_issues(
+            previous.unique_vertices_linked_to_not_internal_nor_boundary_surface,
+            std::move( current
+                    .unique_vertices_linked_to_not_internal_nor_boundary_surface ),
+            region );
+        update_issues(
+            previous.unique_vertices_linked_to_a_surface_with_invalid_embbedings,
+            std::move( current
+                    .unique_vertices_linked_to_a_surface_with_invalid_embbedings ),
+            region );
+        update_issues(
+            previous.unique_vertices_linked_to_a_single_and_invalid_surface,
+            std::move(
+                current.unique_vertices_linked_to_a_single_and_invalid_surface ),
+            region );
+        update_issues(
+            previous.unique_vertices_linked_to_several_and_invalid_surfaces,
+            std::move(
+                current.unique_vertices_linked_to_several_and_invalid_surfaces ),
+            region );
+        update_issues( previous
+                .unique_vertices_linked_to_a_line_but_is_not_on_a_surface_border,
+            std::move( current
+                    .unique_vertices_linked_to_a_line_but_is_not_on_a_surface_border ),
+            region );
+    }
+
+    void update_blocks( geode::BRepBlocksTopologyInspectionResult& previous,
+        geode::BRepBlocksTopologyInspectionResult current,
+        const AffectedRegion& region )
+    {
+        update_issues( previous.blocks_not_meshed,
+            std::move( current.blocks_not_meshed ), region );
+        update_issues( previous.blocks_not_linked_to_a_unique_vertex,
+            std::move( current.blocks_not_linked_to_a_unique_vertex ), region );
+        update_issues(
+            previous.unique_vertices_part_of_two_blocks_and_no_boundary_surface,
+            std::move( current
+                    .unique_vertices_part_of_two_blocks_and_no_boundary_surface ),
+            region );
+        update_issues(
+            previous.unique_vertices_with_incorrect_block_cmvs_count,
+            std::move(
+                current.unique_vertices_with_incorrect_block_cmvs_count ),
+            region );
+    }
+
+    void update_topology( geode::BRepTopologyInspectionResult& previous,
+        geode::BRepTopologyInspectionResult current,
+        const AffectedRegion& region )
+    {
+        update_corners(
+            previous.corners, std::move( current.corners ), region );
+        update_lines( previous.lines, std::move( current.lines ), region );
+        update_surfaces(
+            previous.surfaces, std::move( current.surfaces ), region );
+        update_blocks( previous.blocks, std::move( current.blocks ), region );
+        update_issues( previous.unique_vertices_not_linked_to_any_component,
+            std::move( current.unique_vertices_not_linked_to_any_component ),
+            region );
+        update_issues( previous.unique_vertices_linked_to_inexistant_cmv,
+            std::move( current.unique_vertices_linked_to_inexistant_cmv ),
+            region );
+        update_issues( previous.unique_vertices_nonbijectively_linked_to_cmv,
+            std::move( current.unique_vertices_nonbijectively_linked_to_cmv ),
+            region );
+    }
+} // namespace
+
 namespace geode
 {
     index_t BRepInspectionResult::nb_issues() const
@@ -47,21 +340,131 @@ namespace geode
     BRepInspector::BRepInspector( const BRep& brep )
         : AddInspectors< BRep, BRepMeshesInspector, BRepTopologyInspector >{
               brep
-          }
+          },
+          brep_( brep )
     {
     }
 
     BRepInspectionResult BRepInspector::inspect_brep() const
+    {
+        return inspect_brep( InspectionOptions{} );
+    }
+
+    bool BRepInspector::is_valid() const
+    {
+        return is_valid( InspectionOptions{} );
+    }
+
+    bool BRepInspector::is_valid( const InspectionOptions& options ) const
+    {
+        const internal::InspectionStop stop{ options };
+        const internal::InspectionStopScope scope{ stop };
+        const BRepInspectionContext context{ brep_ };
+        return internal::parallel_all_of(
+            [this] {
+                return brep_topology_is_valid();
+            },
+            [this] {
+                return !model_has_unique_vertices_linked_to_different_points();
+            },
+            [this, &context] {
+                return !model_has_wrong_adjacencies( context );
+            },
+            [this] {
+                return !model_has_degenerated_elements();
+            },
+            [this] {
+                return !model_has_negative_elements();
+            },
+            [this, &context] {
+                return !model_has_non_manifold_elements( context );
+            },
+            [this] {
+                return !model_has_colocated_unique_vertices()
+                       && !model_has_colocated_points();
+            },
+            [this] {
+                return !model_has_intersecting_surfaces();
+            } );
+    }
+
+    BRepInspectionResult BRepInspector::inspect_brep(
+        const InspectionOptions& options ) const
+    {
+        const internal::InspectionStop stop{ options };
+        const internal::InspectionStopScope scope{ stop };
+        const internal::InspectionProgressScope progress{ options };
+        internal::CriteriaRunner runner{ options };
+        BRepInspectionResult result;
+        runner.run(
+            internal::unprofiled_task( [&result, &options, this] {
+                result.meshes = inspect_brep_meshes( options );
+            } ),
+            internal::criterion_task(
+                options.is_enabled( InspectionCriterion::topology ),
+                "topology", brep_.nb_unique_vertices(),
+                [&result, this] {
+                    result.topology = inspect_brep_topology();
+                } ) );
+        result.status = result.meshes.status == InspectionStatus::truncated
+                            ? InspectionStatus::truncated
+                            : stop.status();
+        result.profile = result.meshes.profile;
+        result.profile.add_profile( runner.profile() );
+        return result;
+    }
+
+    BRepInspectionResult BRepInspector::inspect_brep(
+        absl::Span< const uuid > modified_components ) const
+    {
+        return inspect_brep(
+            modified_components, absl::Span< const index_t >{} );
+    }
+
+    BRepInspectionResult BRepInspector::inspect_brep(
+        absl::Span< const uuid > modified_components,
+        absl::Span< const index_t > unique_vertices ) const
     {
         BRepInspectionResult result;
-        async::parallel_invoke(
-            [&result, this] {
-                result.meshes = inspect_brep_meshes();
+        internal::parallel_invoke(
+            [&result, &modified_components, &unique_vertices, this] {
+                result.meshes =
+                    inspect_brep_meshes( modified_components, unique_vertices );
             },
-            [&result, this] {
-                result.topology = inspect_brep_topology();
+            [&result, &modified_components, &unique_vertices, this] {
+                result.topology = inspect_brep_topology(
+                    modified_components, unique_vertices );
             } );
         return result;
     }
 
+    BRepInspectionResult BRepInspector::inspect_brep(
+        absl::Span< const uuid > modified_components,
+        BRepInspectionResult previous_result ) const
+    {
+        return inspect_brep( modified_components, absl::Span< const index_t >{},
+            std::move( previous_result ) );
+    }
+
+    BRepInspectionResult BRepInspector::inspect_brep(
+        absl::Span< const uuid > modified_components,
+        absl::Span< const index_t > previous_unique_vertices,
+        BRepInspectionResult previous_result ) const
+    {
+        auto current_result =
+            inspect_brep( modified_components, previous_unique_vertices );
+        const AffectedRegion region{ brep_, modified_components,
+            previous_unique_vertices };
+        update_meshes( previous_result.meshes,
+            std::move( current_result.meshes ), region );
+        update_topology( previous_result.topology,
+            std::move( current_result.topology ), region );
+        return previous_result;
+    }
+
+    std::vector< index_t > BRepInspector::components_unique_vertices(
+        absl::Span< const uuid > components ) const
+    {
+        return internal::components_unique_vertices( brep_, components );
+    }
 } // namespace geode
@@ -23,19 +23,103 @@
 
 #include <geode/inspector/criterion/adjacency/brep_meshes_adjacency.hpp>
 
+#include <mutex>
+
 #include <async++.h>
 
+#include <absl/algorithm/container.h>
+#include <absl/container/flat_hash_set.h>
+
 #include <geode/basic/logger.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 
 #include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
 
-#include <geode/model/helpers/component_mesh_polygons.hpp>
 #include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/surface.hpp>
 #include <geode/model/representation/core/brep.hpp>
 
 #include <geode/inspector/criterion/adjacency/solid_adjacency.hpp>
 #include <geode/inspector/criterion/internal/component_meshes_adjacency.hpp>
+#include <geode/inspector/internal/inspected_components.hpp>
+#include <geode/inspector/internal/parallel.hpp>
+
+namespace
+{
+    /*!
+     * Index of the model Surface polygons, keyed by their sorted unique
+     * vertices, so that each block border facet is matched with a single
+     * hash lookup. Built on the first lookup only: an inspection without
+     * any block border facet never pays for it.
+     */
+    class SurfacePolygonsIndex
+    {
+    public:
+        SurfacePolygonsIndex( const geode::BRep& brep,
+            const geode::BRepInspectionContext& context )
+            : brep_( brep ), context_( context )
+        {
+        }
+
+        [[nodiscard]] bool contains(
+            geode::PolygonVertices facet_unique_vertices ) const
+        {
+            std::call_once( built_, [this] { build(); } );
+            absl::c_sort( facet_unique_vertices );
+            return polygons_.contains( facet_unique_vertices );
+        }
+
+    private:
+        /*!
+         * Built serially: a worker waiting on parallel tasks inside
+         * std::call_once may run another task looking up a facet, which
+         * would re-enter the call_once and deadlock.
+         */
+        void build() const
+        {
+            for( const auto& surface : brep_.surfaces() )
+            {
+                const auto& mesh = surface.mesh();
+                const auto unique_vertices = context_.component_unique_vertices(
+                    surface.component_id() );
+                for( const auto polygon_id :
+                    geode::Range{ mesh.nb_polygons() } )
+                {
+                    auto key = polygon_key( unique_vertices, mesh, polygon_id );
+                    if( !key.empty() )
+                    {
+                        polygons_.emplace( std::move( key ) );
+                    }
+                }
+            }
+        }
+
+        [[nodiscard]] static geode::PolygonVertices polygon_key(
+            absl::Span< const geode::index_t > unique_vertices,
+            const geode::SurfaceMesh3D& mesh,
+            geode::index_t polygon_id )
+        {
+            geode::PolygonVertices key;
+            for( const auto vertex : mesh.polygon_vertices( polygon_id ) )
+            {
+                const auto unique_vertex = unique_vertices[vertex];
+                if( unique_vertex == geode::NO_ID )
+                {
+                    return {};
+                }
+                key.push_back( unique_vertex );
+            }
+            absl::c_sort( key );
+            return key;
+        }
+
+        const geode::BRep& brep_;
+        const geode::BRepInspectionContext& context_;
+        mutable std::once_flag built_;
+        mutable absl::flat_hash_set< geode::PolygonVertices > polygons_;
+    };
+} // namespace
 
 namespace geode
 {
@@ -79,64 +163,192 @@ namespace geode
         {
         }
 
+        BRepMeshesAdjacencyInspectionResult inspect_brep_meshes_adjacencies(
+            const internal::InspectedComponents& components ) const
+        {
+            const BRepInspectionContext context{ model() };
+            return inspect_brep_meshes_adjacencies( context, components );
+        }
+
+        BRepMeshesAdjacencyInspectionResult inspect_brep_meshes_adjacencies(
+            const BRepInspectionContext& context,
+            const internal::InspectedComponents& components ) const
+        {
+            BRepMeshesAdjacencyInspectionResult result;
+            internal::parallel_invoke(
+                [&result, &components, this] {
+                    add_surfaces_edges_with_wrong_adjacencies( components,
+                        result.surfaces_edges_with_wrong_adjacencies );
+                },
+                [&result, &context, &components, this] {
+                    add_blocks_facets_with_wrong_adjacencies( context,
+                        components,
+                        result.blocks_facets_with_wrong_adjacencies );
+                } );
+            return result;
+        }
+
         void add_blocks_facets_with_wrong_adjacencies(
+            const BRepInspectionContext& context,
+            const internal::InspectedComponents& components,
             InspectionIssuesMap< PolyhedronFacet >&
                 components_wrong_adjacencies ) const
         {
-            for( const auto& block : model().blocks() )
+            const SurfacePolygonsIndex surface_polygons{ model(), context };
+            const auto blocks =
+                internal::inspected_components_by_decreasing_size(
+                    model().blocks(), components );
+            std::vector< InspectionIssues< PolyhedronFacet > > blocks_issues(
+                blocks.size() );
+            internal::parallel_for_components( blocks, "Block adjacency",
+                [&surface_polygons, &context, &blocks, &blocks_issues](
+                    std::size_t id ) {
+                    blocks_issues[id] = block_facets_with_wrong_adjacencies(
+                        surface_polygons, context, *blocks[id] );
+                } );
+            for( const auto id : Indices{ blocks } )
             {
-                const geode::SolidMeshAdjacency3D inspector{ block.mesh() };
-                auto wrong_adjacencies =
-                    inspector.polyhedron_facets_with_wrong_adjacency();
-                wrong_adjacencies.set_description(
-                    absl::StrCat( "Block with uuid ", block.id().string(),
-                        " polyhedron facets adjacencies issues" ) );
-                const auto& mesh = block.mesh();
-                for( const auto polyhedron_id : Range{ mesh.nb_polyhedra() } )
-                {
+                components_wrong_adjacencies.add_issues_to_map(
+                    blocks[id]->id(), std::move( blocks_issues[id] ) );
+            }
+        }
+
+        bool model_has_wrong_adjacencies() const
+        {
+            const BRepInspectionContext context{ model() };
+            return model_has_wrong_adjacencies( context );
+        }
+
+        bool model_has_wrong_adjacencies(
+            const BRepInspectionContext& context ) const
+        {
+            if( has_surfaces_edges_with_wrong_adjacencies() )
+            {
+                return true;
+            }
+            const auto blocks =
+                internal::inspected_components_by_decreasing_size(
+                    model().blocks(), internal::InspectedComponents{} );
+            if( blocks.empty() )
+            {
+                return false;
+            }
+            const SurfacePolygonsIndex surface_polygons{ model(), context };
+            return internal::parallel_any_of_components( blocks,
+                "Block adjacency",
+                [&surface_polygons, &context, &blocks]( std::size_t id ) {
+                    return block_has_wrong_adjacencies(
+                        surface_polygons, context, *blocks[id] );
+                } );
+        }
+
+    private:
+        static InspectionIssues< PolyhedronFacet >
+            block_facets_with_wrong_adjacencies(
+                const SurfacePolygonsIndex& surface_polygons,
+                const BRepInspectionContext& context,
+                const Block3D& block )
+        {
+            const geode::SolidMeshAdjacency3D inspector{ block.mesh() };
+            auto wrong_adjacencies =
+                inspector.polyhedron_facets_with_wrong_adjacency();
+            wrong_adjacencies.set_description(
+                absl::StrCat( "Block with uuid ", block.id().string(),
+                    " polyhedron facets adjacencies issues" ) );
+            const auto& mesh = block.mesh();
+            const auto block_unique_vertices =
+                context.component_unique_vertices( block.component_id() );
+            internal::parallel_add_issues( mesh.nb_polyhedra(),
+                wrong_adjacencies,
+                [&surface_polygons, &mesh, &block_unique_vertices](
+                    index_t polyhedron_id,
+                    InspectionIssues< PolyhedronFacet >& issues ) {
                     for( const auto facet_id :
                         LRange{ mesh.nb_polyhedron_facets( polyhedron_id ) } )
                     {
                         const PolyhedronFacet polyhedron_facet{ polyhedron_id,
                             facet_id };
-                        if( !mesh.is_polyhedron_facet_on_border(
+                        if( border_facet_is_not_on_a_surface( surface_polygons,
+                                mesh, block_unique_vertices,
                                 polyhedron_facet ) )
                         {
-                            continue;
-                        }
-                        const auto is_on_surface =
-                            polyhedron_facet_is_on_a_surface(
-                                block, polyhedron_facet );
-                        if( is_on_surface.has_value()
-                            && !is_on_surface.value() )
-                        {
-                            wrong_adjacencies.add_issue( polyhedron_facet,
+                            issues.add_issue( polyhedron_facet,
                                 absl::StrCat( "Local facet ", facet_id,
                                     " of polyhedron ", polyhedron_id,
                                     " has no adjacencies but is not part of a "
                                     "model Surface." ) );
                         }
                     }
-                }
-                components_wrong_adjacencies.add_issues_to_map(
-                    block.id(), std::move( wrong_adjacencies ) );
+                } );
+            return wrong_adjacencies;
+        }
+
+        static bool block_has_wrong_adjacencies(
+            const SurfacePolygonsIndex& surface_polygons,
+            const BRepInspectionContext& context,
+            const Block3D& block )
+        {
+            const auto& mesh = block.mesh();
+            const geode::SolidMeshAdjacency3D inspector{ mesh };
+            if( inspector.mesh_has_wrong_adjacencies() )
+            {
+                return true;
+            }
+            const auto block_unique_vertices =
+                context.component_unique_vertices( block.component_id() );
+            return internal::parallel_any_of( mesh.nb_polyhedra(),
+                [&surface_polygons, &mesh, &block_unique_vertices](
+                    index_t polyhedron_id ) {
+                    for( const auto facet_id :
+                        LRange{ mesh.nb_polyhedron_facets( polyhedron_id ) } )
+                    {
+                        const PolyhedronFacet polyhedron_facet{ polyhedron_id,
+                            facet_id };
+                        if( border_facet_is_not_on_a_surface( surface_polygons,
+                                mesh, block_unique_vertices,
+                                polyhedron_facet ) )
+                        {
+                            return true;
+                        }
+                    }
+                    return false;
+                } );
+        }
+
+        static bool border_facet_is_not_on_a_surface(
+            const SurfacePolygonsIndex& surface_polygons,
+            const SolidMesh3D& mesh,
+            absl::Span< const index_t > block_unique_vertices,
+            const PolyhedronFacet& polyhedron_facet )
+        {
+            if( !mesh.is_polyhedron_facet_on_border( polyhedron_facet ) )
+            {
+                return false;
             }
+            const auto is_on_surface =
+                polyhedron_facet_is_on_a_surface( surface_polygons, mesh,
+                    block_unique_vertices, polyhedron_facet );
+            return is_on_surface.has_value() && !is_on_surface.value();
         }
 
-    private:
-        absl::optional< bool > polyhedron_facet_is_on_a_surface(
-            const Block3D& block,
-            const PolyhedronFacet& polyhedron_facet ) const
+        static absl::optional< bool > polyhedron_facet_is_on_a_surface(
+            const SurfacePolygonsIndex& surface_polygons,
+            const SolidMesh3D& mesh,
+            absl::Span< const index_t > block_unique_vertices,
+            const PolyhedronFacet& polyhedron_facet )
         {
-            const auto facet_unique_vertices =
-                polygon_unique_vertices( model(), block, polyhedron_facet );
-            if( absl::c_contains( facet_unique_vertices, geode::NO_ID ) )
+            PolygonVertices facet_unique_vertices;
+            for( const auto vertex :
+                mesh.polyhedron_facet_vertices( polyhedron_facet ) )
             {
-                return std::nullopt;
+                const auto unique_vertex = block_unique_vertices[vertex];
+                if( unique_vertex == NO_ID )
+                {
+                    return std::nullopt;
+                }
+                facet_unique_vertices.push_back( unique_vertex );
             }
-            return !detail::surface_component_mesh_polygons(
-                model(), facet_unique_vertices )
-                        .empty();
+            return surface_polygons.contains( facet_unique_vertices );
         }
     };
 
@@ -148,19 +360,37 @@ namespace geode
 
     BRepComponentMeshesAdjacency::~BRepComponentMeshesAdjacency() = default;
 
+    bool BRepComponentMeshesAdjacency::model_has_wrong_adjacencies() const
+    {
+        return impl_->model_has_wrong_adjacencies();
+    }
+
+    bool BRepComponentMeshesAdjacency::model_has_wrong_adjacencies(
+        const BRepInspectionContext& context ) const
+    {
+        return impl_->model_has_wrong_adjacencies( context );
+    }
+
     BRepMeshesAdjacencyInspectionResult
         BRepComponentMeshesAdjacency::inspect_brep_meshes_adjacencies() const
     {
-        BRepMeshesAdjacencyInspectionResult result;
-        async::parallel_invoke(
-            [&result, this] {
-                impl_->add_surfaces_edges_with_wrong_adjacencies(
-                    result.surfaces_edges_with_wrong_adjacencies );
-            },
-            [&result, this] {
-                impl_->add_blocks_facets_with_wrong_adjacencies(
-                    result.blocks_facets_with_wrong_adjacencies );
-            } );
-        return result;
+        return impl_->inspect_brep_meshes_adjacencies(
+            internal::InspectedComponents{} );
+    }
+
+    BRepMeshesAdjacencyInspectionResult
+        BRepComponentMeshesAdjacency::inspect_brep_meshes_adjacencies(
+            absl::Span< const uuid > components ) const
+    {
+        return impl_->inspect_brep_meshes_adjacencies(
+            internal::InspectedComponents{ components } );
+    }
+
+    BRepMeshesAdjacencyInspectionResult
+        BRepComponentMeshesAdjacency::inspect_brep_meshes_adjacencies(
+            const BRepInspectionContext& context ) const
+    {
+        return impl_->inspect_brep_meshes_adjacencies(
+            context, internal::InspectedComponents{} );
     }
 } // namespace geode
@@ -29,6 +29,7 @@
 #include <geode/model/representation/core/section.hpp>
 
 #include <geode/inspector/criterion/internal/component_meshes_adjacency.hpp>
+#include <geode/inspector/internal/inspected_components.hpp>
 
 namespace geode
 {
@@ -70,12 +71,18 @@ namespace geode
     SectionComponentMeshesAdjacency::~SectionComponentMeshesAdjacency() =
         default;
 
+    bool SectionComponentMeshesAdjacency::model_has_wrong_adjacencies() const
+    {
+        return impl_->has_surfaces_edges_with_wrong_adjacencies();
+    }
+
     SectionMeshesAdjacencyInspectionResult
         SectionComponentMeshesAdjacency::inspect_section_meshes_adjacencies()
             const
     {
         SectionMeshesAdjacencyInspectionResult result;
         impl_->add_surfaces_edges_with_wrong_adjacencies(
+            internal::InspectedComponents{},
             result.surfaces_edges_with_wrong_adjacencies );
         return result;
     }
@@ -23,12 +23,177 @@
 
 #include <geode/inspector/criterion/adjacency/solid_adjacency.hpp>
 
+#include <cstdint>
+
+#include <absl/algorithm/container.h>
+#include <absl/types/span.h>
+
 #include <geode/basic/pimpl_impl.hpp>
 #include <geode/basic/uuid.hpp>
 
-#include <geode/mesh/core/detail/vertex_cycle.hpp>
 #include <geode/mesh/core/solid_mesh.hpp>
 
+#include <geode/inspector/internal/parallel.hpp>
+
+namespace
+{
+    /*!
+     * Writes in canonical_cycle the vertex cycle starting from its smallest
+     * vertex and going in the direction of its smallest neighbor, so that
+     * every rotation and both orientations of a cycle get the same canonical
+     * cycle. Returns true if the cycle had to be reversed.
+     */
+    bool canonical_facet_cycle(
+        const geode::PolyhedronFacetVertices& facet_vertices,
+        absl::Span< geode::index_t > canonical_cycle )
+    {
+        const auto nb_vertices =
+            static_cast< geode::index_t >( facet_vertices.size() );
+        const auto min_position = static_cast< geode::index_t >(
+            std::distance( facet_vertices.begin(),
+                absl::c_min_element( facet_vertices ) ) );
+        bool reversed{ false };
+        for( const auto shift : geode::Range{ 1, nb_vertices } )
+        {
+            const auto next =
+                facet_vertices[( min_position + shift ) % nb_vertices];
+            const auto previous = facet_vertices[( min_position + nb_vertices
+                                                     - shift )
+                                                 % nb_vertices];
+            if( next != previous )
+            {
+                reversed = previous < next;
+                break;
+            }
+        }
+        for( const auto shift : geode::Range{ nb_vertices } )
+        {
+            canonical_cycle[shift] =
+                reversed
+                    ? facet_vertices[( min_position + nb_vertices - shift )
+                                     % nb_vertices]
+                    : facet_vertices[( min_position + shift ) % nb_vertices];
+        }
+        return reversed;
+    }
+
+    /*!
+     * Canonical vertex cycle of a single polyhedron facet, used when only a
+     * few facets are compared.
+     */
+    struct CanonicalFacet
+    {
+        geode::PolyhedronFacetVertices cycle;
+        bool reversed{ false };
+    };
+
+    CanonicalFacet canonical_facet(
+        const geode::PolyhedronFacetVertices& facet_vertices )
+    {
+        CanonicalFacet canonical;
+        canonical.cycle.resize( facet_vertices.size() );
+        canonical.reversed = canonical_facet_cycle(
+            facet_vertices, absl::MakeSpan( canonical.cycle ) );
+        return canonical;
+    }
+
+    /*!
+     * Canonical vertex cycles of all the polyhedron facets of a SolidMesh,
+     * computed in a single pass and stored in flat arrays indexed by global
+     * facet index. Used when every facet of the mesh is checked.
+     */
+    template < geode::index_t dimension >
+    class SolidFacetKeys
+    {
+    public:
+        explicit SolidFacetKeys( const geode::SolidMesh< dimension >& mesh )
+            : polyhedron_facets_offsets_( mesh.nb_polyhedra() + 1, 0 )
+        {
+            std::vector< geode::index_t > nb_facet_vertices;
+            for( const auto polyhedron_id :
+                geode::Range{ mesh.nb_polyhedra() } )
+            {
+                const auto nb_facets =
+                    mesh.nb_polyhedron_facets( polyhedron_id );
+                polyhedron_facets_offsets_[polyhedron_id + 1] =
+                    polyhedron_facets_offsets_[polyhedron_id] + nb_facets;
+                for( const auto facet_id : geode::LRange{ nb_facets } )
+                {
+                    nb_facet_vertices.push_back(
+                        mesh.nb_polyhedron_facet_vertices(
+                            { polyhedron_id, facet_id } ) );
+                }
+            }
+            cycles_offsets_.resize( nb_facet_vertices.size() + 1, 0 );
+            for( const auto facet_index :
+                geode::Indices{ nb_facet_vertices } )
+            {
+                cycles_offsets_[facet_index + 1] =
+                    cycles_offsets_[facet_index]
+                    + nb_facet_vertices[facet_index];
+            }
+            cycles_.resize( cycles_offsets_.back() );
+            reversed_.resize( nb_facet_vertices.size() );
+            geode::internal::parallel_for_chunks( mesh.nb_polyhedra(),
+                [&mesh, this]( geode::index_t /*chunk_id*/,
+                    geode::index_t begin, geode::index_t end ) {
+                    for( const auto polyhedron_id : geode::Range{ begin, end } )
+                    {
+                        for( const auto facet_id : geode::LRange{
+                                 mesh.nb_polyhedron_facets( polyhedron_id ) } )
+                        {
+                            const geode::PolyhedronFacet polyhedron_facet{
+                                polyhedron_id, facet_id
+                            };
+                            const auto facet_index = facet( polyhedron_facet );
+                            reversed_[facet_index] = canonical_facet_cycle(
+                                mesh.polyhedron_facet_vertices(
+                                    polyhedron_facet ),
+                                absl::MakeSpan(
+                                    cycles_.data()
+                                        + cycles_offsets_[facet_index],
+                                    cycles_offsets_[facet_index + 1]
+                                        - cycles_offsets_[facet_index] ) );
+                        }
+                    }
+                } );
+        }
+
+        [[nodiscard]] bool are_opposite(
+            const geode::PolyhedronFacet& polyhedron_facet0,
+            const geode::PolyhedronFacet& polyhedron_facet1 ) const
+        {
+            const auto facet0 = facet( polyhedron_facet0 );
+            const auto facet1 = facet( polyhedron_facet1 );
+            return reversed_[facet0] != reversed_[facet1]
+                   && cycle( facet0 ) == cycle( facet1 );
+        }
+
+    private:
+        [[nodiscard]] geode::index_t facet(
+            const geode::PolyhedronFacet& polyhedron_facet ) const
+        {
+            return polyhedron_facets_offsets_[polyhedron_facet.polyhedron_id]
+                   + polyhedron_facet.facet_id;
+        }
+
+        [[nodiscard]] absl::Span< const geode::index_t > cycle(
+            geode::index_t facet_index ) const
+        {
+            return absl::MakeConstSpan(
+                cycles_.data() + cycles_offsets_[facet_index],
+                cycles_offsets_[facet_index + 1]
+                    - cycles_offsets_[facet_index] );
+        }
+
+    private:
+        std::vector< geode::index_t > polyhedron_facets_offsets_;
+        std::vector< geode::index_t > cycles_offsets_;
+        std::vector< geode::index_t > cycles_;
+        std::vector< std::uint8_t > reversed_;
+    };
+} // namespace
+
 namespace geode
 {
     template < index_t dimension >
@@ -39,22 +204,23 @@ namespace geode
 
         bool mesh_has_wrong_adjacencies() const
         {
-            for( const auto polyhedron_id : Range{ mesh_.nb_polyhedra() } )
-            {
-                for( const auto facet_id :
-                    LRange{ mesh_.nb_polyhedron_facets( polyhedron_id ) } )
-                {
-                    const PolyhedronFacet polyhedron_facet{ polyhedron_id,
-                        facet_id };
-                    if( !mesh_.is_polyhedron_facet_on_border( polyhedron_facet )
-                        && !mesh_polyhedron_facet_has_right_adjacency(
-                            polyhedron_facet ) )
+            return internal::parallel_any_of( mesh_.nb_polyhedra(),
+                [this]( index_t polyhedron_id ) {
+                    for( const auto facet_id :
+                        LRange{ mesh_.nb_polyhedron_facets( polyhedron_id ) } )
                     {
-                        return true;
+                        const PolyhedronFacet polyhedron_facet{ polyhedron_id,
+                            facet_id };
+                        if( !mesh_.is_polyhedron_facet_on_border(
+                                polyhedron_facet )
+                            && !mesh_polyhedron_facet_has_right_adjacency(
+                                polyhedron_facet ) )
+                        {
+                            return true;
+                        }
                     }
-                }
-            }
-            return false;
+                    return false;
+                } );
         }
 
         InspectionIssues< PolyhedronFacet >
@@ -63,47 +229,78 @@ namespace geode
             InspectionIssues< PolyhedronFacet > wrong_adjacency_facets{
                 absl::StrCat( "Polyhedron facets with wrong adjacencies." )
             };
-            for( const auto polyhedron_id : Range{ mesh_.nb_polyhedra() } )
-            {
-                for( const auto facet_id :
-                    LRange{ mesh_.nb_polyhedron_facets( polyhedron_id ) } )
-                {
-                    const PolyhedronFacet polyhedron_facet{ polyhedron_id,
-                        facet_id };
-                    if( !mesh_.is_polyhedron_facet_on_border( polyhedron_facet )
-                        && !mesh_polyhedron_facet_has_right_adjacency(
-                            polyhedron_facet ) )
+            const SolidFacetKeys< dimension > facet_keys{ mesh_ };
+            internal::parallel_add_issues( mesh_.nb_polyhedra(),
+                wrong_adjacency_facets,
+                [this, &facet_keys]( index_t polyhedron_id,
+                    InspectionIssues< PolyhedronFacet >& polyhedron_issues ) {
+                    for( const auto facet_id :
+                        LRange{ mesh_.nb_polyhedron_facets( polyhedron_id ) } )
                     {
-                        wrong_adjacency_facets.add_issue( polyhedron_facet,
-                            absl::StrCat( "Local facet ", facet_id,
-                                " of polyhedron ", polyhedron_id,
-                                " has wrong adjacencies." ) );
+                        const PolyhedronFacet polyhedron_facet{ polyhedron_id,
+                            facet_id };
+                        if( !mesh_.is_polyhedron_facet_on_border(
+                                polyhedron_facet )
+                            && !mesh_polyhedron_facet_has_right_adjacency(
+                                facet_keys, polyhedron_facet ) )
+                        {
+                            polyhedron_issues.add_issue( polyhedron_facet,
+                                absl::StrCat( "Local facet ", facet_id,
+                                    " of polyhedron ", polyhedron_id,
+                                    " has wrong adjacencies." ) );
+                        }
                     }
-                }
-            }
+                } );
             return wrong_adjacency_facets;
         }
 
     private:
+        bool mesh_polyhedron_facet_has_right_adjacency(
+            const SolidFacetKeys< dimension >& facet_keys,
+            const PolyhedronFacet& polyhedron_facet ) const
+        {
+            const auto polyhedron_adj_id =
+                mesh_.polyhedron_adjacent( polyhedron_facet ).value();
+            for( const auto facet_id :
+                LRange{ mesh_.nb_polyhedron_facets( polyhedron_adj_id ) } )
+            {
+                const PolyhedronFacet adj_facet{ polyhedron_adj_id, facet_id };
+                if( mesh_.polyhedron_adjacent( adj_facet )
+                        == polyhedron_facet.polyhedron_id
+                    && facet_keys.are_opposite( polyhedron_facet, adj_facet ) )
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
         bool mesh_polyhedron_facet_has_right_adjacency(
             const PolyhedronFacet& polyhedron_facet ) const
         {
             const auto adjacent_polyhedron =
                 mesh_.polyhedron_adjacent( polyhedron_facet );
             const auto polyhedron_adj_id = adjacent_polyhedron.value();
-            const auto facet_vertices =
-                detail::OrientedVertexCycle< PolyhedronFacetVertices >(
-                    mesh_.polyhedron_facet_vertices( polyhedron_facet ) );
+            const auto facet = canonical_facet(
+                mesh_.polyhedron_facet_vertices( polyhedron_facet ) );
             for( const auto facet_id :
                 LRange{ mesh_.nb_polyhedron_facets( polyhedron_adj_id ) } )
             {
                 const PolyhedronFacet adj_facet{ polyhedron_adj_id, facet_id };
+                if( mesh_.polyhedron_adjacent( adj_facet )
+                    != polyhedron_facet.polyhedron_id )
+                {
+                    continue;
+                }
                 const auto adj_facet_vertices =
-                    detail::OrientedVertexCycle< PolyhedronFacetVertices >(
-                        mesh_.polyhedron_facet_vertices( adj_facet ) );
-                if( facet_vertices.is_opposite( adj_facet_vertices )
-                    && mesh_.polyhedron_adjacent( adj_facet )
-                           == polyhedron_facet.polyhedron_id )
+                    mesh_.polyhedron_facet_vertices( adj_facet );
+                if( adj_facet_vertices.size() != facet.cycle.size() )
+                {
+                    continue;
+                }
+                const auto adj = canonical_facet( adj_facet_vertices );
+                if( adj.reversed != facet.reversed
+                    && adj.cycle == facet.cycle )
                 {
                     return true;
                 }
@@ -28,6 +28,8 @@
 
 #include <geode/mesh/core/surface_mesh.hpp>
 
+#include <geode/inspector/internal/parallel.hpp>
+
 namespace geode
 {
     template < index_t dimension >
@@ -38,21 +40,21 @@ namespace geode
 
         bool mesh_has_wrong_adjacencies() const
         {
-            for( const auto polygon_id : Range{ mesh_.nb_polygons() } )
-            {
-                for( const auto edge_id :
-                    LRange{ mesh_.nb_polygon_edges( polygon_id ) } )
-                {
-                    const PolygonEdge polygon_edge{ polygon_id, edge_id };
-                    if( !mesh_.is_edge_on_border( polygon_edge )
-                        && !mesh_polygon_edge_has_right_adjacency(
-                            polygon_edge ) )
+            return internal::parallel_any_of(
+                mesh_.nb_polygons(), [this]( index_t polygon_id ) {
+                    for( const auto edge_id :
+                        LRange{ mesh_.nb_polygon_edges( polygon_id ) } )
                     {
-                        return true;
+                        const PolygonEdge polygon_edge{ polygon_id, edge_id };
+                        if( !mesh_.is_edge_on_border( polygon_edge )
+                            && !mesh_polygon_edge_has_right_adjacency(
+                                polygon_edge ) )
+                        {
+                            return true;
+                        }
                     }
-                }
-            }
-            return false;
+                    return false;
+                } );
         }
 
         InspectionIssues< PolygonEdge >
@@ -60,23 +62,25 @@ namespace geode
         {
             InspectionIssues< PolygonEdge > wrong_adjacency_edges{ absl::StrCat(
                 "Polygon edges with wrong adjacencies." ) };
-            for( const auto polygon_id : Range{ mesh_.nb_polygons() } )
-            {
-                for( const auto edge_id :
-                    LRange{ mesh_.nb_polygon_edges( polygon_id ) } )
-                {
-                    const PolygonEdge polygon_edge{ polygon_id, edge_id };
-                    if( !mesh_.is_edge_on_border( polygon_edge )
-                        && !mesh_polygon_edge_has_right_adjacency(
-                            polygon_edge ) )
+            internal::parallel_add_issues( mesh_.nb_polygons(),
+                wrong_adjacency_edges,
+                [this]( index_t polygon_id,
+                    InspectionIssues< PolygonEdge >& polygon_issues ) {
+                    for( const auto edge_id :
+                        LRange{ mesh_.nb_polygon_edges( polygon_id ) } )
                     {
-                        wrong_adjacency_edges.add_issue(
-                            polygon_edge, absl::StrCat( "Local edge ", edge_id,
-                                              " of polygon ", polygon_id,
-                                              " has wrong adjacencies." ) );
+                        const PolygonEdge polygon_edge{ polygon_id, edge_id };
+                        if( !mesh_.is_edge_on_border( polygon_edge )
+                            && !mesh_polygon_edge_has_right_adjacency(
+                                polygon_edge ) )
+                        {
+                            polygon_issues.add_issue( polygon_edge,
+                                absl::StrCat( "Local edge ", edge_id,
+                                    " of polygon ", polygon_id,
+                                    " has wrong adjacencies." ) );
+                        }
                     }
-                }
-            }
+                } );
             return wrong_adjacency_edges;
         }
 
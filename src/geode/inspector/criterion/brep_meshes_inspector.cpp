@@ -23,7 +23,9 @@
 
 #include <geode/inspector/criterion/brep_meshes_inspector.hpp>
 
-#include <async++.h>
+#include <geode/inspector/internal/criteria_runner.hpp>
+#include <geode/inspector/internal/inspection_scheduler.hpp>
+#include <geode/inspector/internal/inspection_stop.hpp>
 
 namespace geode
 {
@@ -57,34 +59,122 @@ namespace geode
           BRepComponentMeshesDegeneration( brep ),
           BRepComponentMeshesManifold( brep ),
           BRepComponentMeshesNegativeElements( brep ),
-          BRepMeshesIntersections( brep )
+          BRepMeshesIntersections( brep ),
+          brep_( brep )
     {
     }
 
     BRepMeshesInspectionResult BRepMeshesInspector::inspect_brep_meshes() const
     {
+        return inspect_brep_meshes( InspectionOptions{} );
+    }
+
+    BRepMeshesInspectionResult BRepMeshesInspector::inspect_brep_meshes(
+        const InspectionOptions& options ) const
+    {
+        const internal::InspectionStop stop{ options };
+        const internal::InspectionStopScope scope{ stop };
+        const internal::InspectionProgressScope progress{ options };
+        internal::CriteriaRunner runner{ options };
+        const auto counts = runner.is_profiled()
+                                ? internal::model_element_counts( brep_ )
+                                : internal::ModelElementCounts{};
         BRepMeshesInspectionResult result;
-        async::parallel_invoke(
+        const BRepInspectionContext context{ brep_ };
+        const auto colocation =
+            options.is_enabled( InspectionCriterion::colocation );
+        runner.run(
+            internal::criterion_task( colocation,
+                "unique vertices colocation", counts.unique_vertices,
+                [&result, this] {
+                    result.unique_vertices_colocation =
+                        inspect_unique_vertices();
+                } ),
+            internal::criterion_task( colocation, "meshes colocation",
+                counts.vertices,
+                [&result, this] {
+                    result.meshes_colocation =
+                        inspect_meshes_point_colocations();
+                } ),
+            internal::criterion_task(
+                options.is_enabled( InspectionCriterion::adjacency ),
+                "adjacency", counts.polygons + counts.polyhedra,
+                [&result, &context, this] {
+                    result.meshes_adjacencies =
+                        inspect_brep_meshes_adjacencies( context );
+                } ),
+            internal::criterion_task(
+                options.is_enabled( InspectionCriterion::degeneration ),
+                "degeneration",
+                counts.edges + counts.polygons + counts.polyhedra,
+                [&result, this] {
+                    result.meshes_degenerations =
+                        inspect_elements_degeneration();
+                } ),
+            internal::criterion_task(
+                options.is_enabled( InspectionCriterion::intersections ),
+                "intersections", counts.polygons,
+                [&result, &context, this] {
+                    result.meshes_intersections =
+                        inspect_intersections( context );
+                } ),
+            internal::criterion_task(
+                options.is_enabled( InspectionCriterion::manifold ),
+                "manifold", counts.polygons + counts.polyhedra,
+                [&result, &context, this] {
+                    result.meshes_non_manifolds =
+                        inspect_brep_manifold( context );
+                } ),
+            internal::criterion_task(
+                options.is_enabled( InspectionCriterion::negative_elements ),
+                "negative elements", counts.polyhedra,
+                [&result, this] {
+                    result.meshes_negative_elements =
+                        inspect_negative_elements();
+                } ) );
+        result.status = stop.status();
+        result.profile = runner.profile();
+        return result;
+    }
+
+    BRepMeshesInspectionResult BRepMeshesInspector::inspect_brep_meshes(
+        absl::Span< const uuid > components ) const
+    {
+        return inspect_brep_meshes( components, {} );
+    }
+
+    BRepMeshesInspectionResult BRepMeshesInspector::inspect_brep_meshes(
+        absl::Span< const uuid > components,
+        absl::Span< const index_t > unique_vertices ) const
+    {
+        BRepMeshesInspectionResult result;
+        internal::parallel_invoke(
             [&result, this] {
                 result.unique_vertices_colocation = inspect_unique_vertices();
             },
-            [&result, this] {
-                result.meshes_colocation = inspect_meshes_point_colocations();
+            [&result, &components, this] {
+                result.meshes_colocation =
+                    inspect_meshes_point_colocations( components );
             },
-            [&result, this] {
-                result.meshes_adjacencies = inspect_brep_meshes_adjacencies();
+            [&result, &components, this] {
+                result.meshes_adjacencies =
+                    inspect_brep_meshes_adjacencies( components );
             },
-            [&result, this] {
-                result.meshes_degenerations = inspect_elements_degeneration();
+            [&result, &components, this] {
+                result.meshes_degenerations =
+                    inspect_elements_degeneration( components );
             },
-            [&result, this] {
-                result.meshes_intersections = inspect_intersections();
+            [&result, &components, this] {
+                result.meshes_intersections =
+                    inspect_intersections( components );
             },
-            [&result, this] {
-                result.meshes_non_manifolds = inspect_brep_manifold();
+            [&result, &components, &unique_vertices, this] {
+                result.meshes_non_manifolds =
+                    inspect_brep_manifold( components, unique_vertices );
             },
-            [&result, this] {
-                result.meshes_negative_elements = inspect_negative_elements();
+            [&result, &components, this] {
+                result.meshes_negative_elements =
+                    inspect_negative_elements( components );
             } );
         return result;
     }
@@ -23,6 +23,8 @@
 
 #include <geode/inspector/criterion/colocation/component_meshes_colocation.hpp>
 
+#include <async++.h>
+
 #include <geode/basic/logger.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 #include <geode/basic/uuid.hpp>
@@ -42,6 +44,8 @@
 #include <geode/inspector/criterion/colocation/edgedcurve_colocation.hpp>
 #include <geode/inspector/criterion/colocation/solid_colocation.hpp>
 #include <geode/inspector/criterion/colocation/surface_colocation.hpp>
+#include <geode/inspector/internal/inspected_components.hpp>
+#include <geode/inspector/internal/inspection_scheduler.hpp>
 
 namespace
 {
@@ -95,134 +99,158 @@ namespace
         return new_colocated_points_groups;
     }
 
-    template < typename Model >
-    void add_model_components_colocated_points_groups_base( const Model& model,
-        geode::InspectionIssuesMap< std::vector< geode::index_t > >&
-            components_colocated_points )
+    template < typename Inspector, typename Model, typename Component >
+    geode::InspectionIssues< std::vector< geode::index_t > >
+        component_colocated_points_groups( const Model& model,
+            const Component& component,
+            absl::string_view component_type )
     {
-        for( const auto& line : model.lines() )
+        const auto& mesh = component.mesh();
+        const Inspector inspector{ mesh };
+        const auto colocated_pts =
+            filter_colocated_points_with_same_uuid< Model >( model,
+                component.component_id(),
+                inspector.colocated_points_groups().issues() );
+        geode::InspectionIssues< std::vector< geode::index_t > > issues{
+            absl::StrCat( component_type, " with uuid ",
+                component.id().string(), " colocated vertices" )
+        };
+        for( const auto& colocated_points_group : colocated_pts )
         {
-            const geode::EdgedCurveColocation< Model::dim > inspector{
-                line.mesh()
-            };
-            auto colocated_pts =
-                filter_colocated_points_with_same_uuid< Model >( model,
-                    line.component_id(),
-                    inspector.colocated_points_groups().issues() );
-            if( !colocated_pts.empty() )
+            std::string point_group_string;
+            for( const auto point_index : colocated_points_group )
             {
-                geode::InspectionIssues< std::vector< geode::index_t > >
-                    line_issues{ absl::StrCat( "Line with uuid ",
-                        line.id().string(), " colocated vertices" ) };
-                const auto& line_mesh = line.mesh();
-                for( const auto& colocated_points_group : colocated_pts )
-                {
-                    std::string point_group_string;
-                    for( const auto point_index : colocated_points_group )
-                    {
-                        absl::StrAppend(
-                            &point_group_string, " ", point_index );
-                    }
-                    line_issues.add_issue( colocated_points_group,
-                        absl::StrCat( "Line with uuid ", line.id().string(),
-                            " has vertices with indices", point_group_string,
-                            " which are colocated at position [",
-                            line_mesh.point( colocated_points_group[0] )
-                                .string(),
-                            "]." ) );
-                }
-                components_colocated_points.add_issues_to_map(
-                    line.id(), std::move( line_issues ) );
+                absl::StrAppend( &point_group_string, " ", point_index );
             }
+            issues.add_issue( colocated_points_group,
+                absl::StrCat( component_type, " with uuid ",
+                    component.id().string(), " has vertices with indices",
+                    point_group_string, " which are colocated at position [",
+                    mesh.point( colocated_points_group[0] ).string(), "]." ) );
         }
-        for( const auto& surface : model.surfaces() )
+        return issues;
+    }
+
+    template < typename Inspector, typename Model, typename ComponentRange >
+    void add_components_colocated_points_groups( const Model& model,
+        ComponentRange&& model_components,
+        const geode::internal::InspectedComponents& components,
+        absl::string_view component_type,
+        geode::InspectionIssuesMap< std::vector< geode::index_t > >&
+            components_colocated_points )
+    {
+        const auto sorted_components =
+            geode::internal::inspected_components_by_decreasing_size(
+                model_components, components );
+        std::vector< geode::InspectionIssues< std::vector< geode::index_t > > >
+            components_issues( sorted_components.size() );
+        const auto trace_name = absl::StrCat( component_type, " colocation" );
+        geode::internal::parallel_for_components( sorted_components, trace_name,
+            [&model, &sorted_components, &components_issues, component_type](
+                std::size_t id ) {
+                components_issues[id] =
+                    component_colocated_points_groups< Inspector >(
+                        model, *sorted_components[id], component_type );
+            } );
+        for( const auto id : geode::Indices{ sorted_components } )
         {
-            const geode::SurfaceMeshColocation< Model::dim > inspector{
-                surface.mesh()
-            };
-            auto colocated_pts =
-                filter_colocated_points_with_same_uuid< Model >( model,
-                    surface.component_id(),
-                    inspector.colocated_points_groups().issues() );
-            if( !colocated_pts.empty() )
-            {
-                geode::InspectionIssues< std::vector< geode::index_t > >
-                    surface_issues{ absl::StrCat( "Surface with uuid ",
-                        surface.id().string(), " colocated vertices" ) };
-                const auto& surface_mesh = surface.mesh();
-                for( const auto& colocated_points_group : colocated_pts )
-                {
-                    std::string point_group_string;
-                    for( const auto point_index : colocated_points_group )
-                    {
-                        absl::StrAppend(
-                            &point_group_string, " ", point_index );
-                    }
-                    surface_issues.add_issue( colocated_points_group,
-                        absl::StrCat( "Surface with uuid ",
-                            surface.id().string(), " has vertices with indices",
-                            point_group_string,
-                            " which are colocated at position [",
-                            surface_mesh.point( colocated_points_group[0] )
-                                .string(),
-                            "]." ) );
-                }
-                components_colocated_points.add_issues_to_map(
-                    surface.id(), std::move( surface_issues ) );
-            }
+            components_colocated_points.add_issues_to_map(
+                sorted_components[id]->id(),
+                std::move( components_issues[id] ) );
         }
     }
 
+    template < typename Inspector, typename Model, typename Component >
+    bool component_has_colocated_points(
+        const Model& model, const Component& component )
+    {
+        const Inspector inspector{ component.mesh() };
+        if( !inspector.mesh_has_colocated_points() )
+        {
+            return false;
+        }
+        return !filter_colocated_points_with_same_uuid< Model >( model,
+            component.component_id(),
+            inspector.colocated_points_groups().issues() )
+                    .empty();
+    }
+
+    template < typename Inspector, typename Model, typename ComponentRange >
+    bool components_have_colocated_points( const Model& model,
+        ComponentRange&& model_components,
+        absl::string_view component_type )
+    {
+        const auto sorted_components =
+            geode::internal::inspected_components_by_decreasing_size(
+                model_components, geode::internal::InspectedComponents{} );
+        const auto trace_name = absl::StrCat( component_type, " colocation" );
+        return geode::internal::parallel_any_of_components( sorted_components,
+            trace_name, [&model, &sorted_components]( std::size_t id ) {
+                return component_has_colocated_points< Inspector >(
+                    model, *sorted_components[id] );
+            } );
+    }
+
+    template < typename Model >
+    bool model_components_have_colocated_points_base( const Model& model )
+    {
+        return components_have_colocated_points<
+                   geode::EdgedCurveColocation< Model::dim > >(
+                   model, model.lines(), "Line" )
+               || components_have_colocated_points<
+                   geode::SurfaceMeshColocation< Model::dim > >(
+                   model, model.surfaces(), "Surface" );
+    }
+
+    bool model_components_have_colocated_points( const geode::Section& model )
+    {
+        return model_components_have_colocated_points_base( model );
+    }
+
+    bool model_components_have_colocated_points( const geode::BRep& model )
+    {
+        return model_components_have_colocated_points_base( model )
+               || components_have_colocated_points<
+                   geode::SolidMeshColocation3D >(
+                   model, model.blocks(), "Block" );
+    }
+
+    template < typename Model >
+    void add_model_components_colocated_points_groups_base( const Model& model,
+        const geode::internal::InspectedComponents& components,
+        geode::InspectionIssuesMap< std::vector< geode::index_t > >&
+            components_colocated_points )
+    {
+        add_components_colocated_points_groups<
+            geode::EdgedCurveColocation< Model::dim > >( model, model.lines(),
+            components, "Line", components_colocated_points );
+        add_components_colocated_points_groups<
+            geode::SurfaceMeshColocation< Model::dim > >( model,
+            model.surfaces(), components, "Surface",
+            components_colocated_points );
+    }
+
     void add_model_components_colocated_points_groups(
         const geode::Section& model,
+        const geode::internal::InspectedComponents& components,
         geode::InspectionIssuesMap< std::vector< geode::index_t > >&
             components_colocated_points )
     {
         add_model_components_colocated_points_groups_base< geode::Section >(
-            model, components_colocated_points );
+            model, components, components_colocated_points );
     }
 
     void add_model_components_colocated_points_groups( const geode::BRep& model,
+        const geode::internal::InspectedComponents& components,
         geode::InspectionIssuesMap< std::vector< geode::index_t > >&
             components_colocated_points )
     {
         add_model_components_colocated_points_groups_base< geode::BRep >(
-            model, components_colocated_points );
-        for( const auto& block : model.blocks() )
-        {
-            const geode::SolidMeshColocation3D inspector{ block.mesh() };
-            auto colocated_pts =
-                filter_colocated_points_with_same_uuid< geode::BRep >( model,
-                    block.component_id(),
-                    inspector.colocated_points_groups().issues() );
-            if( !colocated_pts.empty() )
-            {
-                geode::InspectionIssues< std::vector< geode::index_t > >
-                    block_issues{ absl::StrCat( "Block with uuid ",
-                        block.id().string(), " colocated vertices" ) };
-                const auto& block_mesh = block.mesh();
-                for( const auto& colocated_points_group : colocated_pts )
-                {
-                    std::string point_group_string;
-                    for( const auto point_index : colocated_points_group )
-                    {
-                        absl::StrAppend(
-                            &point_group_string, " ", point_index );
-                    }
-                    block_issues.add_issue( colocated_points_group,
-                        absl::StrCat( "Block with uuid ", block.id().string(),
-                            " has vertices with indices", point_group_string,
-                            " which are colocated at position [",
-                            block_mesh.point( colocated_points_group[0] )
-                                .string(),
-                            "]." ) );
-                }
-                components_colocated_points.add_issues_to_map(
-                    block.id(), std::move( block_issues ) );
-            }
-        }
+            model, components, components_colocated_points );
+        add_components_colocated_points_groups< geode::SolidMeshColocation3D >(
+            model, model.blocks(), components, "Block",
+            components_colocated_points );
     }
-
 } // namespace
 
 namespace geode
@@ -253,9 +281,16 @@ namespace geode
         Impl( const Model& model ) : model_( model ) {}
 
         void add_components_colocated_points_groups(
+            const internal::InspectedComponents& components,
             InspectionIssuesMap< std::vector< index_t > >& issues_map ) const
         {
-            add_model_components_colocated_points_groups( model_, issues_map );
+            add_model_components_colocated_points_groups(
+                model_, components, issues_map );
+        }
+
+        bool model_has_colocated_points() const
+        {
+            return model_components_have_colocated_points( model_ );
         }
 
     private:
@@ -272,6 +307,12 @@ namespace geode
     template < typename Model >
     ComponentMeshesColocation< Model >::~ComponentMeshesColocation() = default;
 
+    template < typename Model >
+    bool ComponentMeshesColocation< Model >::model_has_colocated_points() const
+    {
+        return impl_->model_has_colocated_points();
+    }
+
     template < typename Model >
     MeshesColocationInspectionResult
         ComponentMeshesColocation< Model >::inspect_meshes_point_colocations()
@@ -279,6 +320,18 @@ namespace geode
     {
         MeshesColocationInspectionResult result;
         impl_->add_components_colocated_points_groups(
+            internal::InspectedComponents{}, result.colocated_points_groups );
+        return result;
+    }
+
+    template < typename Model >
+    MeshesColocationInspectionResult
+        ComponentMeshesColocation< Model >::inspect_meshes_point_colocations(
+            absl::Span< const uuid > components ) const
+    {
+        MeshesColocationInspectionResult result;
+        impl_->add_components_colocated_points_groups(
+            internal::InspectedComponents{ components },
             result.colocated_points_groups );
         return result;
     }
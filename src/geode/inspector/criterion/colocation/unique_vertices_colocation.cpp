@@ -23,8 +23,6 @@
 
 #include <geode/inspector/criterion/colocation/unique_vertices_colocation.hpp>
 
-#include <async++.h>
-
 #include <geode/basic/logger.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 
@@ -44,6 +42,7 @@
 #include <geode/model/representation/core/section.hpp>
 
 #include <geode/inspector/criterion/colocation/pointset_colocation.hpp>
+#include <geode/inspector/internal/inspection_scheduler.hpp>
 
 namespace
 {
@@ -304,7 +303,7 @@ namespace geode
         UniqueVerticesColocation< Model >::inspect_unique_vertices() const
     {
         UniqueVerticesInspectionResult result;
-        async::parallel_invoke(
+        internal::parallel_invoke(
             [&result, this] {
                 impl_->add_colocated_unique_vertices_groups(
                     result.colocated_unique_vertices_groups );
@@ -23,14 +23,20 @@
 
 #include <geode/inspector/criterion/degeneration/brep_meshes_degeneration.hpp>
 
+#include <async++.h>
+
 #include <geode/basic/logger.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 
+#include <geode/mesh/core/solid_mesh.hpp>
+
 #include <geode/model/mixin/core/block.hpp>
 #include <geode/model/representation/core/brep.hpp>
 
 #include <geode/inspector/criterion/degeneration/solid_degeneration.hpp>
 #include <geode/inspector/criterion/internal/component_meshes_degeneration.hpp>
+#include <geode/inspector/internal/inspected_components.hpp>
+#include <geode/inspector/internal/inspection_scheduler.hpp>
 
 namespace geode
 {
@@ -76,23 +82,66 @@ namespace geode
         {
         }
 
+        BRepMeshesDegenerationInspectionResult inspect_elements_degeneration(
+            const internal::InspectedComponents& components ) const
+        {
+            BRepMeshesDegenerationInspectionResult result;
+            add_degenerated_edges_and_polygons( components,
+                result.degenerated_edges, result.degenerated_polygons );
+            add_solid_degenerations( components, result.degenerated_edges,
+                result.degenerated_polyhedra );
+            return result;
+        }
+
+        bool model_has_degenerated_elements() const
+        {
+            if( has_degenerated_edges_or_polygons() )
+            {
+                return true;
+            }
+            const auto blocks =
+                internal::inspected_components_by_decreasing_size(
+                    model().blocks(), internal::InspectedComponents{} );
+            return internal::parallel_any_of_components( blocks,
+                "Block degeneration", [&blocks]( std::size_t id ) {
+                    const SolidMeshDegeneration3D inspector{
+                        blocks[id]->mesh()
+                    };
+                    return inspector.is_mesh_degenerated();
+                } );
+        }
+
         void add_solid_degenerations(
+            const internal::InspectedComponents& components,
             InspectionIssuesMap< index_t >& degenerated_edges_map,
             InspectionIssuesMap< index_t >& degenerated_polyhedra_map ) const
         {
-            for( const auto& block : model().blocks() )
+            const auto blocks =
+                internal::inspected_components_by_decreasing_size(
+                    model().blocks(), components );
+            std::vector< SolidMeshDegenerationIssues > blocks_degenerations(
+                blocks.size() );
+            internal::parallel_for_components( blocks, "Block degeneration",
+                [&blocks, &blocks_degenerations]( std::size_t id ) {
+                    const SolidMeshDegeneration3D inspector{
+                        blocks[id]->mesh()
+                    };
+                    blocks_degenerations[id] =
+                        inspector.degenerated_edges_and_polyhedra();
+                } );
+            for( const auto id : Indices{ blocks } )
             {
-                const geode::SolidMeshDegeneration3D inspector{ block.mesh() };
-                auto degenerated_edges = inspector.degenerated_edges();
-                degenerated_edges.set_description( absl::StrCat(
+                const auto& block = *blocks[id];
+                auto& degenerations = blocks_degenerations[id];
+                degenerations.degenerated_edges.set_description( absl::StrCat(
                     "Block ", block.id().string(), " degenerated edges" ) );
                 degenerated_edges_map.add_issues_to_map(
-                    block.id(), std::move( degenerated_edges ) );
-                auto degenerated_polyhedra = inspector.degenerated_polyhedra();
-                degenerated_polyhedra.set_description( absl::StrCat(
-                    "Block ", block.id().string(), " degenerated polyhedra" ) );
-                degenerated_polyhedra_map.add_issues_to_map(
-                    block.id(), std::move( degenerated_polyhedra ) );
+                    block.id(), std::move( degenerations.degenerated_edges ) );
+                degenerations.degenerated_polyhedra.set_description(
+                    absl::StrCat( "Block ", block.id().string(),
+                        " degenerated polyhedra" ) );
+                degenerated_polyhedra_map.add_issues_to_map( block.id(),
+                    std::move( degenerations.degenerated_polyhedra ) );
             }
         }
     };
@@ -106,14 +155,23 @@ namespace geode
     BRepComponentMeshesDegeneration::~BRepComponentMeshesDegeneration() =
         default;
 
+    bool BRepComponentMeshesDegeneration::model_has_degenerated_elements() const
+    {
+        return impl_->model_has_degenerated_elements();
+    }
+
     BRepMeshesDegenerationInspectionResult
         BRepComponentMeshesDegeneration::inspect_elements_degeneration() const
     {
-        BRepMeshesDegenerationInspectionResult result;
-        impl_->add_degenerated_edges( result.degenerated_edges );
-        impl_->add_degenerated_polygons( result.degenerated_polygons );
-        impl_->add_solid_degenerations(
-            result.degenerated_edges, result.degenerated_polyhedra );
-        return result;
+        return impl_->inspect_elements_degeneration(
+            internal::InspectedComponents{} );
+    }
+
+    BRepMeshesDegenerationInspectionResult
+        BRepComponentMeshesDegeneration::inspect_elements_degeneration(
+            absl::Span< const uuid > components ) const
+    {
+        return impl_->inspect_elements_degeneration(
+            internal::InspectedComponents{ components } );
     }
 } // namespace geode
@@ -29,6 +29,7 @@
 #include <geode/model/representation/core/section.hpp>
 
 #include <geode/inspector/criterion/internal/component_meshes_degeneration.hpp>
+#include <geode/inspector/internal/inspected_components.hpp>
 
 namespace geode
 {
@@ -80,13 +81,20 @@ namespace geode
     SectionComponentMeshesDegeneration::~SectionComponentMeshesDegeneration() =
         default;
 
+    bool SectionComponentMeshesDegeneration::model_has_degenerated_elements()
+        const
+    {
+        return impl_->has_degenerated_edges_or_polygons();
+    }
+
     SectionMeshesDegenerationInspectionResult
         SectionComponentMeshesDegeneration::inspect_elements_degeneration()
             const
     {
         SectionMeshesDegenerationInspectionResult result;
-        impl_->add_degenerated_edges( result.degenerated_edges );
-        impl_->add_degenerated_polygons( result.degenerated_polygons );
+        impl_->add_degenerated_edges_and_polygons(
+            internal::InspectedComponents{}, result.degenerated_edges,
+            result.degenerated_polygons );
         return result;
     }
 } // namespace geode
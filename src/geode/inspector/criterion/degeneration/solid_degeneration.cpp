@@ -27,9 +27,6 @@
 #include <geode/basic/pimpl_impl.hpp>
 #include <geode/basic/uuid.hpp>
 
-#include <geode/geometry/basic_objects/tetrahedron.hpp>
-#include <geode/geometry/mensuration.hpp>
-
 #include <geode/mesh/core/solid_mesh.hpp>
 
 #include <geode/inspector/criterion/internal/degeneration_impl.hpp>
@@ -45,43 +42,6 @@ namespace geode
             : internal::DegenerationImpl< SolidMesh< dimension > >{ mesh }
         {
         }
-
-        bool is_mesh_degenerated() const final
-        {
-            if( this->internal::DegenerationImpl<
-                    SolidMesh< dimension > >::is_mesh_degenerated() )
-            {
-                return true;
-            }
-            for( const auto polyhedron_id :
-                Range{ this->mesh().nb_polyhedra() } )
-            {
-                if( this->mesh().is_polyhedron_degenerated( polyhedron_id ) )
-                {
-                    return true;
-                }
-            }
-            return false;
-        }
-
-        InspectionIssues< index_t > degenerated_polyhedra() const
-        {
-            InspectionIssues< index_t > wrong_polyhedra{
-                "Degenerated Polyhedra."
-            };
-            for( const auto polyhedron_id :
-                Range{ this->mesh().nb_polyhedra() } )
-            {
-                if( this->mesh().is_polyhedron_degenerated( polyhedron_id ) )
-                {
-                    wrong_polyhedra.add_issue( polyhedron_id,
-                        absl::StrCat( "Polyhedron ", polyhedron_id,
-                            " of Solid ", this->mesh().id().string(),
-                            " is degenerated." ) );
-                }
-            }
-            return wrong_polyhedra;
-        }
     };
 
     template < index_t dimension >
@@ -111,7 +71,17 @@ namespace geode
     InspectionIssues< index_t >
         SolidMeshDegeneration< dimension >::degenerated_polyhedra() const
     {
-        return impl_->degenerated_polyhedra();
+        return impl_->degenerated_elements();
+    }
+
+    template < index_t dimension >
+    SolidMeshDegenerationIssues
+        SolidMeshDegeneration< dimension >::degenerated_edges_and_polyhedra()
+            const
+    {
+        auto degenerations = impl_->degenerated_edges_and_elements();
+        return { std::move( degenerations.first ),
+            std::move( degenerations.second ) };
     }
 
     template class opengeode_inspector_inspector_api SolidMeshDegeneration< 3 >;
@@ -27,9 +27,6 @@
 #include <geode/basic/pimpl_impl.hpp>
 #include <geode/basic/uuid.hpp>
 
-#include <geode/geometry/basic_objects/triangle.hpp>
-#include <geode/geometry/mensuration.hpp>
-
 #include <geode/mesh/core/surface_mesh.hpp>
 
 #include <geode/inspector/criterion/internal/degeneration_impl.hpp>
@@ -45,40 +42,6 @@ namespace geode
             : internal::DegenerationImpl< SurfaceMesh< dimension > >{ mesh }
         {
         }
-
-        bool is_mesh_degenerated() const final
-        {
-            if( this->internal::DegenerationImpl<
-                    SurfaceMesh< dimension > >::is_mesh_degenerated() )
-            {
-                return true;
-            }
-            for( const auto polygon_id : Range{ this->mesh().nb_polygons() } )
-            {
-                if( this->mesh().is_polygon_degenerated( polygon_id ) )
-                {
-                    return true;
-                }
-            }
-            return false;
-        }
-
-        InspectionIssues< index_t > degenerated_polygons() const
-        {
-            InspectionIssues< index_t > wrong_polygons{
-                "Degenerated Polygons."
-            };
-            for( const auto polygon_id : Range{ this->mesh().nb_polygons() } )
-            {
-                if( this->mesh().is_polygon_degenerated( polygon_id ) )
-                {
-                    wrong_polygons.add_issue( polygon_id,
-                        absl::StrCat( "Polygon ", polygon_id, " of Surface ",
-                            this->mesh().id().string(), " is degenerated." ) );
-                }
-            }
-            return wrong_polygons;
-        }
     };
 
     template < index_t dimension >
@@ -108,7 +71,17 @@ namespace geode
     InspectionIssues< index_t >
         SurfaceMeshDegeneration< dimension >::degenerated_polygons() const
     {
-        return impl_->degenerated_polygons();
+        return impl_->degenerated_elements();
+    }
+
+    template < index_t dimension >
+    SurfaceMeshDegenerationIssues
+        SurfaceMeshDegeneration< dimension >::degenerated_edges_and_polygons()
+            const
+    {
+        auto degenerations = impl_->degenerated_edges_and_elements();
+        return { std::move( degenerations.first ),
+            std::move( degenerations.second ) };
     }
 
     template class opengeode_inspector_inspector_api
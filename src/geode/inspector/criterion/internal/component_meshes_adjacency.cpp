@@ -23,6 +23,8 @@
 
 #include <geode/inspector/criterion/internal/component_meshes_adjacency.hpp>
 
+#include <async++.h>
+
 #include <geode/basic/logger.hpp>
 
 #include <geode/mesh/core/surface_mesh.hpp>
@@ -33,6 +35,9 @@
 #include <geode/model/representation/core/section.hpp>
 
 #include <geode/inspector/criterion/adjacency/surface_adjacency.hpp>
+#include <geode/inspector/internal/inspected_components.hpp>
+#include <geode/inspector/internal/inspection_scheduler.hpp>
+#include <geode/inspector/internal/parallel.hpp>
 
 namespace
 {
@@ -66,21 +71,96 @@ namespace geode
         template < typename Model >
         void ComponentMeshesAdjacency< Model >::
             add_surfaces_edges_with_wrong_adjacencies(
+                const InspectedComponents& components,
                 InspectionIssuesMap< PolygonEdge >&
                     components_wrong_adjacencies ) const
         {
-            for( const auto& surface : model_.surfaces() )
+            const auto surfaces = inspected_components_by_decreasing_size(
+                model_.surfaces(), components );
+            std::vector< InspectionIssues< PolygonEdge > > surfaces_issues(
+                surfaces.size() );
+            internal::parallel_for_components( surfaces, "Surface adjacency",
+                [&surfaces, &surfaces_issues, this]( std::size_t id ) {
+                    surfaces_issues[id] =
+                        surface_edges_with_wrong_adjacencies( *surfaces[id] );
+                } );
+            for( const auto id : Indices{ surfaces } )
+            {
+                components_wrong_adjacencies.add_issues_to_map(
+                    surfaces[id]->id(), std::move( surfaces_issues[id] ) );
+            }
+        }
+
+        template < typename Model >
+        InspectionIssues< PolygonEdge > ComponentMeshesAdjacency< Model >::
+            surface_edges_with_wrong_adjacencies(
+                const Surface< Model::dim >& surface ) const
+        {
+            const SurfaceMeshAdjacency< Model::dim > inspector{
+                surface.mesh()
+            };
+            auto issues = inspector.polygon_edges_with_wrong_adjacency();
+            issues.set_description( absl::StrCat( "Surface ",
+                surface.id().string(), " polygon edges adjacency issues." ) );
+            const auto& mesh = surface.mesh();
+            for( const auto polygon_id : Range{ mesh.nb_polygons() } )
             {
-                const SurfaceMeshAdjacency< Model::dim > inspector{
-                    surface.mesh()
-                };
-                auto issues = inspector.polygon_edges_with_wrong_adjacency();
-                issues.set_description(
-                    absl::StrCat( "Surface ", surface.id().string(),
-                        " polygon edges adjacency issues." ) );
-                const auto& mesh = surface.mesh();
-                for( const auto polygon_id : Range{ mesh.nb_polygons() } )
+                for( const auto edge_id :
+                    LRange{ mesh.nb_polygon_edges( polygon_id ) } )
                 {
+                    const PolygonEdge polygon_edge{ polygon_id, edge_id };
+                    try
+                    {
+                        if( mesh.is_edge_on_border( polygon_edge )
+                            && !polygon_edge_is_on_a_line(
+                                model_, surface, polygon_edge ) )
+                        {
+                            issues.add_issue( polygon_edge,
+                                absl::StrCat( "Local edge ", edge_id,
+                                    " of polygon ", polygon_id,
+                                    " has no adjacencies but is not part "
+                                    "of a "
+                                    "model Line." ) );
+                        }
+                    }
+                    catch( const OpenGeodeException& e )
+                    {
+                        Logger::warn( e.what() );
+                        issues.add_issue( polygon_edge,
+                            absl::StrCat( "Local edge ", edge_id,
+                                " of polygon ", polygon_id,
+                                " has no adjacencies but is not part of a "
+                                "model Line." ) );
+                    }
+                }
+            }
+            return issues;
+        }
+
+        template < typename Model >
+        bool ComponentMeshesAdjacency<
+            Model >::has_surfaces_edges_with_wrong_adjacencies() const
+        {
+            const auto surfaces = inspected_components_by_decreasing_size(
+                model_.surfaces(), InspectedComponents{} );
+            return parallel_any_of_components( surfaces, "Surface adjacency",
+                [&surfaces, this]( std::size_t id ) {
+                    return surface_has_wrong_adjacencies( *surfaces[id] );
+                } );
+        }
+
+        template < typename Model >
+        bool ComponentMeshesAdjacency< Model >::surface_has_wrong_adjacencies(
+            const Surface< Model::dim >& surface ) const
+        {
+            const auto& mesh = surface.mesh();
+            const SurfaceMeshAdjacency< Model::dim > inspector{ mesh };
+            if( inspector.mesh_has_wrong_adjacencies() )
+            {
+                return true;
+            }
+            return parallel_any_of( mesh.nb_polygons(),
+                [&mesh, &surface, this]( index_t polygon_id ) {
                     for( const auto edge_id :
                         LRange{ mesh.nb_polygon_edges( polygon_id ) } )
                     {
@@ -91,28 +171,17 @@ namespace geode
                                 && !polygon_edge_is_on_a_line(
                                     model_, surface, polygon_edge ) )
                             {
-                                issues.add_issue( polygon_edge,
-                                    absl::StrCat( "Local edge ", edge_id,
-                                        " of polygon ", polygon_id,
-                                        " has no adjacencies but is not part "
-                                        "of a "
-                                        "model Line." ) );
+                                return true;
                             }
                         }
                         catch( const OpenGeodeException& e )
                         {
                             Logger::warn( e.what() );
-                            issues.add_issue( polygon_edge,
-                                absl::StrCat( "Local edge ", edge_id,
-                                    " of polygon ", polygon_id,
-                                    " has no adjacencies but is not part of a "
-                                    "model Line." ) );
+                            return true;
                         }
                     }
-                }
-                components_wrong_adjacencies.add_issues_to_map(
-                    surface.id(), std::move( issues ) );
-            }
+                    return false;
+                } );
         }
 
         template < typename Model >
@@ -23,8 +23,11 @@
 
 #include <geode/inspector/criterion/internal/component_meshes_degeneration.hpp>
 
+#include <async++.h>
+
 #include <geode/basic/logger.hpp>
 
+#include <geode/mesh/core/edged_curve.hpp>
 #include <geode/mesh/core/surface_mesh.hpp>
 
 #include <geode/model/mixin/core/line.hpp>
@@ -34,6 +37,8 @@
 
 #include <geode/inspector/criterion/degeneration/edgedcurve_degeneration.hpp>
 #include <geode/inspector/criterion/degeneration/surface_degeneration.hpp>
+#include <geode/inspector/internal/inspected_components.hpp>
+#include <geode/inspector/internal/inspection_scheduler.hpp>
 
 namespace geode
 {
@@ -47,49 +52,87 @@ namespace geode
         }
 
         template < typename Model >
-        void ComponentMeshesDegeneration< Model >::add_degenerated_edges(
-            InspectionIssuesMap< index_t >& components_degenerated_edges ) const
+        void ComponentMeshesDegeneration< Model >::
+            add_degenerated_edges_and_polygons(
+                const InspectedComponents& components,
+                InspectionIssuesMap< index_t >& components_degenerated_edges,
+                InspectionIssuesMap< index_t >&
+                    components_degenerated_polygons ) const
         {
-            for( const auto& line : model_.lines() )
+            const auto lines = inspected_components_by_decreasing_size(
+                model_.lines(), components );
+            const auto surfaces = inspected_components_by_decreasing_size(
+                model_.surfaces(), components );
+            std::vector< InspectionIssues< index_t > > lines_degenerated_edges(
+                lines.size() );
+            std::vector< SurfaceMeshDegenerationIssues >
+                surfaces_degenerations( surfaces.size() );
+            internal::parallel_invoke(
+                [&lines, &lines_degenerated_edges] {
+                    internal::parallel_for_components( lines,
+                        "Line degeneration",
+                        [&lines, &lines_degenerated_edges]( std::size_t id ) {
+                            const EdgedCurveDegeneration< Model::dim >
+                                inspector{ lines[id]->mesh() };
+                            lines_degenerated_edges[id] =
+                                inspector.degenerated_edges();
+                        } );
+                },
+                [&surfaces, &surfaces_degenerations] {
+                    internal::parallel_for_components( surfaces,
+                        "Surface degeneration",
+                        [&surfaces, &surfaces_degenerations]( std::size_t id ) {
+                            const SurfaceMeshDegeneration< Model::dim >
+                                inspector{ surfaces[id]->mesh() };
+                            surfaces_degenerations[id] =
+                                inspector.degenerated_edges_and_polygons();
+                        } );
+                } );
+            for( const auto id : Indices{ lines } )
             {
-                const EdgedCurveDegeneration< Model::dim > inspector{
-                    line.mesh()
-                };
-                auto issues = inspector.degenerated_edges();
+                const auto& line = *lines[id];
+                auto& issues = lines_degenerated_edges[id];
                 issues.set_description( absl::StrCat(
                     "Line ", line.id().string(), " degenerated edges" ) );
                 components_degenerated_edges.add_issues_to_map(
                     line.id(), std::move( issues ) );
             }
-            for( const auto& surface : model_.surfaces() )
+            for( const auto id : Indices{ surfaces } )
             {
-                const geode::SurfaceMeshDegeneration< Model::dim > inspector{
-                    surface.mesh()
-                };
-                auto issues = inspector.degenerated_edges();
-                issues.set_description( absl::StrCat(
+                const auto& surface = *surfaces[id];
+                auto& degenerations = surfaces_degenerations[id];
+                degenerations.degenerated_edges.set_description( absl::StrCat(
                     "Surface ", surface.id().string(), " degenerated edges" ) );
-                components_degenerated_edges.add_issues_to_map(
-                    surface.id(), std::move( issues ) );
+                components_degenerated_edges.add_issues_to_map( surface.id(),
+                    std::move( degenerations.degenerated_edges ) );
+                degenerations.degenerated_polygons.set_description(
+                    absl::StrCat( "Surface ", surface.id().string(),
+                        " degenerated polygons" ) );
+                components_degenerated_polygons.add_issues_to_map( surface.id(),
+                    std::move( degenerations.degenerated_polygons ) );
             }
         }
 
         template < typename Model >
-        void ComponentMeshesDegeneration< Model >::add_degenerated_polygons(
-            InspectionIssuesMap< index_t >& components_degenerated_polygons )
-            const
+        bool ComponentMeshesDegeneration<
+            Model >::has_degenerated_edges_or_polygons() const
         {
-            for( const auto& surface : model_.surfaces() )
-            {
-                const geode::SurfaceMeshDegeneration< Model::dim > inspector{
-                    surface.mesh()
-                };
-                auto issues = inspector.degenerated_polygons();
-                issues.set_description( absl::StrCat( "Surface ",
-                    surface.id().string(), " degenerated polygons" ) );
-                components_degenerated_polygons.add_issues_to_map(
-                    surface.id(), std::move( issues ) );
-            }
+            const auto lines = inspected_components_by_decreasing_size(
+                model_.lines(), InspectedComponents{} );
+            const auto surfaces = inspected_components_by_decreasing_size(
+                model_.surfaces(), InspectedComponents{} );
+            return parallel_any_of_components( lines, "Line degeneration",
+                       [&lines]( std::size_t id ) {
+                           const EdgedCurveDegeneration< Model::dim >
+                               inspector{ lines[id]->mesh() };
+                           return inspector.is_mesh_degenerated();
+                       } )
+                   || parallel_any_of_components( surfaces,
+                       "Surface degeneration", [&surfaces]( std::size_t id ) {
+                           const SurfaceMeshDegeneration< Model::dim >
+                               inspector{ surfaces[id]->mesh() };
+                           return inspector.is_mesh_degenerated();
+                       } );
         }
 
         template < typename Model >
@@ -23,6 +23,8 @@
 
 #include <geode/inspector/criterion/internal/component_meshes_manifold.hpp>
 
+#include <async++.h>
+
 #include <geode/basic/logger.hpp>
 
 #include <geode/mesh/core/surface_mesh.hpp>
@@ -33,6 +35,8 @@
 
 #include <geode/inspector/criterion/manifold/surface_edge_manifold.hpp>
 #include <geode/inspector/criterion/manifold/surface_vertex_manifold.hpp>
+#include <geode/inspector/internal/inspected_components.hpp>
+#include <geode/inspector/internal/inspection_scheduler.hpp>
 
 namespace geode
 {
@@ -48,15 +52,26 @@ namespace geode
         template < typename Model >
         void ComponentMeshesManifold< Model >::
             add_surfaces_meshes_non_manifold_vertices(
+                const InspectedComponents& components,
                 InspectionIssuesMap< index_t >& surfaces_non_manifold_vertices )
                 const
         {
-            for( const auto& surface : model_.surfaces() )
+            const auto surfaces = inspected_components_by_decreasing_size(
+                model_.surfaces(), components );
+            std::vector< InspectionIssues< index_t > > surfaces_issues(
+                surfaces.size() );
+            internal::parallel_for_components( surfaces,
+                "Surface vertex manifold",
+                [&surfaces, &surfaces_issues]( std::size_t id ) {
+                    const SurfaceMeshVertexManifold< Model::dim > inspector{
+                        surfaces[id]->mesh()
+                    };
+                    surfaces_issues[id] = inspector.non_manifold_vertices();
+                } );
+            for( const auto id : Indices{ surfaces } )
             {
-                const SurfaceMeshVertexManifold< Model::dim > inspector{
-                    surface.mesh()
-                };
-                auto issues = inspector.non_manifold_vertices();
+                const auto& surface = *surfaces[id];
+                auto& issues = surfaces_issues[id];
                 issues.set_description( absl::StrCat( "Surface ",
                     surface.id().string(), " non manifold vertices" ) );
                 surfaces_non_manifold_vertices.add_issues_to_map(
@@ -68,15 +83,26 @@ namespace geode
 
         void ComponentMeshesManifold< Model >::
             add_surfaces_meshes_non_manifold_edges(
+                const InspectedComponents& components,
                 InspectionIssuesMap< std::array< index_t, 2 > >&
                     surfaces_non_manifold_edges ) const
         {
-            for( const auto& surface : model_.surfaces() )
+            const auto surfaces = inspected_components_by_decreasing_size(
+                model_.surfaces(), components );
+            std::vector< InspectionIssues< std::array< index_t, 2 > > >
+                surfaces_issues( surfaces.size() );
+            internal::parallel_for_components( surfaces,
+                "Surface edge manifold",
+                [&surfaces, &surfaces_issues]( std::size_t id ) {
+                    const SurfaceMeshEdgeManifold< Model::dim > inspector{
+                        surfaces[id]->mesh()
+                    };
+                    surfaces_issues[id] = inspector.non_manifold_edges();
+                } );
+            for( const auto id : Indices{ surfaces } )
             {
-                const SurfaceMeshEdgeManifold< Model::dim > inspector{
-                    surface.mesh()
-                };
-                auto issues = inspector.non_manifold_edges();
+                const auto& surface = *surfaces[id];
+                auto& issues = surfaces_issues[id];
                 issues.set_description( absl::StrCat( "Surface ",
                     surface.id().string(), " non manifold edges" ) );
                 surfaces_non_manifold_edges.add_issues_to_map(
@@ -84,6 +110,28 @@ namespace geode
             }
         }
 
+        template < typename Model >
+        bool ComponentMeshesManifold<
+            Model >::has_surfaces_meshes_non_manifold_elements() const
+        {
+            const auto surfaces = inspected_components_by_decreasing_size(
+                model_.surfaces(), InspectedComponents{} );
+            return parallel_any_of_components( surfaces, "Surface manifold",
+                [&surfaces]( std::size_t id ) {
+                    const auto& mesh = surfaces[id]->mesh();
+                    const SurfaceMeshVertexManifold< Model::dim >
+                        vertex_inspector{ mesh };
+                    if( !vertex_inspector.mesh_vertices_are_manifold() )
+                    {
+                        return true;
+                    }
+                    const SurfaceMeshEdgeManifold< Model::dim > edge_inspector{
+                        mesh
+                    };
+                    return !edge_inspector.mesh_edges_are_manifold();
+                } );
+        }
+
         template < typename Model >
         const Model& ComponentMeshesManifold< Model >::model() const
         {
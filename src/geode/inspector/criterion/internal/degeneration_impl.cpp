@@ -23,6 +23,12 @@
 
 #include <geode/inspector/criterion/internal/degeneration_impl.hpp>
 
+#include <cstdint>
+#include <numeric>
+#include <utility>
+
+#include <absl/container/inlined_vector.h>
+
 #include <geode/basic/uuid.hpp>
 
 #include <geode/mesh/core/solid_edges.hpp>
@@ -33,41 +39,220 @@
 #include <geode/geometry/distance.hpp>
 #include <geode/geometry/point.hpp>
 
-namespace geode
+#include <geode/inspector/internal/parallel.hpp>
+
+namespace
 {
-    namespace internal
+    using EdgeVertices = std::array< geode::index_t, 2 >;
+    using ElementEdges = absl::InlinedVector< EdgeVertices, 6 >;
+
+    template < geode::index_t dimension >
+    geode::index_t nb_mesh_elements(
+        const geode::SurfaceMesh< dimension >& mesh )
     {
-        template < class MeshType >
-        DegenerationImpl< MeshType >::DegenerationImpl( const MeshType& mesh )
-            : mesh_( mesh ), enabled_edges_( false )
+        return mesh.nb_polygons();
+    }
+
+    template < geode::index_t dimension >
+    geode::index_t nb_mesh_elements( const geode::SolidMesh< dimension >& mesh )
+    {
+        return mesh.nb_polyhedra();
+    }
+
+    template < geode::index_t dimension >
+    ElementEdges element_edges( const geode::SurfaceMesh< dimension >& mesh,
+        geode::index_t polygon_id )
+    {
+        ElementEdges edges;
+        for( const auto edge_id :
+            geode::LRange{ mesh.nb_polygon_edges( polygon_id ) } )
+        {
+            edges.push_back(
+                mesh.polygon_edge_vertices( { polygon_id, edge_id } ) );
+        }
+        return edges;
+    }
+
+    template < geode::index_t dimension >
+    ElementEdges element_edges( const geode::SolidMesh< dimension >& mesh,
+        geode::index_t polyhedron_id )
+    {
+        ElementEdges edges;
+        for( const auto& edge_vertices :
+            mesh.polyhedron_edges_vertices( polyhedron_id ) )
+        {
+            edges.push_back( edge_vertices );
+        }
+        return edges;
+    }
+
+    template < geode::index_t dimension >
+    bool element_is_degenerated( const geode::SurfaceMesh< dimension >& mesh,
+        geode::index_t polygon_id )
+    {
+        return mesh.is_polygon_degenerated( polygon_id );
+    }
+
+    template < geode::index_t dimension >
+    bool element_is_degenerated( const geode::SolidMesh< dimension >& mesh,
+        geode::index_t polyhedron_id )
+    {
+        return mesh.is_polyhedron_degenerated( polyhedron_id );
+    }
+
+    template < geode::index_t dimension >
+    std::string_view degenerated_elements_description(
+        const geode::SurfaceMesh< dimension >& /*unused*/ )
+    {
+        return "Degenerated Polygons.";
+    }
+
+    template < geode::index_t dimension >
+    std::string_view degenerated_elements_description(
+        const geode::SolidMesh< dimension >& /*unused*/ )
+    {
+        return "Degenerated Polyhedra.";
+    }
+
+    template < geode::index_t dimension >
+    std::string degenerated_element_message(
+        const geode::SurfaceMesh< dimension >& mesh, geode::index_t polygon_id )
+    {
+        return absl::StrCat( "Polygon ", polygon_id, " of Surface ",
+            mesh.id().string(), " is degenerated." );
+    }
+
+    template < geode::index_t dimension >
+    std::string degenerated_element_message(
+        const geode::SolidMesh< dimension >& mesh,
+        geode::index_t polyhedron_id )
+    {
+        return absl::StrCat( "Polyhedron ", polyhedron_id, " of Solid ",
+            mesh.id().string(), " is degenerated." );
+    }
+
+    std::pair< geode::index_t, geode::index_t > edge_key(
+        const EdgeVertices& edge_vertices )
+    {
+        return std::minmax( edge_vertices[0], edge_vertices[1] );
+    }
+
+    /*!
+     * Returns the unique edges of the mesh, numbered in order of first
+     * occurrence when walking the elements, as the mesh edges would be.
+     * Duplicates are removed with a parallel sort of the edge occurrences.
+     * inspect_element( chunk_id, element_id ) is called on each element
+     * during the same traversal.
+     */
+    template < typename Mesh, typename ElementInspector >
+    std::vector< EdgeVertices > mesh_unique_edges(
+        const Mesh& mesh, const ElementInspector& inspect_element )
+    {
+        const auto nb_elements = nb_mesh_elements( mesh );
+        std::vector< std::vector< EdgeVertices > > chunks_edges(
+            geode::internal::nb_parallel_chunks( nb_elements ) );
+        geode::internal::parallel_for_chunks( nb_elements,
+            [&mesh, &inspect_element, &chunks_edges]( geode::index_t chunk_id,
+                geode::index_t begin, geode::index_t end ) {
+                auto& chunk_edges = chunks_edges[chunk_id];
+                for( const auto element_id : geode::Range{ begin, end } )
+                {
+                    inspect_element( chunk_id, element_id );
+                    for( const auto& edge_vertices :
+                        element_edges( mesh, element_id ) )
+                    {
+                        chunk_edges.push_back( edge_vertices );
+                    }
+                }
+            } );
+        std::vector< EdgeVertices > occurrences;
+        for( const auto& chunk_edges : chunks_edges )
         {
-            if( !mesh_.are_edges_enabled() )
+            occurrences.insert(
+                occurrences.end(), chunk_edges.begin(), chunk_edges.end() );
+        }
+        const auto nb_occurrences =
+            static_cast< geode::index_t >( occurrences.size() );
+        std::vector< geode::index_t > sorted_occurrences( nb_occurrences );
+        std::iota( sorted_occurrences.begin(), sorted_occurrences.end(), 0 );
+        geode::internal::parallel_sort( sorted_occurrences.begin(),
+            sorted_occurrences.end(),
+            [&occurrences]( geode::index_t lhs, geode::index_t rhs ) {
+                const auto lhs_key = edge_key( occurrences[lhs] );
+                const auto rhs_key = edge_key( occurrences[rhs] );
+                if( lhs_key != rhs_key )
+                {
+                    return lhs_key < rhs_key;
+                }
+                return lhs < rhs;
+            } );
+        std::vector< std::uint8_t > is_first_occurrence( nb_occurrences, 0 );
+        for( const auto i : geode::Range{ nb_occurrences } )
+        {
+            if( i == 0
+                || edge_key( occurrences[sorted_occurrences[i]] )
+                       != edge_key( occurrences[sorted_occurrences[i - 1]] ) )
             {
-                mesh_.enable_edges();
-                enabled_edges_ = true;
+                is_first_occurrence[sorted_occurrences[i]] = 1;
             }
         }
-
-        template < class MeshType >
-        DegenerationImpl< MeshType >::~DegenerationImpl()
+        std::vector< EdgeVertices > unique_edges;
+        for( const auto occurrence : geode::Range{ nb_occurrences } )
         {
-            if( enabled_edges_ )
+            if( is_first_occurrence[occurrence] )
             {
-                mesh_.disable_edges();
+                unique_edges.push_back( occurrences[occurrence] );
             }
         }
+        return unique_edges;
+    }
+} // namespace
+
+namespace geode
+{
+    namespace internal
+    {
+        template < class MeshType >
+        DegenerationImpl< MeshType >::DegenerationImpl( const MeshType& mesh )
+            : mesh_( mesh )
+        {
+        }
+
+        template < class MeshType >
+        DegenerationImpl< MeshType >::~DegenerationImpl() = default;
 
         template < class MeshType >
         bool DegenerationImpl< MeshType >::is_mesh_degenerated() const
         {
-            for( const auto edge_index : Range{ mesh_.edges().nb_edges() } )
+            if( mesh_.are_edges_enabled() )
             {
-                if( edge_is_degenerated( edge_index ) )
-                {
-                    return true;
-                }
+                return parallel_any_of( mesh_.edges().nb_edges(),
+                           [this]( index_t edge_index ) {
+                               return edge_is_degenerated(
+                                   mesh_.edges().edge_vertices( edge_index ) );
+                           } )
+                       || parallel_any_of( nb_mesh_elements( mesh_ ),
+                           [this]( index_t element_id ) {
+                               return element_is_degenerated(
+                                   mesh_, element_id );
+                           } );
             }
-            return false;
+            return parallel_any_of( nb_mesh_elements( mesh_ ),
+                [this]( index_t element_id ) {
+                    if( element_is_degenerated( mesh_, element_id ) )
+                    {
+                        return true;
+                    }
+                    for( const auto& edge_vertices :
+                        element_edges( mesh_, element_id ) )
+                    {
+                        if( edge_is_degenerated( edge_vertices ) )
+                        {
+                            return true;
+                        }
+                    }
+                    return false;
+                } );
         }
 
         template < class MeshType >
@@ -77,29 +262,116 @@ namespace geode
             InspectionIssues< index_t > degenerated_edges_index{
                 "Degenerated Edges."
             };
-            for( const auto edge_index : Range{ mesh_.edges().nb_edges() } )
+            if( mesh_.are_edges_enabled() )
             {
-                if( edge_is_degenerated( edge_index ) )
-                {
-                    const auto edge_vertices =
-                        mesh_.edges().edge_vertices( edge_index );
-                    degenerated_edges_index.add_issue( edge_index,
-                        absl::StrCat( "Edge between vertices with index ",
-                            edge_vertices[0], " and index ", edge_vertices[1],
-                            ", at position [",
-                            mesh_.point( edge_vertices[0] ).string(),
-                            "], is degenerated." ) );
-                }
+                parallel_add_issues( mesh_.edges().nb_edges(),
+                    degenerated_edges_index,
+                    [this]( index_t edge_index,
+                        InspectionIssues< index_t >& issues ) {
+                        add_degenerated_edge( edge_index,
+                            mesh_.edges().edge_vertices( edge_index ),
+                            issues );
+                    } );
+                return degenerated_edges_index;
             }
+            add_degenerated_edges(
+                mesh_unique_edges(
+                    mesh_, []( index_t /*chunk_id*/, index_t /*element_id*/ ) {
+                    } ),
+                degenerated_edges_index );
             return degenerated_edges_index;
         }
 
+        template < class MeshType >
+        InspectionIssues< index_t >
+            DegenerationImpl< MeshType >::degenerated_elements() const
+        {
+            InspectionIssues< index_t > degenerated_elements_index{
+                degenerated_elements_description( mesh_ )
+            };
+            parallel_add_issues( nb_mesh_elements( mesh_ ),
+                degenerated_elements_index,
+                [this](
+                    index_t element_id, InspectionIssues< index_t >& issues ) {
+                    add_degenerated_element( element_id, issues );
+                } );
+            return degenerated_elements_index;
+        }
+
+        template < class MeshType >
+        std::pair< InspectionIssues< index_t >, InspectionIssues< index_t > >
+            DegenerationImpl< MeshType >::degenerated_edges_and_elements() const
+        {
+            if( mesh_.are_edges_enabled() )
+            {
+                return { degenerated_edges(), degenerated_elements() };
+            }
+            InspectionIssues< index_t > edges_issues{ "Degenerated Edges." };
+            InspectionIssues< index_t > elements_issues{
+                degenerated_elements_description( mesh_ )
+            };
+            std::vector< InspectionIssues< index_t > > chunks_issues(
+                nb_parallel_chunks( nb_mesh_elements( mesh_ ) ) );
+            const auto unique_edges = mesh_unique_edges(
+                mesh_, [this, &chunks_issues](
+                           index_t chunk_id, index_t element_id ) {
+                    add_degenerated_element(
+                        element_id, chunks_issues[chunk_id] );
+                } );
+            for( auto& chunk_issues : chunks_issues )
+            {
+                elements_issues.add_issues( std::move( chunk_issues ) );
+            }
+            add_degenerated_edges( unique_edges, edges_issues );
+            return { std::move( edges_issues ), std::move( elements_issues ) };
+        }
+
+        template < class MeshType >
+        void DegenerationImpl< MeshType >::add_degenerated_edge(
+            index_t edge_index,
+            const std::array< index_t, 2 >& edge_vertices,
+            InspectionIssues< index_t >& issues ) const
+        {
+            if( !edge_is_degenerated( edge_vertices ) )
+            {
+                return;
+            }
+            issues.add_issue( edge_index,
+                absl::StrCat( "Edge between vertices with index ",
+                    edge_vertices[0], " and index ", edge_vertices[1],
+                    ", at position [", mesh_.point( edge_vertices[0] ).string(),
+                    "], is degenerated." ) );
+        }
+
+        template < class MeshType >
+        void DegenerationImpl< MeshType >::add_degenerated_edges(
+            const std::vector< std::array< index_t, 2 > >& unique_edges,
+            InspectionIssues< index_t >& issues ) const
+        {
+            parallel_add_issues( static_cast< index_t >( unique_edges.size() ),
+                issues,
+                [this, &unique_edges]( index_t edge_index,
+                    InspectionIssues< index_t >& edge_issues ) {
+                    add_degenerated_edge(
+                        edge_index, unique_edges[edge_index], edge_issues );
+                } );
+        }
+
+        template < class MeshType >
+        void DegenerationImpl< MeshType >::add_degenerated_element(
+            index_t element_id, InspectionIssues< index_t >& issues ) const
+        {
+            if( element_is_degenerated( mesh_, element_id ) )
+            {
+                issues.add_issue( element_id,
+                    degenerated_element_message( mesh_, element_id ) );
+            }
+        }
+
         template < class MeshType >
         bool DegenerationImpl< MeshType >::edge_is_degenerated(
-            index_t edge_index ) const
+            const std::array< index_t, 2 >& edge_vertices ) const
         {
-            const auto edge_vertices =
-                mesh_.edges().edge_vertices( edge_index );
             const auto p1 = mesh_.point( edge_vertices[0] );
             const auto p2 = mesh_.point( edge_vertices[1] );
             return point_point_distance( p1, p2 ) < GLOBAL_EPSILON;
@@ -43,6 +43,10 @@
 #include <geode/model/representation/core/brep.hpp>
 #include <geode/model/representation/core/section.hpp>
 
+#include <geode/inspector/internal/inspected_components.hpp>
+#include <geode/inspector/internal/inspection_stop.hpp>
+#include <geode/inspector/internal/trace_scope.hpp>
+
 namespace
 {
     struct ComponentOverlap
@@ -80,14 +84,19 @@ namespace
     {
     public:
         ModelSurfacesIntersectionBase( const Model& model,
+            const geode::InspectionContext< Model >& context,
             const geode::uuid& surface_id1,
             const geode::uuid& surface_id2 )
-            : model_( model ),
-              same_surface_{ surface_id1 == surface_id2 },
+            : same_surface_{ surface_id1 == surface_id2 },
               surface1_( model.surface( surface_id1 ) ),
               surface2_( model.surface( surface_id2 ) ),
               mesh1_( surface1_.mesh() ),
-              mesh2_( same_surface_ ? mesh1_ : surface2_.mesh() )
+              mesh2_( same_surface_ ? mesh1_ : surface2_.mesh() ),
+              unique_vertices1_{ context.component_unique_vertices(
+                  surface1_.component_id() ) },
+              unique_vertices2_{ context.component_unique_vertices(
+                  surface2_.component_id() ) },
+              stop_( geode::internal::current_inspection_stop() )
         {
         }
 
@@ -98,6 +107,11 @@ namespace
         }
 
     protected:
+        bool stop_requested() const
+        {
+            return stop_.is_requested();
+        }
+
         bool polygons_intersect(
             geode::index_t p1_id, geode::index_t p2_id ) const
         {
@@ -155,13 +169,10 @@ namespace
                 common_vertices;
             for( const auto v1_id : t1_vertices )
             {
-                const auto v1_unique_vertex =
-                    model_.unique_vertex( { surface1_.component_id(), v1_id } );
+                const auto v1_unique_vertex = unique_vertices1_[v1_id];
                 for( const auto v2_id : t2_vertices )
                 {
-                    if( v1_unique_vertex
-                        == model_.unique_vertex(
-                            { surface2_.component_id(), v2_id } ) )
+                    if( v1_unique_vertex == unique_vertices2_[v2_id] )
                     {
                         common_vertices.push_back( { v1_id, v2_id } );
                         break;
@@ -202,12 +213,14 @@ namespace
         }
 
     private:
-        const Model& model_;
         DEBUG_CONST bool same_surface_;
         const geode::Surface< Model::dim >& surface1_;
         const geode::Surface< Model::dim >& surface2_;
         const geode::SurfaceMesh< Model::dim >& mesh1_;
         const geode::SurfaceMesh< Model::dim >& mesh2_;
+        absl::Span< const geode::index_t > unique_vertices1_;
+        absl::Span< const geode::index_t > unique_vertices2_;
+        const geode::internal::InspectionStop& stop_;
         std::vector< std::pair< geode::index_t, geode::index_t > >
             intersecting_polygons_;
         std::mutex mutex_;
@@ -219,16 +232,21 @@ namespace
     {
     public:
         OneModelSurfacesIntersection( const Model& model,
+            const geode::InspectionContext< Model >& context,
             const geode::uuid& surface_id1,
             const geode::uuid& surface_id2 )
             : ModelSurfacesIntersectionBase< Model >(
-                  model, surface_id1, surface_id2 ),
+                  model, context, surface_id1, surface_id2 ),
               same_surface_{ surface_id1 == surface_id2 }
         {
         }
 
         bool operator()( geode::index_t p1_id, geode::index_t p2_id )
         {
+            if( this->stop_requested() )
+            {
+                return true;
+            }
             if( same_surface_ && p1_id == p2_id )
             {
                 return false;
@@ -251,16 +269,21 @@ namespace
     {
     public:
         AllModelSurfacesIntersection( const Model& model,
+            const geode::InspectionContext< Model >& context,
             const geode::uuid& surface_id1,
             const geode::uuid& surface_id2 )
             : ModelSurfacesIntersectionBase< Model >(
-                  model, surface_id1, surface_id2 ),
+                  model, context, surface_id1, surface_id2 ),
               same_surface_{ surface_id1 == surface_id2 }
         {
         }
 
         bool operator()( geode::index_t p1_id, geode::index_t p2_id )
         {
+            if( this->stop_requested() )
+            {
+                return true;
+            }
             if( same_surface_ && p1_id == p2_id )
             {
                 return false;
@@ -471,8 +494,10 @@ namespace geode
 
         bool model_has_intersecting_surfaces() const
         {
+            const InspectionContext< Model > context{ model_ };
             const auto intersections = intersecting_polygons<
-                OneModelSurfacesIntersection< Model > >();
+                OneModelSurfacesIntersection< Model > >(
+                context, internal::InspectedComponents{} );
             if( intersections.empty() )
             {
                 return false;
@@ -481,11 +506,23 @@ namespace geode
         }
 
         void add_intersecting_surfaces_elements(
+            const internal::InspectedComponents& components,
+            InspectionIssues< std::pair< ComponentMeshElement,
+                ComponentMeshElement > >& intersection_issues ) const
+        {
+            const InspectionContext< Model > context{ model_ };
+            add_intersecting_surfaces_elements(
+                context, components, intersection_issues );
+        }
+
+        void add_intersecting_surfaces_elements(
+            const InspectionContext< Model >& context,
+            const internal::InspectedComponents& components,
             InspectionIssues< std::pair< ComponentMeshElement,
                 ComponentMeshElement > >& intersection_issues ) const
         {
             const auto intersections = intersecting_polygons<
-                AllModelSurfacesIntersection< Model > >();
+                AllModelSurfacesIntersection< Model > >( context, components );
             for( const auto& polygon_pair : intersections )
             {
                 intersection_issues.add_issue( polygon_pair,
@@ -501,7 +538,9 @@ namespace geode
     private:
         template < typename Action >
         std::vector< std::pair< ComponentMeshElement, ComponentMeshElement > >
-            intersecting_polygons() const
+            intersecting_polygons( const InspectionContext< Model >& context,
+                const internal::InspectedComponents& inspected_components )
+                const
         {
             std::vector<
                 std::pair< ComponentMeshElement, ComponentMeshElement > >
@@ -517,11 +556,26 @@ namespace geode
                     return component_intersections;
                 }
             }
-            const auto model_tree = create_surface_meshes_aabb_trees( model_ );
+            const auto model_tree = [this] {
+                const internal::TraceScope trace{ "aabb",
+                    "Surfaces AABB trees build" };
+                return create_surface_meshes_aabb_trees( model_ );
+            }();
+            const auto& stop = internal::current_inspection_stop();
             for( const auto& surface : model_.surfaces() )
             {
-                Action surfaces_intersection_action{ model_, surface.id(),
-                    surface.id() };
+                if( stop.is_requested() )
+                {
+                    return component_intersections;
+                }
+                if( !inspected_components.contains( surface.id() ) )
+                {
+                    continue;
+                }
+                const internal::TraceScope trace{ "aabb",
+                    "Surface self intersections", { surface.id() } };
+                Action surfaces_intersection_action{ model_, context,
+                    surface.id(), surface.id() };
                 model_tree
                     .mesh_trees_[model_tree.mesh_tree_ids_.at( surface.id() )]
                     .compute_self_element_bbox_intersections(
@@ -541,10 +595,22 @@ namespace geode
                 surfaces_overlap );
             for( const auto& components : surfaces_overlap.component_pairs )
             {
+                if( stop.is_requested() )
+                {
+                    return component_intersections;
+                }
                 const auto surface_uuid1 = model_tree.uuids_[components.first];
                 const auto surface_uuid2 = model_tree.uuids_[components.second];
-                Action surfaces_intersection_action{ model_, surface_uuid1,
-                    surface_uuid2 };
+                if( !inspected_components.contains( surface_uuid1 )
+                    && !inspected_components.contains( surface_uuid2 ) )
+                {
+                    continue;
+                }
+                const internal::TraceScope trace{ "aabb",
+                    "Surfaces intersections",
+                    { surface_uuid1, surface_uuid2 } };
+                Action surfaces_intersection_action{ model_, context,
+                    surface_uuid1, surface_uuid2 };
                 model_tree.mesh_trees_[components.first]
                     .compute_other_element_bbox_intersections(
                         model_tree.mesh_trees_[components.second],
@@ -593,10 +659,33 @@ namespace geode
     {
         ElementsIntersectionsInspectionResult results;
         impl_->add_intersecting_surfaces_elements(
+            internal::InspectedComponents{}, results.elements_intersections );
+        return results;
+    }
+
+    template < typename Model >
+    ElementsIntersectionsInspectionResult
+        ModelMeshesIntersections< Model >::inspect_intersections(
+            absl::Span< const uuid > components ) const
+    {
+        ElementsIntersectionsInspectionResult results;
+        impl_->add_intersecting_surfaces_elements(
+            internal::InspectedComponents{ components },
             results.elements_intersections );
         return results;
     }
 
+    template < typename Model >
+    ElementsIntersectionsInspectionResult
+        ModelMeshesIntersections< Model >::inspect_intersections(
+            const InspectionContext< Model >& context ) const
+    {
+        ElementsIntersectionsInspectionResult results;
+        impl_->add_intersecting_surfaces_elements( context,
+            internal::InspectedComponents{}, results.elements_intersections );
+        return results;
+    }
+
     template class opengeode_inspector_inspector_api
         ModelMeshesIntersections< Section >;
     template class opengeode_inspector_inspector_api
@@ -40,6 +40,8 @@
 #include <geode/mesh/helpers/aabb_edged_curve_helpers.hpp>
 #include <geode/mesh/helpers/aabb_surface_helpers.hpp>
 
+#include <geode/inspector/internal/trace_scope.hpp>
+
 namespace
 {
     template < geode::index_t dimension >
@@ -256,6 +258,8 @@ namespace geode
         std::vector< std::pair< index_t, index_t > >
             intersecting_triangles_with_edges() const
         {
+            const internal::TraceScope trace{ "aabb",
+                "Surface curve intersections" };
             const auto surface_aabb = create_aabb_tree( surface_ );
             const auto curve_aabb = create_aabb_tree( curve_ );
             Action action{ surface_, curve_ };
@@ -35,6 +35,9 @@
 #include <geode/mesh/helpers/aabb_surface_helpers.hpp>
 #include <geode/mesh/helpers/detail/mesh_intersection_detection.hpp>
 
+#include <geode/inspector/internal/inspection_stop.hpp>
+#include <geode/inspector/internal/trace_scope.hpp>
+
 namespace
 {
     template < geode::index_t dimension >
@@ -44,7 +47,8 @@ namespace
         PolygonPolygonIntersection( const geode::SurfaceMesh< dimension >& mesh,
             bool stop_at_first_intersection )
             : mesh_( mesh ),
-              stop_at_first_intersection_{ stop_at_first_intersection }
+              stop_at_first_intersection_{ stop_at_first_intersection },
+              stop_( geode::internal::current_inspection_stop() )
         {
         }
 
@@ -56,6 +60,10 @@ namespace
 
         bool operator()( geode::index_t p1_id, geode::index_t p2_id )
         {
+            if( stop_.is_requested() )
+            {
+                return true;
+            }
             if( p1_id == p2_id )
             {
                 return false;
@@ -87,6 +95,7 @@ namespace
     private:
         const geode::SurfaceMesh< dimension >& mesh_;
         bool stop_at_first_intersection_;
+        const geode::internal::InspectionStop& stop_;
         std::vector< std::pair< geode::index_t, geode::index_t > >
             intersecting_polygons_;
         std::mutex mutex_;
@@ -135,6 +144,8 @@ namespace geode
         std::vector< std::pair< index_t, index_t > > intersecting_polygons(
             bool stop_at_first_intersection ) const
         {
+            const internal::TraceScope trace{ "aabb",
+                "Surface self intersections" };
             const auto surface_aabb = create_aabb_tree( mesh_ );
             PolygonPolygonIntersection< dimension > action{ mesh_,
                 stop_at_first_intersection };
@@ -23,6 +23,8 @@
 
 #include <geode/inspector/criterion/manifold/brep_meshes_manifold.hpp>
 
+#include <async++.h>
+
 #include <geode/basic/algorithm.hpp>
 #include <geode/basic/logger.hpp>
 #include <geode/basic/pimpl_impl.hpp>
@@ -42,6 +44,77 @@
 #include <geode/inspector/criterion/manifold/solid_edge_manifold.hpp>
 #include <geode/inspector/criterion/manifold/solid_facet_manifold.hpp>
 #include <geode/inspector/criterion/manifold/solid_vertex_manifold.hpp>
+#include <geode/inspector/internal/inspected_components.hpp>
+#include <geode/inspector/internal/inspection_scheduler.hpp>
+
+namespace
+{
+    /*!
+     * Part of the model where model level non manifold elements are
+     * inspected: the unique vertices of a set of components and the
+     * components sharing these unique vertices. The default constructed
+     * region is the whole model.
+     */
+    class ModelRegion
+    {
+    public:
+        ModelRegion() = default;
+
+        ModelRegion( const geode::BRep& brep,
+            absl::Span< const geode::uuid > components,
+            absl::Span< const geode::index_t > unique_vertices )
+            : unique_vertices_{ geode::internal::components_unique_vertices(
+                  brep, components, unique_vertices ) },
+              components_{ region_components( brep, *unique_vertices_ ) }
+        {
+        }
+
+        [[nodiscard]] bool contains_component(
+            const geode::uuid& component ) const
+        {
+            return components_.contains( component );
+        }
+
+        [[nodiscard]] bool contains_unique_vertices(
+            absl::Span< const geode::index_t > unique_vertices ) const
+        {
+            if( !unique_vertices_ )
+            {
+                return true;
+            }
+            for( const auto unique_vertex : unique_vertices )
+            {
+                if( !absl::c_binary_search(
+                        *unique_vertices_, unique_vertex ) )
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    private:
+        [[nodiscard]] static geode::internal::InspectedComponents
+            region_components( const geode::BRep& brep,
+                absl::Span< const geode::index_t > unique_vertices )
+        {
+            std::vector< geode::uuid > components;
+            for( const auto unique_vertex : unique_vertices )
+            {
+                for( const auto& cmv :
+                    brep.component_mesh_vertices( unique_vertex ) )
+                {
+                    components.push_back( cmv.component_id.id() );
+                }
+            }
+            return geode::internal::InspectedComponents{ components };
+        }
+
+    private:
+        std::optional< std::vector< geode::index_t > > unique_vertices_;
+        geode::internal::InspectedComponents components_;
+    };
+} // namespace
 
 namespace geode
 {
@@ -94,17 +167,133 @@ namespace geode
         {
         }
 
+        BRepMeshesManifoldInspectionResult inspect_brep_manifold() const
+        {
+            const BRepInspectionContext context{ model() };
+            return inspect_brep_manifold( context );
+        }
+
+        BRepMeshesManifoldInspectionResult inspect_brep_manifold(
+            const BRepInspectionContext& context ) const
+        {
+            return inspect_brep_manifold(
+                context, internal::InspectedComponents{}, ModelRegion{} );
+        }
+
+        BRepMeshesManifoldInspectionResult inspect_brep_manifold(
+            absl::Span< const uuid > components,
+            absl::Span< const index_t > unique_vertices ) const
+        {
+            const BRepInspectionContext context{ model() };
+            return inspect_brep_manifold( context,
+                internal::InspectedComponents{ components },
+                ModelRegion{ model(), components, unique_vertices } );
+        }
+
+        bool model_has_non_manifold_elements() const
+        {
+            const BRepInspectionContext context{ model() };
+            return model_has_non_manifold_elements( context );
+        }
+
+        bool model_has_non_manifold_elements(
+            const BRepInspectionContext& context ) const
+        {
+            if( has_surfaces_meshes_non_manifold_elements()
+                || has_blocks_meshes_non_manifold_elements() )
+            {
+                return true;
+            }
+            InspectionIssues< BRepNonManifoldFacet > facets_issues;
+            add_model_non_manifold_facets( ModelRegion{}, facets_issues );
+            if( facets_issues.nb_issues() != 0 )
+            {
+                return true;
+            }
+            InspectionIssues< BRepNonManifoldEdge > edges_issues;
+            add_model_non_manifold_edges(
+                context, ModelRegion{}, edges_issues );
+            return edges_issues.nb_issues() != 0;
+        }
+
+    private:
+        bool has_blocks_meshes_non_manifold_elements() const
+        {
+            const auto blocks =
+                internal::inspected_components_by_decreasing_size(
+                    model().blocks(), internal::InspectedComponents{} );
+            return internal::parallel_any_of_components( blocks,
+                "Block manifold", [&blocks]( std::size_t id ) {
+                    const auto& mesh = blocks[id]->mesh();
+                    const SolidMeshVertexManifold3D vertex_inspector{ mesh };
+                    if( !vertex_inspector.mesh_vertices_are_manifold() )
+                    {
+                        return true;
+                    }
+                    const SolidMeshEdgeManifold3D edge_inspector{ mesh };
+                    if( !edge_inspector.mesh_edges_are_manifold() )
+                    {
+                        return true;
+                    }
+                    const SolidMeshFacetManifold3D facet_inspector{ mesh };
+                    return !facet_inspector.mesh_facets_are_manifold();
+                } );
+        }
+
+        BRepMeshesManifoldInspectionResult inspect_brep_manifold(
+            const BRepInspectionContext& context,
+            const internal::InspectedComponents& components,
+            const ModelRegion& region ) const
+        {
+            BRepMeshesManifoldInspectionResult result;
+            internal::parallel_invoke(
+                [&result, &components, this] {
+                    add_component_meshes_non_manifold_vertices(
+                        components, result.meshes_non_manifold_vertices );
+                },
+                [&result, &components, this] {
+                    add_component_meshes_non_manifold_edges(
+                        components, result.meshes_non_manifold_edges );
+                },
+                [&result, &components, this] {
+                    add_component_meshes_non_manifold_facets(
+                        components, result.meshes_non_manifold_facets );
+                },
+                [&result, &context, &region, this] {
+                    add_model_non_manifold_edges(
+                        context, region, result.brep_non_manifold_edges );
+                },
+                [&result, &region, this] {
+                    add_model_non_manifold_facets(
+                        region, result.brep_non_manifold_facets );
+                } );
+            return result;
+        }
+
         void add_component_meshes_non_manifold_vertices(
+            const internal::InspectedComponents& components,
             InspectionIssuesMap< index_t >& components_non_manifold_vertices )
             const
         {
             ComponentMeshesManifold< BRep >::
                 add_surfaces_meshes_non_manifold_vertices(
-                    components_non_manifold_vertices );
-            for( const auto& block : model().blocks() )
+                    components, components_non_manifold_vertices );
+            const auto blocks =
+                internal::inspected_components_by_decreasing_size(
+                    model().blocks(), components );
+            std::vector< InspectionIssues< index_t > > blocks_issues(
+                blocks.size() );
+            internal::parallel_for_components( blocks, "Block vertex manifold",
+                [&blocks, &blocks_issues]( std::size_t id ) {
+                    const SolidMeshVertexManifold3D inspector{
+                        blocks[id]->mesh()
+                    };
+                    blocks_issues[id] = inspector.non_manifold_vertices();
+                } );
+            for( const auto id : Indices{ blocks } )
             {
-                const SolidMeshVertexManifold3D inspector{ block.mesh() };
-                auto non_manifold_vertices = inspector.non_manifold_vertices();
+                const auto& block = *blocks[id];
+                auto& non_manifold_vertices = blocks_issues[id];
                 non_manifold_vertices.set_description( absl::StrCat(
                     "Block ", block.id().string(), " non manifold vertices" ) );
                 components_non_manifold_vertices.add_issues_to_map(
@@ -113,46 +302,79 @@ namespace geode
         }
 
         void add_component_meshes_non_manifold_edges(
+            const internal::InspectedComponents& components,
             InspectionIssuesMap< std::array< index_t, 2 > >&
                 components_non_manifold_edges ) const
         {
             ComponentMeshesManifold< BRep >::
                 add_surfaces_meshes_non_manifold_edges(
-                    components_non_manifold_edges );
-            for( const auto& block : model().blocks() )
+                    components, components_non_manifold_edges );
+            const auto blocks =
+                internal::inspected_components_by_decreasing_size(
+                    model().blocks(), components );
+            std::vector< InspectionIssues< std::array< index_t, 2 > > >
+                blocks_issues( blocks.size() );
+            internal::parallel_for_components( blocks, "Block edge manifold",
+                [&blocks, &blocks_issues]( std::size_t id ) {
+                    const SolidMeshEdgeManifold3D inspector{
+                        blocks[id]->mesh()
+                    };
+                    blocks_issues[id] = inspector.non_manifold_edges();
+                } );
+            for( const auto id : Indices{ blocks } )
             {
-                const SolidMeshEdgeManifold3D inspector{ block.mesh() };
-                auto non_manifold_edges = inspector.non_manifold_edges();
+                const auto& block = *blocks[id];
+                auto& non_manifold_edges = blocks_issues[id];
                 non_manifold_edges.set_description( absl::StrCat(
                     "Block ", block.id().string(), " non manifold edges" ) );
                 components_non_manifold_edges.add_issues_to_map(
-                    block.id(), non_manifold_edges );
+                    block.id(), std::move( non_manifold_edges ) );
             }
         }
 
         void add_component_meshes_non_manifold_facets(
+            const internal::InspectedComponents& components,
             InspectionIssuesMap< PolyhedronFacetVertices >&
                 components_non_manifold_facets ) const
         {
-            for( const auto& block : model().blocks() )
+            const auto blocks =
+                internal::inspected_components_by_decreasing_size(
+                    model().blocks(), components );
+            std::vector< InspectionIssues< PolyhedronFacetVertices > >
+                blocks_issues( blocks.size() );
+            internal::parallel_for_components( blocks, "Block facet manifold",
+                [&blocks, &blocks_issues]( std::size_t id ) {
+                    const SolidMeshFacetManifold3D inspector{
+                        blocks[id]->mesh()
+                    };
+                    blocks_issues[id] = inspector.non_manifold_facets();
+                } );
+            for( const auto id : Indices{ blocks } )
             {
-                const SolidMeshFacetManifold3D inspector{ block.mesh() };
-                auto non_manifold_facets = inspector.non_manifold_facets();
+                const auto& block = *blocks[id];
+                auto& non_manifold_facets = blocks_issues[id];
                 non_manifold_facets.set_description( absl::StrCat(
                     "Block ", block.id().string(), " non manifold facets" ) );
                 components_non_manifold_facets.add_issues_to_map(
-                    block.id(), non_manifold_facets );
+                    block.id(), std::move( non_manifold_facets ) );
             }
         }
 
-        void add_model_non_manifold_edges(
+        void add_model_non_manifold_edges( const BRepInspectionContext& context,
+            const ModelRegion& region,
             InspectionIssues< BRepNonManifoldEdge >& issues ) const
         {
             using Edge = detail::VertexCycle< std::array< index_t, 2 > >;
             absl::flat_hash_map< Edge, std::vector< uuid > > edges;
             for( const auto& surface : model().surfaces() )
             {
+                if( !region.contains_component( surface.id() ) )
+                {
+                    continue;
+                }
                 const auto& mesh = surface.mesh();
+                const auto unique_vertices =
+                    context.component_unique_vertices( surface.component_id() );
                 for( const auto polygon_id : Range{ mesh.nb_polygons() } )
                 {
                     const auto vertices = mesh.polygon_vertices( polygon_id );
@@ -164,13 +386,10 @@ namespace geode
                         {
                             continue;
                         }
-                        const auto v0 = model().unique_vertex(
-                            { surface.component_id(), vertices[edge_id] } );
-                        const auto v1 =
-                            model().unique_vertex( { surface.component_id(),
-                                vertices[edge_id == vertices.size() - 1
-                                             ? 0
-                                             : edge_id + 1] } );
+                        const auto next_id =
+                            edge_id == vertices.size() - 1 ? 0 : edge_id + 1;
+                        const auto v0 = unique_vertices[vertices[edge_id]];
+                        const auto v1 = unique_vertices[vertices[next_id]];
                         const auto info = edges.try_emplace(
                             Edge{ std::array< index_t, 2 >{ v0, v1 } },
                             std::vector< uuid >{ surface.id() } );
@@ -184,7 +403,9 @@ namespace geode
             for( auto& edge : edges )
             {
                 sort_unique( edge.second );
-                if( edge.second.size() <= 1 )
+                if( edge.second.size() <= 1
+                    || !region.contains_unique_vertices(
+                        edge.first.vertices() ) )
                 {
                     continue;
                 }
@@ -204,7 +425,8 @@ namespace geode
             for( const auto& line : model().lines() )
             {
                 const auto& mesh = line.mesh();
-                if( mesh.nb_edges() != 1
+                if( !region.contains_component( line.id() )
+                    || mesh.nb_edges() != 1
                     || model().nb_embedding_surfaces( line ) == 0 )
                 {
                     continue;
@@ -216,7 +438,8 @@ namespace geode
                         model().unique_vertex( { line.component_id(),
                             mesh.edge_vertex( { 0, edge_vertex } ) } );
                 }
-                if( several_cmvs_on_one_vertex( edge_unique_vertices ) )
+                if( !region.contains_unique_vertices( edge_unique_vertices )
+                    || several_cmvs_on_one_vertex( edge_unique_vertices ) )
                 {
                     continue;
                 }
@@ -231,20 +454,22 @@ namespace geode
             }
         }
 
-        void add_model_non_manifold_facets(
+        void add_model_non_manifold_facets( const ModelRegion& region,
             InspectionIssues< BRepNonManifoldFacet >& issues ) const
         {
             for( const auto& surface : model().surfaces() )
             {
                 const auto& mesh = surface.mesh();
-                if( mesh.nb_polygons() != 1
+                if( !region.contains_component( surface.id() )
+                    || mesh.nb_polygons() != 1
                     || model().nb_embedding_blocks( surface ) == 0 )
                 {
                     continue;
                 }
                 auto facet_vertices =
                     polygon_unique_vertices( model(), surface, 0 );
-                if( several_cmvs_on_one_vertex( facet_vertices ) )
+                if( !region.contains_unique_vertices( facet_vertices )
+                    || several_cmvs_on_one_vertex( facet_vertices ) )
                 {
                     continue;
                 }
@@ -262,7 +487,6 @@ namespace geode
             }
         }
 
-    private:
         bool several_cmvs_on_one_vertex(
             absl::Span< const index_t > unique_vertices ) const
         {
@@ -292,18 +516,42 @@ namespace geode
 
     BRepComponentMeshesManifold::~BRepComponentMeshesManifold() = default;
 
+    bool BRepComponentMeshesManifold::model_has_non_manifold_elements() const
+    {
+        return impl_->model_has_non_manifold_elements();
+    }
+
+    bool BRepComponentMeshesManifold::model_has_non_manifold_elements(
+        const BRepInspectionContext& context ) const
+    {
+        return impl_->model_has_non_manifold_elements( context );
+    }
+
     BRepMeshesManifoldInspectionResult
         BRepComponentMeshesManifold::inspect_brep_manifold() const
     {
-        BRepMeshesManifoldInspectionResult result;
-        impl_->add_component_meshes_non_manifold_vertices(
-            result.meshes_non_manifold_vertices );
-        impl_->add_component_meshes_non_manifold_edges(
-            result.meshes_non_manifold_edges );
-        impl_->add_component_meshes_non_manifold_facets(
-            result.meshes_non_manifold_facets );
-        impl_->add_model_non_manifold_edges( result.brep_non_manifold_edges );
-        impl_->add_model_non_manifold_facets( result.brep_non_manifold_facets );
-        return result;
+        return impl_->inspect_brep_manifold();
+    }
+
+    BRepMeshesManifoldInspectionResult
+        BRepComponentMeshesManifold::inspect_brep_manifold(
+            absl::Span< const uuid > components ) const
+    {
+        return impl_->inspect_brep_manifold( components, {} );
+    }
+
+    BRepMeshesManifoldInspectionResult
+        BRepComponentMeshesManifold::inspect_brep_manifold(
+            absl::Span< const uuid > components,
+            absl::Span< const index_t > unique_vertices ) const
+    {
+        return impl_->inspect_brep_manifold( components, unique_vertices );
+    }
+
+    BRepMeshesManifoldInspectionResult
+        BRepComponentMeshesManifold::inspect_brep_manifold(
+            const BRepInspectionContext& context ) const
+    {
+        return impl_->inspect_brep_manifold( context );
     }
 } // namespace geode
@@ -29,6 +29,7 @@
 #include <geode/model/representation/core/section.hpp>
 
 #include <geode/inspector/criterion/internal/component_meshes_manifold.hpp>
+#include <geode/inspector/internal/inspected_components.hpp>
 
 namespace geode
 {
@@ -79,14 +80,20 @@ namespace geode
 
     SectionComponentMeshesManifold::~SectionComponentMeshesManifold() = default;
 
+    bool SectionComponentMeshesManifold::model_has_non_manifold_elements() const
+    {
+        return impl_->has_surfaces_meshes_non_manifold_elements();
+    }
+
     SectionMeshesManifoldInspectionResult
         SectionComponentMeshesManifold::inspect_section_manifold() const
     {
         SectionMeshesManifoldInspectionResult result;
         impl_->add_surfaces_meshes_non_manifold_vertices(
+            internal::InspectedComponents{},
             result.meshes_non_manifold_vertices );
         impl_->add_surfaces_meshes_non_manifold_edges(
-            result.meshes_non_manifold_edges );
+            internal::InspectedComponents{}, result.meshes_non_manifold_edges );
         return result;
     }
 } // namespace geode
@@ -23,13 +23,19 @@
 
 #include <geode/inspector/criterion/negative_elements/brep_meshes_negative_elements.hpp>
 
+#include <async++.h>
+
 #include <geode/basic/logger.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 
+#include <geode/mesh/core/solid_mesh.hpp>
+
 #include <geode/model/mixin/core/block.hpp>
 #include <geode/model/representation/core/brep.hpp>
 
 #include <geode/inspector/criterion/negative_elements/solid_negative_elements.hpp>
+#include <geode/inspector/internal/inspected_components.hpp>
+#include <geode/inspector/internal/inspection_scheduler.hpp>
 
 namespace geode
 {
@@ -58,16 +64,41 @@ namespace geode
     public:
         Impl( const BRep& brep ) : brep_( brep ) {}
 
-        BRepMeshesNegativeElementsInspectionResult
-            block_negative_elements() const
+        bool model_has_negative_elements() const
+        {
+            const auto blocks =
+                internal::inspected_components_by_decreasing_size(
+                    brep_.blocks(), internal::InspectedComponents{} );
+            return internal::parallel_any_of_components( blocks,
+                "Block negative elements", [&blocks]( std::size_t id ) {
+                    const SolidMeshNegativeElements3D inspector{
+                        blocks[id]->mesh()
+                    };
+                    return inspector.mesh_has_negative_elements();
+                } );
+        }
+
+        BRepMeshesNegativeElementsInspectionResult block_negative_elements(
+            const internal::InspectedComponents& components ) const
         {
             BRepMeshesNegativeElementsInspectionResult result;
-            for( const auto& block : brep_.blocks() )
+            const auto blocks =
+                internal::inspected_components_by_decreasing_size(
+                    brep_.blocks(), components );
+            std::vector< InspectionIssues< index_t > > blocks_issues(
+                blocks.size() );
+            internal::parallel_for_components( blocks,
+                "Block negative elements",
+                [&blocks, &blocks_issues]( std::size_t id ) {
+                    const SolidMeshNegativeElements3D inspector{
+                        blocks[id]->mesh()
+                    };
+                    blocks_issues[id] = inspector.negative_polyhedra();
+                } );
+            for( const auto id : Indices{ blocks } )
             {
-                const geode::SolidMeshNegativeElements3D inspector{
-                    block.mesh()
-                };
-                auto negative_elements = inspector.negative_polyhedra();
+                const auto& block = *blocks[id];
+                auto& negative_elements = blocks_issues[id];
                 negative_elements.set_description( absl::StrCat(
                     "Block ", block.id().string(), " negative polyhedra" ) );
                 result.negative_polyhedra.add_issues_to_map(
@@ -89,9 +120,24 @@ namespace geode
     BRepComponentMeshesNegativeElements::
         ~BRepComponentMeshesNegativeElements() = default;
 
+    bool BRepComponentMeshesNegativeElements::model_has_negative_elements()
+        const
+    {
+        return impl_->model_has_negative_elements();
+    }
+
     BRepMeshesNegativeElementsInspectionResult
         BRepComponentMeshesNegativeElements::inspect_negative_elements() const
     {
-        return impl_->block_negative_elements();
+        return impl_->block_negative_elements(
+            internal::InspectedComponents{} );
+    }
+
+    BRepMeshesNegativeElementsInspectionResult
+        BRepComponentMeshesNegativeElements::inspect_negative_elements(
+            absl::Span< const uuid > components ) const
+    {
+        return impl_->block_negative_elements(
+            internal::InspectedComponents{ components } );
     }
 } // namespace geode
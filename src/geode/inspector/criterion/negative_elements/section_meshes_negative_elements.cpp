@@ -23,6 +23,8 @@
 
 #include <geode/inspector/criterion/negative_elements/section_meshes_negative_elements.hpp>
 
+#include <async++.h>
+
 #include <geode/basic/logger.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 
@@ -32,6 +34,8 @@
 #include <geode/model/representation/core/section.hpp>
 
 #include <geode/inspector/criterion/negative_elements/surface_negative_elements.hpp>
+#include <geode/inspector/internal/inspected_components.hpp>
+#include <geode/inspector/internal/inspection_scheduler.hpp>
 
 namespace geode
 {
@@ -60,16 +64,41 @@ namespace geode
     public:
         Impl( const Section& section ) : section_( section ) {}
 
+        bool model_has_negative_elements() const
+        {
+            const auto surfaces =
+                internal::inspected_components_by_decreasing_size(
+                    section_.surfaces(), internal::InspectedComponents{} );
+            return internal::parallel_any_of_components( surfaces,
+                "Surface negative elements", [&surfaces]( std::size_t id ) {
+                    const SurfaceMeshNegativeElements2D inspector{
+                        surfaces[id]->mesh()
+                    };
+                    return inspector.mesh_has_negative_elements();
+                } );
+        }
+
         SectionMeshesNegativeElementsInspectionResult
             surface_negative_elements() const
         {
             SectionMeshesNegativeElementsInspectionResult result;
-            for( const auto& surface : section_.surfaces() )
+            const auto surfaces =
+                internal::inspected_components_by_decreasing_size(
+                    section_.surfaces(), internal::InspectedComponents{} );
+            std::vector< InspectionIssues< index_t > > surfaces_issues(
+                surfaces.size() );
+            internal::parallel_for_components( surfaces,
+                "Surface negative elements",
+                [&surfaces, &surfaces_issues]( std::size_t id ) {
+                    const SurfaceMeshNegativeElements2D inspector{
+                        surfaces[id]->mesh()
+                    };
+                    surfaces_issues[id] = inspector.negative_polygons();
+                } );
+            for( const auto id : Indices{ surfaces } )
             {
-                const geode::SurfaceMeshNegativeElements2D inspector{
-                    surface.mesh()
-                };
-                auto negative_elements = inspector.negative_polygons();
+                const auto& surface = *surfaces[id];
+                auto& negative_elements = surfaces_issues[id];
                 negative_elements.set_description( absl::StrCat(
                     "Surface ", surface.id().string(), " negative polygons" ) );
                 result.negative_polygons.add_issues_to_map(
@@ -91,6 +120,12 @@ namespace geode
     SectionComponentMeshesNegativeElements::
         ~SectionComponentMeshesNegativeElements() = default;
 
+    bool SectionComponentMeshesNegativeElements::model_has_negative_elements()
+        const
+    {
+        return impl_->model_has_negative_elements();
+    }
+
     SectionMeshesNegativeElementsInspectionResult
         SectionComponentMeshesNegativeElements::inspect_negative_elements()
             const
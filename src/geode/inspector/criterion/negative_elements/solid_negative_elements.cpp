@@ -23,6 +23,11 @@
 
 #include <geode/inspector/criterion/negative_elements/solid_negative_elements.hpp>
 
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <limits>
+
 #include <geode/basic/logger.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 #include <geode/basic/uuid.hpp>
@@ -32,61 +37,207 @@
 #include <geode/geometry/sign.hpp>
 
 #include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/tetrahedral_solid.hpp>
 
-namespace geode
+#include <geode/inspector/internal/parallel.hpp>
+
+namespace
 {
-    template < index_t dimension >
-    class SolidMeshNegativeElements< dimension >::Impl
+    constexpr geode::index_t TETRAHEDRA_BLOCK_SIZE{ 64 };
+
+    /*!
+     * Error bound of the floating point orientation determinant relative to
+     * its permanent (Shewchuk's o3derrboundA): a determinant larger than
+     * the bound has the same sign as the exact one.
+     */
+    constexpr double ORIENTATION_ERROR_BOUND =
+        ( 7. + 56. * std::numeric_limits< double >::epsilon() / 2. )
+        * std::numeric_limits< double >::epsilon() / 2.;
+
+    /*!
+     * Coordinates of a block of tetrahedra, stored axis by axis so that the
+     * orientation determinants are evaluated in a vectorizable loop.
+     */
+    struct TetrahedraBlock
+    {
+        using Coordinates = std::array< double, TETRAHEDRA_BLOCK_SIZE >;
+
+        std::array< std::array< Coordinates, 3 >, 4 > coordinates;
+        std::array< geode::index_t, TETRAHEDRA_BLOCK_SIZE > polyhedra;
+        geode::index_t size{ 0 };
+    };
+
+    template < geode::index_t dimension >
+    class NegativePolyhedraKernel
     {
     public:
-        Impl( const SolidMesh< dimension >& mesh ) : mesh_( mesh ) {}
+        explicit NegativePolyhedraKernel(
+            const geode::SolidMesh< dimension >& mesh )
+            : mesh_( mesh ),
+              only_tetrahedra_{
+                  dynamic_cast< const geode::TetrahedralSolid< dimension >* >(
+                      &mesh )
+                  != nullptr
+              }
+        {
+        }
 
-        bool mesh_has_negative_elements() const
+        /*!
+         * Calls on_negative( polyhedron_id ) on every polyhedron of
+         * [begin, end) with a negative volume, in increasing order.
+         */
+        template < typename NegativeFunctor >
+        void inspect( geode::index_t begin,
+            geode::index_t end,
+            const NegativeFunctor& on_negative ) const
         {
-            for( const auto polyhedron_id : Range{ mesh_.nb_polyhedra() } )
+            TetrahedraBlock block;
+            for( const auto polyhedron_id : geode::Range{ begin, end } )
             {
-                if( polyhedron_has_negative_volume( polyhedron_id ) )
+                if( !only_tetrahedra_
+                    && mesh_.nb_polyhedron_vertices( polyhedron_id ) != 4 )
+                {
+                    inspect_block( block, on_negative );
+                    if( mesh_.polyhedron_volume( polyhedron_id ) < 0 )
+                    {
+                        on_negative( polyhedron_id );
+                    }
+                    continue;
+                }
+                add_tetrahedron( block, polyhedron_id );
+                if( block.size == TETRAHEDRA_BLOCK_SIZE )
                 {
-                    return true;
+                    inspect_block( block, on_negative );
                 }
             }
-            return false;
+            inspect_block( block, on_negative );
         }
 
-        InspectionIssues< index_t > negative_polyhedra() const
+    private:
+        void add_tetrahedron(
+            TetrahedraBlock& block, geode::index_t polyhedron_id ) const
         {
-            InspectionIssues< index_t > wrong_polyhedra{
-                "Negative Polyhedra."
-            };
-            for( const auto polyhedron_id : Range{ mesh_.nb_polyhedra() } )
+            const auto vertices = mesh_.polyhedron_vertices( polyhedron_id );
+            for( const auto v : geode::LRange{ 4 } )
             {
-                if( polyhedron_has_negative_volume( polyhedron_id ) )
+                const auto& point = mesh_.point( vertices[v] );
+                for( const auto axis : geode::LRange{ 3 } )
                 {
-                    wrong_polyhedra.add_issue( polyhedron_id,
-                        absl::StrCat( "Polyhedron ", polyhedron_id,
-                            " of Solid ", mesh_.id().string(),
-                            " has a negative volume." ) );
+                    block.coordinates[v][axis][block.size] =
+                        point.value( axis );
                 }
             }
-            return wrong_polyhedra;
+            block.polyhedra[block.size] = polyhedron_id;
+            block.size++;
         }
 
-    private:
-        bool polyhedron_has_negative_volume( index_t polyhedron_id ) const
+        template < typename NegativeFunctor >
+        void inspect_block(
+            TetrahedraBlock& block, const NegativeFunctor& on_negative ) const
         {
-            if( mesh_.nb_polyhedron_vertices( polyhedron_id ) == 4 )
+            if( block.size == 0 )
+            {
+                return;
+            }
+            std::array< double, TETRAHEDRA_BLOCK_SIZE > determinants;
+            std::array< double, TETRAHEDRA_BLOCK_SIZE > error_bounds;
+            const auto& c = block.coordinates;
+            for( geode::index_t t = 0; t < block.size; t++ )
+            {
+                const auto ax = c[1][0][t] - c[0][0][t];
+                const auto ay = c[1][1][t] - c[0][1][t];
+                const auto az = c[1][2][t] - c[0][2][t];
+                const auto bx = c[2][0][t] - c[0][0][t];
+                const auto by = c[2][1][t] - c[0][1][t];
+                const auto bz = c[2][2][t] - c[0][2][t];
+                const auto cx = c[3][0][t] - c[0][0][t];
+                const auto cy = c[3][1][t] - c[0][1][t];
+                const auto cz = c[3][2][t] - c[0][2][t];
+                determinants[t] = ax * ( by * cz - bz * cy )
+                                  + ay * ( bz * cx - bx * cz )
+                                  + az * ( bx * cy - by * cx );
+                const auto permanent =
+                    std::fabs( ax )
+                        * ( std::fabs( by * cz ) + std::fabs( bz * cy ) )
+                    + std::fabs( ay )
+                          * ( std::fabs( bz * cx ) + std::fabs( bx * cz ) )
+                    + std::fabs( az )
+                          * ( std::fabs( bx * cy ) + std::fabs( by * cx ) );
+                error_bounds[t] = ORIENTATION_ERROR_BOUND * permanent;
+            }
+            for( geode::index_t t = 0; t < block.size; t++ )
             {
-                Tetrahedron tetrahedron{ mesh_.point( mesh_.polyhedron_vertex(
-                                             { polyhedron_id, 0 } ) ),
-                    mesh_.point(
-                        mesh_.polyhedron_vertex( { polyhedron_id, 1 } ) ),
-                    mesh_.point(
-                        mesh_.polyhedron_vertex( { polyhedron_id, 2 } ) ),
-                    mesh_.point(
-                        mesh_.polyhedron_vertex( { polyhedron_id, 3 } ) ) };
-                return tetrahedron_volume_sign( tetrahedron ) == Sign::negative;
+                if( determinants[t] < -error_bounds[t]
+                    || ( determinants[t] <= error_bounds[t]
+                         && exact_volume_is_negative( block.polyhedra[t] ) ) )
+                {
+                    on_negative( block.polyhedra[t] );
+                }
             }
-            return mesh_.polyhedron_volume( polyhedron_id ) < 0;
+            block.size = 0;
+        }
+
+        bool exact_volume_is_negative( geode::index_t polyhedron_id ) const
+        {
+            const auto vertices = mesh_.polyhedron_vertices( polyhedron_id );
+            const geode::Tetrahedron tetrahedron{ mesh_.point( vertices[0] ),
+                mesh_.point( vertices[1] ), mesh_.point( vertices[2] ),
+                mesh_.point( vertices[3] ) };
+            return geode::tetrahedron_volume_sign( tetrahedron )
+                   == geode::Sign::negative;
+        }
+
+    private:
+        const geode::SolidMesh< dimension >& mesh_;
+        const bool only_tetrahedra_;
+    };
+} // namespace
+
+namespace geode
+{
+    template < index_t dimension >
+    class SolidMeshNegativeElements< dimension >::Impl
+    {
+    public:
+        Impl( const SolidMesh< dimension >& mesh ) : mesh_( mesh ) {}
+
+        bool mesh_has_negative_elements() const
+        {
+            const NegativePolyhedraKernel< dimension > kernel{ mesh_ };
+            std::atomic< bool > found{ false };
+            internal::parallel_for_chunks( mesh_.nb_polyhedra(),
+                [&kernel, &found](
+                    index_t /*chunk_id*/, index_t begin, index_t end ) {
+                    if( found.load( std::memory_order_relaxed ) )
+                    {
+                        return;
+                    }
+                    kernel.inspect( begin, end, [&found]( index_t /*id*/ ) {
+                        found.store( true, std::memory_order_relaxed );
+                    } );
+                } );
+            return found.load();
+        }
+
+        InspectionIssues< index_t > negative_polyhedra() const
+        {
+            InspectionIssues< index_t > wrong_polyhedra{
+                "Negative Polyhedra."
+            };
+            const NegativePolyhedraKernel< dimension > kernel{ mesh_ };
+            internal::parallel_add_chunks_issues( mesh_.nb_polyhedra(),
+                wrong_polyhedra,
+                [this, &kernel]( index_t begin, index_t end,
+                    InspectionIssues< index_t >& chunk_issues ) {
+                    kernel.inspect( begin, end,
+                        [this, &chunk_issues]( index_t polyhedron_id ) {
+                            chunk_issues.add_issue( polyhedron_id,
+                                absl::StrCat( "Polyhedron ", polyhedron_id,
+                                    " of Solid ", mesh_.id().string(),
+                                    " has a negative volume." ) );
+                        } );
+                } );
+            return wrong_polyhedra;
         }
 
     private:
@@ -23,6 +23,11 @@
 
 #include <geode/inspector/criterion/negative_elements/surface_negative_elements.hpp>
 
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <limits>
+
 #include <geode/basic/logger.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 #include <geode/basic/uuid.hpp>
@@ -32,55 +37,192 @@
 #include <geode/geometry/sign.hpp>
 
 #include <geode/mesh/core/surface_mesh.hpp>
+#include <geode/mesh/core/triangulated_surface.hpp>
 
-namespace geode
+#include <geode/inspector/internal/parallel.hpp>
+
+namespace
 {
-    template < index_t dimension >
-    class SurfaceMeshNegativeElements< dimension >::Impl
+    constexpr geode::index_t TRIANGLES_BLOCK_SIZE{ 64 };
+
+    /*!
+     * Error bound of the floating point orientation determinant relative to
+     * its permanent (Shewchuk's ccwerrboundA): a determinant larger than
+     * the bound has the same sign as the exact one.
+     */
+    constexpr double ORIENTATION_ERROR_BOUND =
+        ( 3. + 16. * std::numeric_limits< double >::epsilon() / 2. )
+        * std::numeric_limits< double >::epsilon() / 2.;
+
+    /*!
+     * Coordinates of a block of triangles, stored axis by axis so that the
+     * orientation determinants are evaluated in a vectorizable loop.
+     */
+    struct TrianglesBlock
+    {
+        using Coordinates = std::array< double, TRIANGLES_BLOCK_SIZE >;
+
+        std::array< std::array< Coordinates, 2 >, 3 > coordinates;
+        std::array< geode::index_t, TRIANGLES_BLOCK_SIZE > polygons;
+        geode::index_t size{ 0 };
+    };
+
+    template < geode::index_t dimension >
+    class NegativePolygonsKernel
     {
     public:
-        Impl( const SurfaceMesh< dimension >& mesh ) : mesh_( mesh ) {}
+        explicit NegativePolygonsKernel(
+            const geode::SurfaceMesh< dimension >& mesh )
+            : mesh_( mesh ),
+              only_triangles_{ dynamic_cast< const geode::TriangulatedSurface<
+                                   dimension >* >( &mesh )
+                               != nullptr }
+        {
+        }
 
-        bool mesh_has_negative_elements() const
+        /*!
+         * Calls on_negative( polygon_id ) on every polygon of [begin, end)
+         * with a negative area, in increasing order.
+         */
+        template < typename NegativeFunctor >
+        void inspect( geode::index_t begin,
+            geode::index_t end,
+            const NegativeFunctor& on_negative ) const
         {
-            for( const auto polygon_id : Range{ mesh_.nb_polygons() } )
+            TrianglesBlock block;
+            for( const auto polygon_id : geode::Range{ begin, end } )
             {
-                if( polygon_has_negative_area( polygon_id ) )
+                if( !only_triangles_
+                    && mesh_.nb_polygon_vertices( polygon_id ) != 3 )
+                {
+                    inspect_block( block, on_negative );
+                    if( mesh_.polygon_area( polygon_id ) < 0 )
+                    {
+                        on_negative( polygon_id );
+                    }
+                    continue;
+                }
+                add_triangle( block, polygon_id );
+                if( block.size == TRIANGLES_BLOCK_SIZE )
                 {
-                    return true;
+                    inspect_block( block, on_negative );
                 }
             }
-            return false;
+            inspect_block( block, on_negative );
         }
 
-        InspectionIssues< index_t > negative_polygons() const
+    private:
+        void add_triangle(
+            TrianglesBlock& block, geode::index_t polygon_id ) const
         {
-            InspectionIssues< index_t > wrong_polygons{ "Negative Polygons." };
-            for( const auto polygon_id : Range{ mesh_.nb_polygons() } )
+            const auto vertices = mesh_.polygon_vertices( polygon_id );
+            for( const auto v : geode::LRange{ 3 } )
             {
-                if( polygon_has_negative_area( polygon_id ) )
+                const auto& point = mesh_.point( vertices[v] );
+                for( const auto axis : geode::LRange{ 2 } )
                 {
-                    wrong_polygons.add_issue( polygon_id,
-                        absl::StrCat( "Polygon ", polygon_id, " of Surface ",
-                            mesh_.id().string(), " has a negative area." ) );
+                    block.coordinates[v][axis][block.size] =
+                        point.value( axis );
                 }
             }
-            return wrong_polygons;
+            block.polygons[block.size] = polygon_id;
+            block.size++;
         }
 
-    private:
-        bool polygon_has_negative_area( index_t polygon_id ) const
+        template < typename NegativeFunctor >
+        void inspect_block(
+            TrianglesBlock& block, const NegativeFunctor& on_negative ) const
         {
-            if( mesh_.nb_polygon_vertices( polygon_id ) == 4 )
+            if( block.size == 0 )
+            {
+                return;
+            }
+            std::array< double, TRIANGLES_BLOCK_SIZE > determinants;
+            std::array< double, TRIANGLES_BLOCK_SIZE > error_bounds;
+            const auto& c = block.coordinates;
+            for( geode::index_t t = 0; t < block.size; t++ )
+            {
+                const auto ax = c[1][0][t] - c[0][0][t];
+                const auto ay = c[1][1][t] - c[0][1][t];
+                const auto bx = c[2][0][t] - c[0][0][t];
+                const auto by = c[2][1][t] - c[0][1][t];
+                determinants[t] = ax * by - ay * bx;
+                error_bounds[t] = ORIENTATION_ERROR_BOUND
+                                  * ( std::fabs( ax * by )
+                                      + std::fabs( ay * bx ) );
+            }
+            for( geode::index_t t = 0; t < block.size; t++ )
             {
-                Triangle< dimension > triangle{
-                    mesh_.point( mesh_.polygon_vertex( { polygon_id, 0 } ) ),
-                    mesh_.point( mesh_.polygon_vertex( { polygon_id, 1 } ) ),
-                    mesh_.point( mesh_.polygon_vertex( { polygon_id, 2 } ) )
-                };
-                return triangle_area_sign( triangle ) == Sign::negative;
+                if( determinants[t] < -error_bounds[t]
+                    || ( determinants[t] <= error_bounds[t]
+                         && exact_area_is_negative( block.polygons[t] ) ) )
+                {
+                    on_negative( block.polygons[t] );
+                }
             }
-            return mesh_.polygon_area( polygon_id ) < 0;
+            block.size = 0;
+        }
+
+        bool exact_area_is_negative( geode::index_t polygon_id ) const
+        {
+            const auto vertices = mesh_.polygon_vertices( polygon_id );
+            const geode::Triangle< dimension > triangle{
+                mesh_.point( vertices[0] ), mesh_.point( vertices[1] ),
+                mesh_.point( vertices[2] )
+            };
+            return geode::triangle_area_sign( triangle )
+                   == geode::Sign::negative;
+        }
+
+    private:
+        const geode::SurfaceMesh< dimension >& mesh_;
+        const bool only_triangles_;
+    };
+} // namespace
+
+namespace geode
+{
+    template < index_t dimension >
+    class SurfaceMeshNegativeElements< dimension >::Impl
+    {
+    public:
+        Impl( const SurfaceMesh< dimension >& mesh ) : mesh_( mesh ) {}
+
+        bool mesh_has_negative_elements() const
+        {
+            const NegativePolygonsKernel< dimension > kernel{ mesh_ };
+            std::atomic< bool > found{ false };
+            internal::parallel_for_chunks( mesh_.nb_polygons(),
+                [&kernel, &found](
+                    index_t /*chunk_id*/, index_t begin, index_t end ) {
+                    if( found.load( std::memory_order_relaxed ) )
+                    {
+                        return;
+                    }
+                    kernel.inspect( begin, end, [&found]( index_t /*id*/ ) {
+                        found.store( true, std::memory_order_relaxed );
+                    } );
+                } );
+            return found.load();
+        }
+
+        InspectionIssues< index_t > negative_polygons() const
+        {
+            InspectionIssues< index_t > wrong_polygons{ "Negative Polygons." };
+            const NegativePolygonsKernel< dimension > kernel{ mesh_ };
+            internal::parallel_add_chunks_issues( mesh_.nb_polygons(),
+                wrong_polygons,
+                [this, &kernel]( index_t begin, index_t end,
+                    InspectionIssues< index_t >& chunk_issues ) {
+                    kernel.inspect( begin, end,
+                        [this, &chunk_issues]( index_t polygon_id ) {
+                            chunk_issues.add_issue( polygon_id,
+                                absl::StrCat( "Polygon ", polygon_id,
+                                    " of Surface ", mesh_.id().string(),
+                                    " has a negative area." ) );
+                        } );
+                } );
+            return wrong_polygons;
         }
 
     private:
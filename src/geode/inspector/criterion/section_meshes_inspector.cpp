@@ -23,7 +23,8 @@
 
 #include <geode/inspector/criterion/section_meshes_inspector.hpp>
 
-#include <async++.h>
+#include <geode/inspector/internal/criteria_runner.hpp>
+#include <geode/inspector/internal/inspection_stop.hpp>
 
 namespace geode
 {
@@ -57,37 +58,79 @@ namespace geode
           SectionComponentMeshesDegeneration( section ),
           SectionComponentMeshesManifold( section ),
           SectionComponentMeshesNegativeElements( section ),
-          SectionMeshesIntersections( section )
+          SectionMeshesIntersections( section ),
+          section_( section )
     {
     }
 
     SectionMeshesInspectionResult
         SectionMeshesInspector::inspect_section_meshes() const
     {
+        return inspect_section_meshes( InspectionOptions{} );
+    }
+
+    SectionMeshesInspectionResult
+        SectionMeshesInspector::inspect_section_meshes(
+            const InspectionOptions& options ) const
+    {
+        const internal::InspectionStop stop{ options };
+        const internal::InspectionStopScope scope{ stop };
+        const internal::InspectionProgressScope progress{ options };
+        internal::CriteriaRunner runner{ options };
+        const auto counts = runner.is_profiled()
+                                ? internal::model_element_counts( section_ )
+                                : internal::ModelElementCounts{};
         SectionMeshesInspectionResult result;
-        async::parallel_invoke(
-            [&result, this] {
-                result.unique_vertices_colocation = inspect_unique_vertices();
-            },
-            [&result, this] {
-                result.meshes_colocation = inspect_meshes_point_colocations();
-            },
-            [&result, this] {
-                result.meshes_adjacencies =
-                    inspect_section_meshes_adjacencies();
-            },
-            [&result, this] {
-                result.meshes_degenerations = inspect_elements_degeneration();
-            },
-            [&result, this] {
-                result.meshes_intersections = inspect_intersections();
-            },
-            [&result, this] {
-                result.meshes_non_manifolds = inspect_section_manifold();
-            },
-            [&result, this] {
-                result.meshes_negative_elements = inspect_negative_elements();
-            } );
+        const auto colocation =
+            options.is_enabled( InspectionCriterion::colocation );
+        runner.run(
+            internal::criterion_task( colocation,
+                "unique vertices colocation", counts.unique_vertices,
+                [&result, this] {
+                    result.unique_vertices_colocation =
+                        inspect_unique_vertices();
+                } ),
+            internal::criterion_task( colocation, "meshes colocation",
+                counts.vertices,
+                [&result, this] {
+                    result.meshes_colocation =
+                        inspect_meshes_point_colocations();
+                } ),
+            internal::criterion_task(
+                options.is_enabled( InspectionCriterion::adjacency ),
+                "adjacency", counts.polygons,
+                [&result, this] {
+                    result.meshes_adjacencies =
+                        inspect_section_meshes_adjacencies();
+                } ),
+            internal::criterion_task(
+                options.is_enabled( InspectionCriterion::degeneration ),
+                "degeneration", counts.edges + counts.polygons,
+                [&result, this] {
+                    result.meshes_degenerations =
+                        inspect_elements_degeneration();
+                } ),
+            internal::criterion_task(
+                options.is_enabled( InspectionCriterion::intersections ),
+                "intersections", counts.polygons,
+                [&result, this] {
+                    result.meshes_intersections = inspect_intersections();
+                } ),
+            internal::criterion_task(
+                options.is_enabled( InspectionCriterion::manifold ),
+                "manifold", counts.polygons,
+                [&result, this] {
+                    result.meshes_non_manifolds = inspect_section_manifold();
+                } ),
+            internal::criterion_task(
+                options.is_enabled( InspectionCriterion::negative_elements ),
+                "negative elements", counts.polygons,
+                [&result, this] {
+                    result.meshes_negative_elements =
+                        inspect_negative_elements();
+                } ) );
+        result.status = stop.status();
+        result.profile = runner.profile();
         return result;
     }
 } // namespace geode
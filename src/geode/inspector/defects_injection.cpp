@@ -0,0 +1,719 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/inspector/defects_injection.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <optional>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <absl/container/flat_hash_set.h>
+
+#include <geode/basic/assert.hpp>
+
+#include <geode/geometry/bounding_box.hpp>
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/builder/tetrahedral_solid_builder.hpp>
+#include <geode/mesh/builder/triangulated_surface_builder.hpp>
+#include <geode/mesh/core/tetrahedral_solid.hpp>
+#include <geode/mesh/core/triangulated_surface.hpp>
+
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/line.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+#include <geode/model/mixin/core/vertex_identifier.hpp>
+#include <geode/model/representation/builder/brep_builder.hpp>
+#include <geode/model/representation/core/brep.hpp>
+
+#include <geode/inspector/topology/internal/topology_helpers.hpp>
+
+namespace
+{
+    /*!
+     * Random draws relying on the std::mt19937 sequence only, which is
+     * fixed by the standard, unlike the std distributions.
+     */
+    class RandomGenerator
+    {
+    public:
+        explicit RandomGenerator( geode::index_t seed ) : engine_{ seed } {}
+
+        /*!
+         * Returns a number in [0, 1).
+         */
+        double ratio()
+        {
+            return static_cast< double >( engine_() ) / 4294967296.;
+        }
+
+        /*!
+         * Returns an index in [0, nb_values).
+         */
+        geode::index_t index( geode::index_t nb_values )
+        {
+            return static_cast< geode::index_t >( ratio() * nb_values );
+        }
+
+        /*!
+         * Returns nb_draws distinct indices in [0, nb_values), using
+         * Floyd's sampling algorithm.
+         */
+        std::vector< geode::index_t > distinct_indices(
+            geode::index_t nb_draws, geode::index_t nb_values )
+        {
+            OPENGEODE_EXCEPTION( nb_draws <= nb_values,
+                "[inject_defects] Cannot draw ", nb_draws,
+                " distinct values among ", nb_values );
+            std::vector< geode::index_t > draws;
+            draws.reserve( nb_draws );
+            absl::flat_hash_set< geode::index_t > drawn;
+            drawn.reserve( nb_draws );
+            for( const auto value :
+                geode::Range{ nb_values - nb_draws, nb_values } )
+            {
+                auto draw = index( value + 1 );
+                if( !drawn.insert( draw ).second )
+                {
+                    draw = value;
+                    drawn.insert( draw );
+                }
+                draws.push_back( draw );
+            }
+            return draws;
+        }
+
+    private:
+        std::mt19937 engine_;
+    };
+
+    template < typename Functor >
+    void repeat( geode::index_t nb_times, const Functor& functor )
+    {
+        for( geode::index_t count = 0; count < nb_times; count++ )
+        {
+            functor();
+        }
+    }
+
+    geode::index_t nb_element_defects( const geode::InjectedDefects& defects )
+    {
+        return defects.nb_degenerated_elements + defects.nb_negative_elements
+               + defects.nb_non_manifold_elements + defects.nb_intersections;
+    }
+
+    /*!
+     * Regular grid of cubic cells laid out next to the maximum x side of a
+     * bounding box, each defect being created in its own random cell.
+     */
+    template < geode::index_t dimension >
+    class DefectsLayout
+    {
+    public:
+        DefectsLayout( const geode::BoundingBox< dimension >& box,
+            geode::index_t nb_defects,
+            RandomGenerator& random )
+            : random_( random ), origin_( box.min() )
+        {
+            double extent{ 0 };
+            for( const auto axis : geode::LRange{ dimension } )
+            {
+                extent = std::max(
+                    extent, box.max().value( axis ) - box.min().value( axis ) );
+            }
+            if( extent <= 0 )
+            {
+                extent = 1;
+            }
+            nb_axis_cells_ = std::max( geode::index_t{ 1 },
+                static_cast< geode::index_t >(
+                    std::ceil( std::pow( nb_defects, 1. / dimension ) ) ) );
+            while( nb_cells() < nb_defects )
+            {
+                nb_axis_cells_++;
+            }
+            cell_size_ = extent / nb_axis_cells_;
+            origin_.set_value( 0, box.max().value( 0 ) + cell_size_ );
+            cells_ = random_.distinct_indices( nb_defects, nb_cells() );
+        }
+
+        /*!
+         * Size of the defects, so that a defect spanning up to twice this
+         * size around its anchor stays in its cell.
+         */
+        double defect_size() const
+        {
+            return cell_size_ / 8;
+        }
+
+        /*!
+         * Returns a random point in the next free cell, at least a quarter
+         * of the cell size away from the cell minimum corner.
+         */
+        geode::Point< dimension > next_anchor()
+        {
+            OPENGEODE_EXCEPTION( next_cell_ < cells_.size(),
+                "[inject_defects] No more free cells for defects" );
+            auto cell = cells_[next_cell_++];
+            auto anchor = origin_;
+            for( const auto axis : geode::LRange{ dimension } )
+            {
+                const auto axis_cell = cell % nb_axis_cells_;
+                cell /= nb_axis_cells_;
+                anchor.set_value( axis,
+                    origin_.value( axis )
+                        + cell_size_
+                              * ( axis_cell + 0.25 + 0.25 * random_.ratio() ) );
+            }
+            return anchor;
+        }
+
+    private:
+        geode::index_t nb_cells() const
+        {
+            return dimension == 2
+                       ? nb_axis_cells_ * nb_axis_cells_
+                       : nb_axis_cells_ * nb_axis_cells_ * nb_axis_cells_;
+        }
+
+    private:
+        RandomGenerator& random_;
+        geode::Point< dimension > origin_;
+        geode::index_t nb_axis_cells_{ 1 };
+        double cell_size_{ 1 };
+        std::vector< geode::index_t > cells_;
+        geode::index_t next_cell_{ 0 };
+    };
+
+    template < geode::index_t dimension, typename Mesh, typename Builder >
+    class DefectsInjector
+    {
+    public:
+        DefectsInjector( const Mesh& mesh,
+            Builder& builder,
+            DefectsLayout< dimension >& layout,
+            RandomGenerator& random )
+            : mesh_( mesh ), builder_( builder ), layout_( layout ),
+              random_( random )
+        {
+        }
+
+        void inject_colocated_points( geode::index_t nb_points )
+        {
+            for( const auto vertex :
+                random_.distinct_indices( nb_points, mesh_.nb_vertices() ) )
+            {
+                builder_.create_point(
+                    geode::Point< dimension >{ mesh_.point( vertex ) } );
+            }
+        }
+
+    protected:
+        /*!
+         * Creates the vertex at anchor + defect_size * offset, the offset
+         * third coordinate being ignored in 2D.
+         */
+        geode::index_t create_point( const geode::Point< dimension >& anchor,
+            const std::array< double, 3 >& offset )
+        {
+            auto point = anchor;
+            for( const auto axis : geode::LRange{ dimension } )
+            {
+                point.set_value( axis, anchor.value( axis )
+                                           + layout_.defect_size()
+                                                 * offset[axis] );
+            }
+            return builder_.create_point( std::move( point ) );
+        }
+
+        Builder& builder()
+        {
+            return builder_;
+        }
+
+        DefectsLayout< dimension >& layout()
+        {
+            return layout_;
+        }
+
+    private:
+        const Mesh& mesh_;
+        Builder& builder_;
+        DefectsLayout< dimension >& layout_;
+        RandomGenerator& random_;
+    };
+
+    template < geode::index_t dimension >
+    class SurfaceDefectsInjector
+        : public DefectsInjector< dimension,
+              geode::TriangulatedSurface< dimension >,
+              geode::TriangulatedSurfaceBuilder< dimension > >
+    {
+    public:
+        using DefectsInjector< dimension,
+            geode::TriangulatedSurface< dimension >,
+            geode::TriangulatedSurfaceBuilder< dimension > >::DefectsInjector;
+
+        void inject( const geode::InjectedDefects& defects )
+        {
+            OPENGEODE_EXCEPTION( defects.nb_topology_violations == 0,
+                "[inject_surface_defects] Topology violations can only be "
+                "injected in models" );
+            OPENGEODE_EXCEPTION(
+                dimension == 2 || defects.nb_negative_elements == 0,
+                "[inject_surface_defects] Negative elements can only be "
+                "injected in 2D surfaces" );
+            this->inject_colocated_points( defects.nb_colocated_points );
+            repeat( defects.nb_degenerated_elements, [this] {
+                inject_degenerated_triangle();
+            } );
+            repeat( defects.nb_negative_elements, [this] {
+                inject_negative_triangle();
+            } );
+            repeat( defects.nb_non_manifold_elements, [this] {
+                inject_non_manifold_edge();
+            } );
+            repeat( defects.nb_intersections, [this] {
+                inject_intersection();
+            } );
+        }
+
+    private:
+        void inject_degenerated_triangle()
+        {
+            const auto anchor = this->layout().next_anchor();
+            const auto v0 = this->create_point( anchor, { 0, 0, 0 } );
+            const auto v1 = this->create_point( anchor, { 1, 0, 0 } );
+            const auto v2 = this->create_point( anchor, { 2, 0, 0 } );
+            this->builder().create_triangle( { v0, v1, v2 } );
+        }
+
+        void inject_negative_triangle()
+        {
+            const auto anchor = this->layout().next_anchor();
+            const auto v0 = this->create_point( anchor, { 0, 0, 0 } );
+            const auto v1 = this->create_point( anchor, { 0, 1, 0 } );
+            const auto v2 = this->create_point( anchor, { 1, 0, 0 } );
+            this->builder().create_triangle( { v0, v1, v2 } );
+        }
+
+        void inject_non_manifold_edge()
+        {
+            const auto anchor = this->layout().next_anchor();
+            const auto v0 = this->create_point( anchor, { 0, 0, 0 } );
+            const auto v1 = this->create_point( anchor, { 1, 0, 0 } );
+            const auto above = this->create_point( anchor, { 0, 1, 0 } );
+            const auto below = this->create_point( anchor, { 0, -1, 0 } );
+            const auto third = this->create_point( anchor, { 0.5, 2, 1 } );
+            this->builder().create_triangle( { v0, v1, above } );
+            this->builder().create_triangle( { v1, v0, below } );
+            this->builder().create_triangle( { v0, v1, third } );
+        }
+
+        void inject_intersection()
+        {
+            const auto anchor = this->layout().next_anchor();
+            const auto v0 = this->create_point( anchor, { 0, 0, 0 } );
+            const auto v1 = this->create_point( anchor, { 1, 0, 0 } );
+            const auto v2 = this->create_point( anchor, { 0, 1, 0 } );
+            this->builder().create_triangle( { v0, v1, v2 } );
+            if( dimension == 2 )
+            {
+                const auto w0 = this->create_point( anchor, { 0.25, 0.25, 0 } );
+                const auto w1 = this->create_point( anchor, { 1.25, 0.25, 0 } );
+                const auto w2 = this->create_point( anchor, { 0.25, 1.25, 0 } );
+                this->builder().create_triangle( { w0, w1, w2 } );
+            }
+            else
+            {
+                const auto w0 =
+                    this->create_point( anchor, { 0.25, 0.25, -0.5 } );
+                const auto w1 = this->create_point( anchor, { 2, 2, 0 } );
+                const auto w2 =
+                    this->create_point( anchor, { 0.25, 0.25, 0.5 } );
+                this->builder().create_triangle( { w0, w1, w2 } );
+            }
+        }
+    };
+
+    class SolidDefectsInjector
+        : public DefectsInjector< 3,
+              geode::TetrahedralSolid3D,
+              geode::TetrahedralSolidBuilder3D >
+    {
+    public:
+        using DefectsInjector< 3,
+            geode::TetrahedralSolid3D,
+            geode::TetrahedralSolidBuilder3D >::DefectsInjector;
+
+        void inject( const geode::InjectedDefects& defects )
+        {
+            OPENGEODE_EXCEPTION( defects.nb_topology_violations == 0,
+                "[inject_solid_defects] Topology violations can only be "
+                "injected in models" );
+            OPENGEODE_EXCEPTION( defects.nb_intersections == 0,
+                "[inject_solid_defects] Intersections can only be injected "
+                "in surfaces" );
+            inject_colocated_points( defects.nb_colocated_points );
+            repeat( defects.nb_degenerated_elements, [this] {
+                inject_degenerated_tetrahedron();
+            } );
+            repeat( defects.nb_negative_elements, [this] {
+                inject_negative_tetrahedron();
+            } );
+            repeat( defects.nb_non_manifold_elements, [this] {
+                inject_non_manifold_facet();
+            } );
+        }
+
+    private:
+        void inject_degenerated_tetrahedron()
+        {
+            const auto anchor = layout().next_anchor();
+            const auto v0 = create_point( anchor, { 0, 0, 0 } );
+            const auto v1 = create_point( anchor, { 1, 0, 0 } );
+            const auto v2 = create_point( anchor, { 0, 1, 0 } );
+            const auto v3 = create_point( anchor, { 1, 1, 0 } );
+            builder().create_tetrahedron( { v0, v1, v2, v3 } );
+        }
+
+        void inject_negative_tetrahedron()
+        {
+            const auto anchor = layout().next_anchor();
+            const auto v0 = create_point( anchor, { 0, 0, 0 } );
+            const auto v1 = create_point( anchor, { 1, 0, 0 } );
+            const auto v2 = create_point( anchor, { 0, 1, 0 } );
+            const auto v3 = create_point( anchor, { 0, 0, -1 } );
+            builder().create_tetrahedron( { v0, v1, v2, v3 } );
+        }
+
+        void inject_non_manifold_facet()
+        {
+            const auto anchor = layout().next_anchor();
+            const auto v0 = create_point( anchor, { 0, 0, 0 } );
+            const auto v1 = create_point( anchor, { 1, 0, 0 } );
+            const auto v2 = create_point( anchor, { 0, 1, 0 } );
+            const auto above = create_point( anchor, { 0.25, 0.25, 1 } );
+            const auto below = create_point( anchor, { 0.25, 0.25, -1 } );
+            const auto third = create_point( anchor, { 0.25, 0.25, 2 } );
+            builder().create_tetrahedron( { v0, v1, v2, above } );
+            builder().create_tetrahedron( { v0, v2, v1, below } );
+            builder().create_tetrahedron( { v0, v1, v2, third } );
+        }
+    };
+
+    void link_new_vertices( geode::BRepBuilder& builder,
+        const geode::ComponentID& component_id,
+        geode::index_t first_new_vertex,
+        geode::index_t nb_vertices )
+    {
+        if( first_new_vertex == nb_vertices )
+        {
+            return;
+        }
+        const auto first_unique_vertex =
+            builder.create_unique_vertices( nb_vertices - first_new_vertex );
+        for( const auto vertex : geode::Range{ first_new_vertex, nb_vertices } )
+        {
+            builder.set_unique_vertex( { component_id, vertex },
+                first_unique_vertex + vertex - first_new_vertex );
+        }
+    }
+
+    /*!
+     * Mesh vertices of a unique vertex, sorted by component kind.
+     */
+    struct UniqueVertexMeshVertices
+    {
+        explicit UniqueVertexMeshVertices(
+            const std::vector< geode::ComponentMeshVertex >& mesh_vertices )
+        {
+            for( const auto& mesh_vertex : mesh_vertices )
+            {
+                const auto& type = mesh_vertex.component_id.type();
+                if( type == geode::Line3D::component_type_static() )
+                {
+                    lines.push_back( mesh_vertex );
+                }
+                else if( type == geode::Surface3D::component_type_static() )
+                {
+                    surfaces.push_back( mesh_vertex );
+                }
+                else if( type == geode::Block3D::component_type_static() )
+                {
+                    blocks.push_back( mesh_vertex );
+                }
+                else
+                {
+                    corners.push_back( mesh_vertex );
+                }
+            }
+        }
+
+        std::vector< geode::ComponentMeshVertex > lines;
+        std::vector< geode::ComponentMeshVertex > surfaces;
+        std::vector< geode::ComponentMeshVertex > blocks;
+        std::vector< geode::ComponentMeshVertex > corners;
+    };
+
+    /*!
+     * Returns the line mesh vertex of a unique vertex only linked to this
+     * line and to two distinct surfaces it bounds, on their mesh border.
+     * Once detached, the unique vertex left is part of several surfaces and
+     * of no line.
+     */
+    std::optional< geode::ComponentMeshVertex > detachable_line_vertex(
+        const geode::BRep& brep, const UniqueVertexMeshVertices& vertices )
+    {
+        if( vertices.lines.size() != 1 || vertices.surfaces.size() != 2
+            || !vertices.blocks.empty() || !vertices.corners.empty() )
+        {
+            return std::nullopt;
+        }
+        const auto& line_id = vertices.lines.front().component_id.id();
+        if( brep.nb_embeddings( line_id ) != 0
+            || vertices.surfaces[0].component_id
+                   == vertices.surfaces[1].component_id )
+        {
+            return std::nullopt;
+        }
+        for( const auto& surface_vertex : vertices.surfaces )
+        {
+            const auto& surface_id = surface_vertex.component_id.id();
+            if( !brep.Relationships::is_boundary( line_id, surface_id )
+                || !brep.surface( surface_id )
+                        .mesh()
+                        .is_vertex_on_border( surface_vertex.vertex ) )
+            {
+                return std::nullopt;
+            }
+        }
+        return vertices.lines.front();
+    }
+
+    /*!
+     * Returns the surface mesh vertex of a unique vertex only linked to
+     * this surface and to two distinct blocks it bounds. Once detached, the
+     * unique vertex left is part of two blocks and of no boundary surface.
+     */
+    std::optional< geode::ComponentMeshVertex > detachable_surface_vertex(
+        const geode::BRep& brep, const UniqueVertexMeshVertices& vertices )
+    {
+        if( !vertices.lines.empty() || vertices.surfaces.size() != 1
+            || vertices.blocks.size() != 2 || !vertices.corners.empty() )
+        {
+            return std::nullopt;
+        }
+        const auto& surface_id = vertices.surfaces.front().component_id.id();
+        if( brep.nb_embeddings( surface_id ) != 0
+            || vertices.blocks[0].component_id
+                   == vertices.blocks[1].component_id )
+        {
+            return std::nullopt;
+        }
+        for( const auto& block_vertex : vertices.blocks )
+        {
+            if( !brep.Relationships::is_boundary(
+                    surface_id, block_vertex.component_id.id() ) )
+            {
+                return std::nullopt;
+            }
+        }
+        return vertices.surfaces.front();
+    }
+
+    void inject_topology_violations( const geode::BRep& brep,
+        geode::BRepBuilder& builder,
+        RandomGenerator& random,
+        geode::index_t nb_violations )
+    {
+        if( nb_violations == 0 )
+        {
+            return;
+        }
+        const auto blocks_are_meshed =
+            geode::internal::brep_blocks_are_meshed( brep );
+        std::vector< geode::ComponentMeshVertex > detachable_vertices;
+        for( const auto unique_vertex :
+            geode::Range{ brep.nb_unique_vertices() } )
+        {
+            const UniqueVertexMeshVertices vertices{
+                brep.component_mesh_vertices( unique_vertex )
+            };
+            const auto detachable_vertex =
+                blocks_are_meshed ? detachable_surface_vertex( brep, vertices )
+                                  : detachable_line_vertex( brep, vertices );
+            if( detachable_vertex )
+            {
+                detachable_vertices.push_back( detachable_vertex.value() );
+            }
+        }
+        const auto draws = random.distinct_indices( nb_violations,
+            static_cast< geode::index_t >( detachable_vertices.size() ) );
+        const auto first_unique_vertex =
+            builder.create_unique_vertices( nb_violations );
+        for( const auto violation : geode::Indices{ draws } )
+        {
+            builder.set_unique_vertex( detachable_vertices[draws[violation]],
+                first_unique_vertex + violation );
+        }
+    }
+
+    /*!
+     * Spreads each defect of the given kind over randomly chosen
+     * components.
+     */
+    void spread_defects( std::vector< geode::InjectedDefects >& components,
+        geode::index_t nb_defects,
+        geode::index_t geode::InjectedDefects::*kind,
+        RandomGenerator& random )
+    {
+        if( nb_defects == 0 )
+        {
+            return;
+        }
+        OPENGEODE_EXCEPTION( !components.empty(),
+            "[inject_brep_defects] No component can hold the defects" );
+        repeat( nb_defects, [&components, kind, &random] {
+            auto& component = components[random.index(
+                static_cast< geode::index_t >( components.size() ) )];
+            component.*kind += 1;
+        } );
+    }
+} // namespace
+
+namespace geode
+{
+    template < index_t dimension >
+    void inject_surface_defects(
+        TriangulatedSurface< dimension >& surface,
+        const InjectedDefects& defects )
+    {
+        OPENGEODE_EXCEPTION( surface.nb_vertices() != 0,
+            "[inject_surface_defects] Cannot inject defects in an empty "
+            "surface" );
+        RandomGenerator random{ defects.seed };
+        DefectsLayout< dimension > layout{ surface.bounding_box(),
+            nb_element_defects( defects ), random };
+        auto builder =
+            TriangulatedSurfaceBuilder< dimension >::create( surface );
+        SurfaceDefectsInjector< dimension > injector{ surface, *builder,
+            layout, random };
+        injector.inject( defects );
+    }
+
+    void inject_solid_defects(
+        TetrahedralSolid3D& solid, const InjectedDefects& defects )
+    {
+        OPENGEODE_EXCEPTION( solid.nb_vertices() != 0,
+            "[inject_solid_defects] Cannot inject defects in an empty "
+            "solid" );
+        RandomGenerator random{ defects.seed };
+        DefectsLayout< 3 > layout{ solid.bounding_box(),
+            nb_element_defects( defects ), random };
+        auto builder = TetrahedralSolidBuilder3D::create( solid );
+        SolidDefectsInjector injector{ solid, *builder, layout, random };
+        injector.inject( defects );
+    }
+
+    void inject_brep_defects( BRep& brep, const InjectedDefects& defects )
+    {
+        RandomGenerator random{ defects.seed };
+        DefectsLayout< 3 > layout{ brep.bounding_box(),
+            nb_element_defects( defects ), random };
+        BRepBuilder builder{ brep };
+        inject_topology_violations(
+            brep, builder, random, defects.nb_topology_violations );
+        std::vector< uuid > surfaces;
+        for( const auto& surface : brep.surfaces() )
+        {
+            if( dynamic_cast< const TriangulatedSurface3D* >( &surface.mesh() )
+                && surface.mesh().nb_vertices() != 0 )
+            {
+                surfaces.push_back( surface.id() );
+            }
+        }
+        std::vector< uuid > blocks;
+        for( const auto& block : brep.blocks() )
+        {
+            if( dynamic_cast< const TetrahedralSolid3D* >( &block.mesh() )
+                && block.mesh().nb_vertices() != 0 )
+            {
+                blocks.push_back( block.id() );
+            }
+        }
+        std::vector< InjectedDefects > surfaces_defects( surfaces.size() );
+        spread_defects( surfaces_defects, defects.nb_colocated_points,
+            &InjectedDefects::nb_colocated_points, random );
+        spread_defects( surfaces_defects, defects.nb_degenerated_elements,
+            &InjectedDefects::nb_degenerated_elements, random );
+        spread_defects( surfaces_defects, defects.nb_non_manifold_elements,
+            &InjectedDefects::nb_non_manifold_elements, random );
+        spread_defects( surfaces_defects, defects.nb_intersections,
+            &InjectedDefects::nb_intersections, random );
+        std::vector< InjectedDefects > blocks_defects( blocks.size() );
+        spread_defects( blocks_defects, defects.nb_negative_elements,
+            &InjectedDefects::nb_negative_elements, random );
+        for( const auto surface_id : Indices{ surfaces } )
+        {
+            const auto& surface = brep.surface( surfaces[surface_id] );
+            const auto& mesh = surface.get_mesh< TriangulatedSurface3D >();
+            const auto first_new_vertex = mesh.nb_vertices();
+            {
+                auto mesh_builder =
+                    builder.surface_mesh_builder< TriangulatedSurface3D >(
+                        surface.id() );
+                SurfaceDefectsInjector< 3 > injector{ mesh, *mesh_builder,
+                    layout, random };
+                injector.inject( surfaces_defects[surface_id] );
+            }
+            link_new_vertices( builder, surface.component_id(),
+                first_new_vertex, mesh.nb_vertices() );
+        }
+        for( const auto block_id : Indices{ blocks } )
+        {
+            const auto& block = brep.block( blocks[block_id] );
+            const auto& mesh = block.get_mesh< TetrahedralSolid3D >();
+            const auto first_new_vertex = mesh.nb_vertices();
+            {
+                auto mesh_builder =
+                    builder.block_mesh_builder< TetrahedralSolid3D >(
+                        block.id() );
+                SolidDefectsInjector injector{ mesh, *mesh_builder, layout,
+                    random };
+                injector.inject( blocks_defects[block_id] );
+            }
+            link_new_vertices( builder, block.component_id(),
+                first_new_vertex, mesh.nb_vertices() );
+        }
+    }
+
+    template void opengeode_inspector_inspector_api inject_surface_defects(
+        TriangulatedSurface< 2 >&, const InjectedDefects& );
+    template void opengeode_inspector_inspector_api inject_surface_defects(
+        TriangulatedSurface< 3 >&, const InjectedDefects& );
+} // namespace geode
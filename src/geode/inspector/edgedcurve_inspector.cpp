@@ -23,10 +23,10 @@
 
 #include <geode/inspector/edgedcurve_inspector.hpp>
 
-#include <async++.h>
-
 #include <geode/mesh/core/edged_curve.hpp>
 
+#include <geode/inspector/internal/inspection_scheduler.hpp>
+
 namespace geode
 {
     index_t EdgedCurveInspectionResult::nb_issues() const
@@ -60,7 +60,7 @@ namespace geode
         EdgedCurveInspector< dimension >::inspect_edged_curve() const
     {
         EdgedCurveInspectionResult result;
-        async::parallel_invoke(
+        internal::parallel_invoke(
             [&result, this] {
                 result.colocated_points_groups =
                     this->colocated_points_groups();
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/inspector/inspection_context.hpp>
+
+#include <vector>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <geode/basic/assert.hpp>
+#include <geode/basic/pimpl_impl.hpp>
+#include <geode/basic/range.hpp>
+#include <geode/basic/uuid.hpp>
+
+#include <geode/mesh/core/edged_curve.hpp>
+#include <geode/mesh/core/point_set.hpp>
+#include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/corner.hpp>
+#include <geode/model/mixin/core/line.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+#include <geode/model/representation/core/brep.hpp>
+#include <geode/model/representation/core/section.hpp>
+
+#include <geode/inspector/internal/inspected_components.hpp>
+#include <geode/inspector/internal/inspection_progress.hpp>
+#include <geode/inspector/internal/inspection_scheduler.hpp>
+#include <geode/inspector/internal/inspection_stop.hpp>
+
+namespace geode
+{
+    template < typename Model >
+    class InspectionContext< Model >::Impl
+    {
+    public:
+        /*!
+         * The stop of the inspection is not forwarded: a component skipped
+         * on an expired deadline would have no mapping for the criteria.
+         */
+        Impl( const Model& model ) : model_( model )
+        {
+            const internal::ProgressScope progress{ "inspection context" };
+            add_components( model.corners() );
+            add_components( model.lines() );
+            add_components( model.surfaces() );
+            add_blocks( model );
+            const internal::InspectionStop never_requested;
+            const internal::InspectionStopScope stop_scope{ never_requested };
+            internal::parallel_invoke(
+                [this] {
+                    build_unique_vertices( model_.corners() );
+                },
+                [this] {
+                    build_unique_vertices( model_.lines() );
+                },
+                [this] {
+                    build_unique_vertices( model_.surfaces() );
+                },
+                [this] {
+                    build_blocks_unique_vertices( model_ );
+                } );
+        }
+
+        absl::Span< const index_t > component_unique_vertices(
+            const ComponentID& component_id ) const
+        {
+            const auto it = components_.find( component_id.id() );
+            OPENGEODE_EXCEPTION( it != components_.end(),
+                "[InspectionContext] Unknown component ",
+                component_id.id().string() );
+            return it->second;
+        }
+
+    private:
+        /*!
+         * One task per component. The map is filled beforehand so that each
+         * task only writes the mapping of its own component.
+         */
+        template < typename ComponentRange >
+        void build_unique_vertices( ComponentRange&& components )
+        {
+            const auto sorted_components =
+                internal::inspected_components_by_decreasing_size(
+                    components, internal::InspectedComponents{} );
+            internal::parallel_for_components( sorted_components,
+                "inspection context",
+                [&sorted_components, this]( std::size_t id ) {
+                    const auto& component = *sorted_components[id];
+                    const auto nb_vertices = component.mesh().nb_vertices();
+                    auto& unique_vertices =
+                        components_.find( component.id() )->second;
+                    unique_vertices.reserve( nb_vertices );
+                    for( const auto vertex : Range{ nb_vertices } )
+                    {
+                        unique_vertices.push_back( model_.unique_vertex(
+                            { component.component_id(), vertex } ) );
+                    }
+                } );
+        }
+
+        void build_blocks_unique_vertices( const Section& /*section*/ ) {}
+
+        void build_blocks_unique_vertices( const BRep& brep )
+        {
+            build_unique_vertices( brep.blocks() );
+        }
+
+        template < typename ComponentRange >
+        void add_components( ComponentRange&& components )
+        {
+            for( const auto& component : components )
+            {
+                components_.emplace( component.id(), std::vector< index_t >{} );
+            }
+        }
+
+        void add_blocks( const Section& /*section*/ ) {}
+
+        void add_blocks( const BRep& brep )
+        {
+            add_components( brep.blocks() );
+        }
+
+    private:
+        const Model& model_;
+        absl::flat_hash_map< uuid, std::vector< index_t > > components_;
+    };
+
+    template < typename Model >
+    InspectionContext< Model >::InspectionContext( const Model& model )
+        : impl_( model )
+    {
+    }
+
+    template < typename Model >
+    InspectionContext< Model >::~InspectionContext() = default;
+
+    template < typename Model >
+    absl::Span< const index_t >
+        InspectionContext< Model >::component_unique_vertices(
+            const ComponentID& component_id ) const
+    {
+        return impl_->component_unique_vertices( component_id );
+    }
+
+    template class opengeode_inspector_inspector_api
+        InspectionContext< Section >;
+    template class opengeode_inspector_inspector_api InspectionContext< BRep >;
+} // namespace geode
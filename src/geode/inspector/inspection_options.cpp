@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#include <geode/inspector/inspection_options.hpp>
+
+namespace
+{
+    constexpr geode::index_t ALL_CRITERIA{ ( 1u << 7 ) - 1 };
+
+    constexpr geode::index_t criterion_bit(
+        geode::InspectionCriterion criterion )
+    {
+        return static_cast< geode::index_t >( criterion );
+    }
+} // namespace
+
+namespace geode
+{
+    InspectionCancellation::InspectionCancellation()
+        : cancelled_{ std::make_shared< std::atomic< bool > >( false ) }
+    {
+    }
+
+    void InspectionCancellation::cancel()
+    {
+        cancelled_->store( true, std::memory_order_relaxed );
+    }
+
+    bool InspectionCancellation::is_cancelled() const
+    {
+        return cancelled_->load( std::memory_order_relaxed );
+    }
+
+    InspectionOptions::InspectionOptions() : criteria_{ ALL_CRITERIA } {}
+
+    InspectionOptions InspectionOptions::no_criterion()
+    {
+        InspectionOptions options;
+        options.criteria_ = 0;
+        return options;
+    }
+
+    bool InspectionOptions::is_enabled( InspectionCriterion criterion ) const
+    {
+        return ( criteria_ & criterion_bit( criterion ) ) != 0;
+    }
+
+    InspectionOptions& InspectionOptions::enable(
+        InspectionCriterion criterion )
+    {
+        criteria_ |= criterion_bit( criterion );
+        return *this;
+    }
+
+    InspectionOptions& InspectionOptions::disable(
+        InspectionCriterion criterion )
+    {
+        criteria_ &= ~criterion_bit( criterion );
+        return *this;
+    }
+
+    InspectionOptions& InspectionOptions::set_enabled(
+        InspectionCriterion criterion, bool enabled )
+    {
+        return enabled ? enable( criterion ) : disable( criterion );
+    }
+
+    std::optional< std::chrono::steady_clock::time_point >
+        InspectionOptions::deadline() const
+    {
+        return deadline_;
+    }
+
+    InspectionOptions& InspectionOptions::set_deadline(
+        std::chrono::steady_clock::time_point deadline )
+    {
+        deadline_ = deadline;
+        return *this;
+    }
+
+    InspectionOptions& InspectionOptions::set_time_limit(
+        std::chrono::milliseconds limit )
+    {
+        return set_deadline( std::chrono::steady_clock::now() + limit );
+    }
+
+    const std::optional< InspectionCancellation >&
+        InspectionOptions::cancellation() const
+    {
+        return cancellation_;
+    }
+
+    InspectionOptions& InspectionOptions::set_cancellation(
+        InspectionCancellation cancellation )
+    {
+        cancellation_ = std::move( cancellation );
+        return *this;
+    }
+
+    bool InspectionOptions::is_profiled() const
+    {
+        return profiled_;
+    }
+
+    InspectionOptions& InspectionOptions::set_profiled( bool profiled )
+    {
+        profiled_ = profiled;
+        return *this;
+    }
+
+    const InspectionProgressCallback&
+        InspectionOptions::progress_callback() const
+    {
+        return progress_callback_;
+    }
+
+    InspectionOptions& InspectionOptions::set_progress_callback(
+        InspectionProgressCallback callback )
+    {
+        progress_callback_ = std::move( callback );
+        return *this;
+    }
+} // namespace geode
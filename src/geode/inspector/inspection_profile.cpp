@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#include <geode/inspector/inspection_profile.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+#include <absl/strings/str_cat.h>
+
+#include <geode/basic/range.hpp>
+
+namespace
+{
+    constexpr double BYTES_PER_MEGABYTE{ 1024. * 1024. };
+    constexpr geode::index_t NB_PRINTED_COMPONENTS{ 5 };
+} // namespace
+
+namespace geode
+{
+    double ComponentProfile::throughput() const
+    {
+        if( wall_time <= 0 )
+        {
+            return 0;
+        }
+        return nb_elements / wall_time;
+    }
+
+    double CriterionProfile::throughput() const
+    {
+        if( wall_time <= 0 )
+        {
+            return 0;
+        }
+        return nb_elements / wall_time;
+    }
+
+    bool InspectionProfile::empty() const
+    {
+        return criteria_.empty();
+    }
+
+    const std::vector< CriterionProfile >& InspectionProfile::criteria() const
+    {
+        return criteria_;
+    }
+
+    void InspectionProfile::add_criterion( CriterionProfile criterion )
+    {
+        criteria_.emplace_back( std::move( criterion ) );
+    }
+
+    void InspectionProfile::add_profile( InspectionProfile other )
+    {
+        criteria_.insert( criteria_.end(),
+            std::make_move_iterator( other.criteria_.begin() ),
+            std::make_move_iterator( other.criteria_.end() ) );
+    }
+
+    std::string InspectionProfile::string() const
+    {
+        if( criteria_.empty() )
+        {
+            return "Inspection not profiled\n";
+        }
+        std::string message{ "Inspection profile" };
+        for( const auto& criterion : criteria_ )
+        {
+            absl::StrAppend( &message, "\n ->    ", criterion.criterion,
+                ": ", criterion.wall_time, " s wall (",
+                criterion.critical_path, " s critical path), ",
+                criterion.cpu_time, " s CPU, ",
+                criterion.process_peak_memory / BYTES_PER_MEGABYTE,
+                " MB process peak (+",
+                criterion.process_peak_memory_increase / BYTES_PER_MEGABYTE,
+                " MB), ", criterion.nb_elements, " elements (",
+                criterion.throughput(), " elements/s)" );
+            const auto nb_printed = std::min(
+                static_cast< index_t >( criterion.components.size() ),
+                NB_PRINTED_COMPONENTS );
+            for( const auto index : Range{ nb_printed } )
+            {
+                const auto& component = criterion.components[index];
+                absl::StrAppend( &message, "\n ->        ", component.task,
+                    " ", component.component.string(), ": ",
+                    component.wall_time, " s wall, ", component.nb_elements,
+                    " elements" );
+            }
+        }
+        absl::StrAppend( &message, "\n" );
+        return message;
+    }
+
+    std::string InspectionProfile::csv() const
+    {
+        std::string csv{ "criterion,task,component,wall_time,cpu_time,"
+                         "critical_path,process_peak_memory,"
+                         "process_peak_memory_increase,nb_elements,"
+                         "throughput\n" };
+        for( const auto& criterion : criteria_ )
+        {
+            absl::StrAppend( &csv, criterion.criterion, ",,,",
+                criterion.wall_time, ",", criterion.cpu_time, ",",
+                criterion.critical_path, ",", criterion.process_peak_memory,
+                ",",
+                criterion.process_peak_memory_increase, ",",
+                criterion.nb_elements, ",", criterion.throughput(), "\n" );
+            for( const auto& component : criterion.components )
+            {
+                absl::StrAppend( &csv, criterion.criterion, ",",
+                    component.task, ",", component.component.string(), ",",
+                    component.wall_time, ",,,,,", component.nb_elements, ",",
+                    component.throughput(), "\n" );
+            }
+        }
+        return csv;
+    }
+} // namespace geode
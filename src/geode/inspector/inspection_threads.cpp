@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#include <geode/inspector/inspection_threads.hpp>
+
+#include <atomic>
+#include <memory>
+
+#include <geode/inspector/internal/inspection_scheduler.hpp>
+
+namespace
+{
+    std::unique_ptr< async::threadpool_scheduler > custom_scheduler;
+    std::atomic< async::threadpool_scheduler* > current_scheduler{ nullptr };
+    std::atomic< geode::index_t > nb_custom_threads{ 0 };
+} // namespace
+
+namespace geode
+{
+    void set_inspection_nb_threads( index_t nb_threads )
+    {
+        if( nb_threads == 0 )
+        {
+            current_scheduler = nullptr;
+            custom_scheduler.reset();
+        }
+        else
+        {
+            auto scheduler =
+                std::make_unique< async::threadpool_scheduler >( nb_threads );
+            current_scheduler = scheduler.get();
+            custom_scheduler = std::move( scheduler );
+        }
+        nb_custom_threads = nb_threads;
+    }
+
+    index_t inspection_nb_threads()
+    {
+        return nb_custom_threads;
+    }
+
+    namespace internal
+    {
+        async::threadpool_scheduler& inspection_scheduler()
+        {
+            if( auto* scheduler = current_scheduler.load() )
+            {
+                return *scheduler;
+            }
+            return async::default_threadpool_scheduler();
+        }
+    } // namespace internal
+} // namespace geode
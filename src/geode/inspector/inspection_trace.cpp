@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#include <geode/inspector/inspection_trace.hpp>
+
+#include <atomic>
+#include <mutex>
+
+#include <absl/container/btree_set.h>
+#include <absl/strings/str_cat.h>
+#include <absl/strings/str_join.h>
+
+#include <geode/inspector/internal/trace_scope.hpp>
+
+namespace
+{
+    struct TraceEvent
+    {
+        std::string category;
+        std::string name;
+        std::vector< std::string > components;
+        std::chrono::steady_clock::duration begin;
+        std::chrono::steady_clock::duration duration;
+        geode::index_t thread;
+    };
+
+    std::atomic< bool > trace_recording{ false };
+    std::mutex trace_mutex;
+    std::chrono::steady_clock::time_point trace_origin;
+    std::vector< TraceEvent > trace_events;
+    std::atomic< geode::index_t > nb_traced_threads{ 0 };
+
+    geode::index_t trace_thread()
+    {
+        thread_local const auto thread = nb_traced_threads++;
+        return thread;
+    }
+
+    std::string json_string( std::string_view value )
+    {
+        std::string json{ "\"" };
+        for( const auto character : value )
+        {
+            if( character == '"' || character == '\\' )
+            {
+                json.push_back( '\\' );
+            }
+            json.push_back( character );
+        }
+        json.push_back( '"' );
+        return json;
+    }
+
+    std::string json_microseconds( std::chrono::steady_clock::duration time )
+    {
+        const auto nanoseconds =
+            std::chrono::duration_cast< std::chrono::nanoseconds >( time )
+                .count();
+        return absl::StrCat( nanoseconds / 1000, ".",
+            absl::Dec( nanoseconds % 1000, absl::kZeroPad3 ) );
+    }
+
+    std::string json_event( const TraceEvent& event )
+    {
+        auto json = absl::StrCat( "{\"name\":", json_string( event.name ),
+            ",\"cat\":", json_string( event.category ),
+            ",\"ph\":\"X\",\"ts\":", json_microseconds( event.begin ),
+            ",\"dur\":", json_microseconds( event.duration ),
+            ",\"pid\":1,\"tid\":", event.thread );
+        if( !event.components.empty() )
+        {
+            absl::StrAppend( &json, ",\"args\":{\"components\":[" );
+            for( const auto& component : event.components )
+            {
+                if( &component != &event.components.front() )
+                {
+                    json.push_back( ',' );
+                }
+                absl::StrAppend( &json, json_string( component ) );
+            }
+            absl::StrAppend( &json, "]}" );
+        }
+        json.push_back( '}' );
+        return json;
+    }
+
+    std::string trace_json( const std::vector< TraceEvent >& events )
+    {
+        absl::btree_set< geode::index_t > threads;
+        for( const auto& event : events )
+        {
+            threads.insert( event.thread );
+        }
+        std::vector< std::string > json_events;
+        json_events.reserve( threads.size() + events.size() );
+        for( const auto thread : threads )
+        {
+            json_events.push_back( absl::StrCat(
+                "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":",
+                thread, ",\"args\":{\"name\":\"Inspection thread ", thread,
+                "\"}}" ) );
+        }
+        for( const auto& event : events )
+        {
+            json_events.push_back( json_event( event ) );
+        }
+        return absl::StrCat( "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n",
+            absl::StrJoin( json_events, ",\n" ), "\n]}\n" );
+    }
+} // namespace
+
+namespace geode
+{
+    void start_inspection_trace()
+    {
+        const std::lock_guard< std::mutex > lock{ trace_mutex };
+        trace_events.clear();
+        trace_origin = std::chrono::steady_clock::now();
+        trace_recording = true;
+    }
+
+    std::string stop_inspection_trace()
+    {
+        std::vector< TraceEvent > events;
+        {
+            const std::lock_guard< std::mutex > lock{ trace_mutex };
+            trace_recording = false;
+            events.swap( trace_events );
+        }
+        return trace_json( events );
+    }
+
+    namespace internal
+    {
+        TraceScope::TraceScope(
+            std::string_view category, std::string_view name )
+            : category_( category ),
+              name_( name ),
+              recording_( trace_recording.load( std::memory_order_relaxed ) )
+        {
+            if( recording_ )
+            {
+                begin_ = std::chrono::steady_clock::now();
+            }
+        }
+
+        TraceScope::TraceScope( std::string_view category,
+            std::string_view name,
+            absl::Span< const uuid > components )
+            : TraceScope( category, name )
+        {
+            if( !recording_ )
+            {
+                return;
+            }
+            for( const auto& component : components )
+            {
+                components_.push_back( component.string() );
+            }
+        }
+
+        TraceScope::~TraceScope()
+        {
+            if( !recording_ )
+            {
+                return;
+            }
+            const auto end = std::chrono::steady_clock::now();
+            const auto thread = trace_thread();
+            const std::lock_guard< std::mutex > lock{ trace_mutex };
+            if( !trace_recording || begin_ < trace_origin )
+            {
+                return;
+            }
+            trace_events.push_back( { std::string{ category_ },
+                std::string{ name_ }, std::move( components_ ),
+                begin_ - trace_origin, end - begin_, thread } );
+        }
+    } // namespace internal
+} // namespace geode
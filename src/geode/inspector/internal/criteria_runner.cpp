@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#include <geode/inspector/internal/criteria_runner.hpp>
+
+#include <absl/algorithm/container.h>
+
+#ifdef _WIN32
+#    include <windows.h>
+
+#    include <psapi.h>
+#else
+#    include <sys/resource.h>
+#endif
+
+#include <geode/mesh/core/edged_curve.hpp>
+#include <geode/mesh/core/point_set.hpp>
+#include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/corner.hpp>
+#include <geode/model/mixin/core/line.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+#include <geode/model/representation/core/brep.hpp>
+#include <geode/model/representation/core/section.hpp>
+
+namespace
+{
+    template < typename Model >
+    geode::internal::ModelElementCounts model_component_element_counts(
+        const Model& model )
+    {
+        geode::internal::ModelElementCounts counts;
+        counts.unique_vertices = model.nb_unique_vertices();
+        for( const auto& corner : model.corners() )
+        {
+            counts.vertices += corner.mesh().nb_vertices();
+        }
+        for( const auto& line : model.lines() )
+        {
+            counts.vertices += line.mesh().nb_vertices();
+            counts.edges += line.mesh().nb_edges();
+        }
+        for( const auto& surface : model.surfaces() )
+        {
+            counts.vertices += surface.mesh().nb_vertices();
+            counts.polygons += surface.mesh().nb_polygons();
+        }
+        return counts;
+    }
+} // namespace
+
+namespace geode
+{
+    namespace internal
+    {
+        CriteriaRunner::CriteriaRunner( const InspectionOptions& options )
+            : profiled_{ options.is_profiled() }
+        {
+        }
+
+        bool CriteriaRunner::is_profiled() const
+        {
+            return profiled_;
+        }
+
+        InspectionProfile CriteriaRunner::profile()
+        {
+            return std::move( profile_ );
+        }
+
+        CriteriaRunner::ResourceUsage CriteriaRunner::current_resource_usage()
+        {
+            ResourceUsage usage{ std::chrono::steady_clock::now(), 0, 0 };
+#ifdef _WIN32
+            FILETIME creation;
+            FILETIME exit;
+            FILETIME kernel;
+            FILETIME user;
+            if( GetProcessTimes(
+                    GetCurrentProcess(), &creation, &exit, &kernel, &user ) )
+            {
+                const auto to_seconds = []( const FILETIME& time ) {
+                    ULARGE_INTEGER ticks;
+                    ticks.LowPart = time.dwLowDateTime;
+                    ticks.HighPart = time.dwHighDateTime;
+                    return ticks.QuadPart * 1e-7;
+                };
+                usage.cpu_time = to_seconds( kernel ) + to_seconds( user );
+            }
+            PROCESS_MEMORY_COUNTERS memory;
+            if( GetProcessMemoryInfo(
+                    GetCurrentProcess(), &memory, sizeof( memory ) ) )
+            {
+                usage.process_peak_memory = memory.PeakWorkingSetSize;
+            }
+#else
+            rusage resources;
+            if( getrusage( RUSAGE_SELF, &resources ) == 0 )
+            {
+                const auto to_seconds = []( const timeval& time ) {
+                    return time.tv_sec + time.tv_usec * 1e-6;
+                };
+                usage.cpu_time = to_seconds( resources.ru_utime )
+                                 + to_seconds( resources.ru_stime );
+#    ifdef __APPLE__
+                usage.process_peak_memory = resources.ru_maxrss;
+#    else
+                usage.process_peak_memory =
+                    resources.ru_maxrss * std::size_t{ 1024 };
+#    endif
+            }
+#endif
+            return usage;
+        }
+
+        void CriteriaRunner::add_criterion( std::string_view name,
+            index_t nb_elements,
+            const ResourceUsage& start,
+            std::vector< ComponentProfile > components )
+        {
+            const auto end = current_resource_usage();
+            CriterionProfile criterion;
+            criterion.criterion = std::string{ name };
+            criterion.wall_time =
+                std::chrono::duration< double >( end.wall_time
+                                                 - start.wall_time )
+                    .count();
+            criterion.cpu_time = end.cpu_time - start.cpu_time;
+            criterion.process_peak_memory = end.process_peak_memory;
+            criterion.process_peak_memory_increase =
+                end.process_peak_memory - start.process_peak_memory;
+            criterion.nb_elements = nb_elements;
+            absl::c_sort( components, []( const ComponentProfile& lhs,
+                                          const ComponentProfile& rhs ) {
+                return lhs.wall_time > rhs.wall_time;
+            } );
+            if( !components.empty() )
+            {
+                criterion.critical_path = components.front().wall_time;
+            }
+            criterion.components = std::move( components );
+            profile_.add_criterion( std::move( criterion ) );
+        }
+
+        ModelElementCounts model_element_counts( const Section& section )
+        {
+            return model_component_element_counts( section );
+        }
+
+        ModelElementCounts model_element_counts( const BRep& brep )
+        {
+            auto counts = model_component_element_counts( brep );
+            for( const auto& block : brep.blocks() )
+            {
+                counts.vertices += block.mesh().nb_vertices();
+                counts.polyhedra += block.mesh().nb_polyhedra();
+            }
+            return counts;
+        }
+    } // namespace internal
+} // namespace geode
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#include <geode/inspector/internal/inspected_components.hpp>
+
+#include <geode/basic/algorithm.hpp>
+
+#include <geode/mesh/core/edged_curve.hpp>
+#include <geode/mesh/core/point_set.hpp>
+#include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/corner.hpp>
+#include <geode/model/mixin/core/line.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+#include <geode/model/representation/core/brep.hpp>
+
+namespace
+{
+    template < typename Component >
+    void add_component_unique_vertices( const geode::BRep& brep,
+        const Component& component,
+        std::vector< geode::index_t >& unique_vertices )
+    {
+        const auto& mesh = component.mesh();
+        for( const auto vertex : geode::Range{ mesh.nb_vertices() } )
+        {
+            const auto unique_vertex =
+                brep.unique_vertex( { component.component_id(), vertex } );
+            if( unique_vertex != geode::NO_ID )
+            {
+                unique_vertices.push_back( unique_vertex );
+            }
+        }
+    }
+} // namespace
+
+namespace geode
+{
+    namespace internal
+    {
+        std::vector< index_t > components_unique_vertices(
+            const BRep& brep, absl::Span< const uuid > components )
+        {
+            std::vector< index_t > unique_vertices;
+            for( const auto& component : components )
+            {
+                if( brep.has_corner( component ) )
+                {
+                    add_component_unique_vertices(
+                        brep, brep.corner( component ), unique_vertices );
+                }
+                else if( brep.has_line( component ) )
+                {
+                    add_component_unique_vertices(
+                        brep, brep.line( component ), unique_vertices );
+                }
+                else if( brep.has_surface( component ) )
+                {
+                    add_component_unique_vertices(
+                        brep, brep.surface( component ), unique_vertices );
+                }
+                else if( brep.has_block( component ) )
+                {
+                    add_component_unique_vertices(
+                        brep, brep.block( component ), unique_vertices );
+                }
+            }
+            sort_unique( unique_vertices );
+            return unique_vertices;
+        }
+
+        std::vector< index_t > components_unique_vertices( const BRep& brep,
+            absl::Span< const uuid > components,
+            absl::Span< const index_t > unique_vertices )
+        {
+            auto result = components_unique_vertices( brep, components );
+            for( const auto unique_vertex : unique_vertices )
+            {
+                if( unique_vertex < brep.nb_unique_vertices() )
+                {
+                    result.push_back( unique_vertex );
+                }
+            }
+            sort_unique( result );
+            return result;
+        }
+    } // namespace internal
+} // namespace geode
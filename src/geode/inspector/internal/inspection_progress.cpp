@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#include <geode/inspector/internal/inspection_progress.hpp>
+
+namespace
+{
+    thread_local const geode::internal::ProgressContext* thread_context{
+        nullptr
+    };
+
+    constexpr auto REPORT_INTERVAL =
+        std::chrono::duration_cast< std::chrono::steady_clock::duration >(
+            geode::InspectionOptions::PROGRESS_REPORT_INTERVAL )
+            .count();
+} // namespace
+
+namespace geode
+{
+    namespace internal
+    {
+        ProgressReporter::ProgressReporter(
+            InspectionProgressCallback callback )
+            : callback_{ std::move( callback ) }
+        {
+        }
+
+        void ProgressReporter::report( std::string_view criterion,
+            const uuid* component,
+            index_t nb_processed,
+            index_t nb_elements ) const
+        {
+            if( nb_processed == nb_elements )
+            {
+                {
+                    const std::lock_guard< std::mutex > lock{
+                        final_reports_mutex_
+                    };
+                    final_reports_.push_back( { std::string{ criterion },
+                        component ? std::optional< uuid >{ *component }
+                                  : std::nullopt,
+                        nb_elements } );
+                }
+                forward_final_reports();
+                return;
+            }
+            const auto now =
+                std::chrono::steady_clock::now().time_since_epoch().count();
+            if( now < next_report_.load( std::memory_order_relaxed ) )
+            {
+                return;
+            }
+            if( reporting_.test_and_set( std::memory_order_acquire ) )
+            {
+                return;
+            }
+            next_report_.store(
+                now + REPORT_INTERVAL, std::memory_order_relaxed );
+            InspectionProgress progress;
+            progress.criterion = criterion;
+            if( component )
+            {
+                progress.component = *component;
+            }
+            progress.nb_processed = nb_processed;
+            progress.nb_elements = nb_elements;
+            try
+            {
+                callback_( progress );
+            }
+            catch( ... )
+            {
+                reporting_.clear( std::memory_order_release );
+                throw;
+            }
+            reporting_.clear( std::memory_order_release );
+            forward_final_reports();
+        }
+
+        /*!
+         * A final report queued while another thread runs the callback is
+         * forwarded by that thread, which checks the queue again once it
+         * has released the callback.
+         */
+        void ProgressReporter::forward_final_reports() const
+        {
+            while( has_final_reports() )
+            {
+                if( reporting_.test_and_set( std::memory_order_acquire ) )
+                {
+                    return;
+                }
+                std::vector< FinalReport > final_reports;
+                {
+                    const std::lock_guard< std::mutex > lock{
+                        final_reports_mutex_
+                    };
+                    final_reports.swap( final_reports_ );
+                }
+                try
+                {
+                    for( const auto& final_report : final_reports )
+                    {
+                        InspectionProgress progress;
+                        progress.criterion = final_report.criterion;
+                        progress.component = final_report.component;
+                        progress.nb_processed = final_report.nb_elements;
+                        progress.nb_elements = final_report.nb_elements;
+                        callback_( progress );
+                    }
+                }
+                catch( ... )
+                {
+                    reporting_.clear( std::memory_order_release );
+                    throw;
+                }
+                reporting_.clear( std::memory_order_release );
+            }
+        }
+
+        bool ProgressReporter::has_final_reports() const
+        {
+            const std::lock_guard< std::mutex > lock{ final_reports_mutex_ };
+            return !final_reports_.empty();
+        }
+
+        const ProgressContext& current_progress_context()
+        {
+            static const ProgressContext no_progress;
+            if( thread_context )
+            {
+                return *thread_context;
+            }
+            return no_progress;
+        }
+
+        ProgressScope::ProgressScope( const ProgressContext& context )
+            : context_{ context }, previous_context_{ thread_context }
+        {
+            thread_context = &context_;
+        }
+
+        ProgressScope::ProgressScope( std::string_view criterion )
+            : ProgressScope{ current_progress_context() }
+        {
+            context_.criterion = criterion;
+            context_.component = nullptr;
+        }
+
+        ProgressScope::ProgressScope( const uuid& component )
+            : ProgressScope{ current_progress_context() }
+        {
+            context_.component = &component;
+        }
+
+        ProgressScope::~ProgressScope()
+        {
+            thread_context = previous_context_;
+        }
+
+        InspectionProgressScope::InspectionProgressScope(
+            const InspectionOptions& options )
+        {
+            if( !options.progress_callback()
+                || current_progress_context().reporter )
+            {
+                return;
+            }
+            reporter_.emplace( options.progress_callback() );
+            scope_.emplace( ProgressContext{ &*reporter_, {}, nullptr,
+                current_progress_context().profiler } );
+        }
+    } // namespace internal
+} // namespace geode
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#include <geode/inspector/internal/inspection_stop.hpp>
+
+namespace
+{
+    thread_local const geode::internal::InspectionStop* thread_stop{
+        nullptr
+    };
+} // namespace
+
+namespace geode
+{
+    namespace internal
+    {
+        InspectionStop::InspectionStop( const InspectionOptions& options )
+            : deadline_{ options.deadline() },
+              cancellation_{ options.cancellation() }
+        {
+        }
+
+        bool InspectionStop::is_requested() const
+        {
+            if( stopped_.load( std::memory_order_relaxed ) )
+            {
+                return true;
+            }
+            if( ( cancellation_ && cancellation_->is_cancelled() )
+                || ( deadline_
+                     && std::chrono::steady_clock::now() >= *deadline_ ) )
+            {
+                stopped_.store( true, std::memory_order_relaxed );
+                return true;
+            }
+            return false;
+        }
+
+        void InspectionStop::request() const
+        {
+            stopped_.store( true, std::memory_order_relaxed );
+        }
+
+        InspectionStatus InspectionStop::status() const
+        {
+            return stopped_.load() ? InspectionStatus::truncated
+                                   : InspectionStatus::complete;
+        }
+
+        const InspectionStop& current_inspection_stop()
+        {
+            static const InspectionStop never_requested;
+            if( thread_stop )
+            {
+                return *thread_stop;
+            }
+            return never_requested;
+        }
+
+        InspectionStopScope::InspectionStopScope( const InspectionStop& stop )
+            : previous_stop_{ thread_stop }
+        {
+            thread_stop = &stop;
+        }
+
+        InspectionStopScope::~InspectionStopScope()
+        {
+            thread_stop = previous_stop_;
+        }
+    } // namespace internal
+} // namespace geode
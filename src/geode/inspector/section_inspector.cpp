@@ -23,10 +23,12 @@
 
 #include <geode/inspector/section_inspector.hpp>
 
-#include <async++.h>
-
 #include <geode/model/representation/core/section.hpp>
 
+#include <geode/inspector/internal/criteria_runner.hpp>
+#include <geode/inspector/internal/inspection_stop.hpp>
+#include <geode/inspector/internal/parallel.hpp>
+
 namespace geode
 {
     index_t SectionInspectionResult::nb_issues() const
@@ -47,20 +49,76 @@ namespace geode
     SectionInspector::SectionInspector( const Section& section )
         : AddInspectors< Section,
               SectionMeshesInspector,
-              SectionTopologyInspector >{ section }
+              SectionTopologyInspector >{ section },
+          section_( section )
     {
     }
 
     SectionInspectionResult SectionInspector::inspect_section() const
     {
-        SectionInspectionResult result;
-        async::parallel_invoke(
-            [&result, this] {
-                result.meshes = inspect_section_meshes();
+        return inspect_section( InspectionOptions{} );
+    }
+
+    bool SectionInspector::is_valid() const
+    {
+        return is_valid( InspectionOptions{} );
+    }
+
+    bool SectionInspector::is_valid( const InspectionOptions& options ) const
+    {
+        const internal::InspectionStop stop{ options };
+        const internal::InspectionStopScope scope{ stop };
+        return internal::parallel_all_of(
+            [this] {
+                return section_topology_is_valid();
+            },
+            [this] {
+                return !model_has_unique_vertices_linked_to_different_points();
             },
-            [&result, this] {
-                result.topology = inspect_section_topology();
+            [this] {
+                return !model_has_wrong_adjacencies();
+            },
+            [this] {
+                return !model_has_degenerated_elements();
+            },
+            [this] {
+                return !model_has_negative_elements();
+            },
+            [this] {
+                return !model_has_non_manifold_elements();
+            },
+            [this] {
+                return !model_has_colocated_unique_vertices()
+                       && !model_has_colocated_points();
+            },
+            [this] {
+                return !model_has_intersecting_surfaces();
             } );
+    }
+
+    SectionInspectionResult SectionInspector::inspect_section(
+        const InspectionOptions& options ) const
+    {
+        const internal::InspectionStop stop{ options };
+        const internal::InspectionStopScope scope{ stop };
+        const internal::InspectionProgressScope progress{ options };
+        internal::CriteriaRunner runner{ options };
+        SectionInspectionResult result;
+        runner.run(
+            internal::unprofiled_task( [&result, &options, this] {
+                result.meshes = inspect_section_meshes( options );
+            } ),
+            internal::criterion_task(
+                options.is_enabled( InspectionCriterion::topology ),
+                "topology", section_.nb_unique_vertices(),
+                [&result, this] {
+                    result.topology = inspect_section_topology();
+                } ) );
+        result.status = result.meshes.status == InspectionStatus::truncated
+                            ? InspectionStatus::truncated
+                            : stop.status();
+        result.profile = result.meshes.profile;
+        result.profile.add_profile( runner.profile() );
         return result;
     }
 } // namespace geode
@@ -23,10 +23,11 @@
 
 #include <geode/inspector/solid_inspector.hpp>
 
-#include <async++.h>
-
 #include <geode/mesh/core/solid_mesh.hpp>
 
+#include <geode/inspector/internal/criteria_runner.hpp>
+#include <geode/inspector/internal/inspection_stop.hpp>
+
 namespace geode
 {
     index_t SolidInspectionResult::nb_issues() const
@@ -65,41 +66,78 @@ namespace geode
               SolidMeshVertexManifold< dimension >,
               SolidMeshEdgeManifold< dimension >,
               SolidMeshFacetManifold< dimension >,
-              SolidMeshNegativeElements< dimension > >{ mesh }
+              SolidMeshNegativeElements< dimension > >{ mesh },
+          mesh_( mesh )
     {
     }
 
     template < index_t dimension >
     SolidInspectionResult SolidMeshInspector< dimension >::inspect_solid() const
     {
+        return inspect_solid( InspectionOptions{} );
+    }
+
+    template < index_t dimension >
+    SolidInspectionResult SolidMeshInspector< dimension >::inspect_solid(
+        const InspectionOptions& options ) const
+    {
+        const internal::InspectionStop stop{ options };
+        const internal::InspectionStopScope scope{ stop };
+        const internal::InspectionProgressScope progress{ options };
+        internal::CriteriaRunner runner{ options };
+        const auto nb_polyhedra = mesh_.nb_polyhedra();
         SolidInspectionResult result;
-        async::parallel_invoke(
-            [&result, this] {
-                result.polyhedron_facets_with_wrong_adjacency =
-                    this->polyhedron_facets_with_wrong_adjacency();
-            },
-            [&result, this] {
-                result.colocated_points_groups =
-                    this->colocated_points_groups();
-            },
-            [&result, this] {
-                result.degenerated_edges = this->degenerated_edges();
-            },
-            [&result, this] {
-                result.degenerated_polyhedra = this->degenerated_polyhedra();
-            },
-            [&result, this] {
-                result.non_manifold_vertices = this->non_manifold_vertices();
-            },
-            [&result, this] {
-                result.non_manifold_edges = this->non_manifold_edges();
-            },
-            [&result, this] {
-                result.non_manifold_facets = this->non_manifold_facets();
-            },
-            [&result, this] {
-                result.negative_polyhedra = this->negative_polyhedra();
-            } );
+        const auto manifold =
+            options.is_enabled( InspectionCriterion::manifold );
+        runner.run(
+            internal::criterion_task(
+                options.is_enabled( InspectionCriterion::adjacency ),
+                "adjacency", nb_polyhedra,
+                [&result, this] {
+                    result.polyhedron_facets_with_wrong_adjacency =
+                        this->polyhedron_facets_with_wrong_adjacency();
+                } ),
+            internal::criterion_task(
+                options.is_enabled( InspectionCriterion::colocation ),
+                "colocation", mesh_.nb_vertices(),
+                [&result, this] {
+                    result.colocated_points_groups =
+                        this->colocated_points_groups();
+                } ),
+            internal::criterion_task(
+                options.is_enabled( InspectionCriterion::degeneration ),
+                "degeneration", nb_polyhedra,
+                [&result, this] {
+                    auto degenerations =
+                        this->degenerated_edges_and_polyhedra();
+                    result.degenerated_edges =
+                        std::move( degenerations.degenerated_edges );
+                    result.degenerated_polyhedra =
+                        std::move( degenerations.degenerated_polyhedra );
+                } ),
+            internal::criterion_task( manifold, "vertex manifold",
+                mesh_.nb_vertices(),
+                [&result, this] {
+                    result.non_manifold_vertices =
+                        this->non_manifold_vertices();
+                } ),
+            internal::criterion_task( manifold, "edge manifold", nb_polyhedra,
+                [&result, this] {
+                    result.non_manifold_edges = this->non_manifold_edges();
+                } ),
+            internal::criterion_task( manifold, "facet manifold",
+                nb_polyhedra,
+                [&result, this] {
+                    result.non_manifold_facets = this->non_manifold_facets();
+                } ),
+            internal::criterion_task(
+                options.is_enabled( InspectionCriterion::negative_elements ),
+                "negative elements", nb_polyhedra,
+                [&result, this] {
+                    result.negative_polyhedra = this->negative_polyhedra();
+                } ) );
+        result.status = stop.status();
+        result.profile = runner.profile();
         return result;
     }
 
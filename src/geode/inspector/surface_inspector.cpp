@@ -23,10 +23,11 @@
 
 #include <geode/inspector/surface_inspector.hpp>
 
-#include <async++.h>
-
 #include <geode/mesh/core/surface_mesh.hpp>
 
+#include <geode/inspector/internal/criteria_runner.hpp>
+#include <geode/inspector/internal/inspection_stop.hpp>
+
 namespace geode
 {
     index_t SurfaceInspectionResult::nb_issues() const
@@ -62,7 +63,8 @@ namespace geode
               SurfaceMeshDegeneration< dimension >,
               SurfaceMeshEdgeManifold< dimension >,
               SurfaceMeshVertexManifold< dimension >,
-              SurfaceMeshIntersections< dimension > >{ mesh }
+              SurfaceMeshIntersections< dimension > >{ mesh },
+          mesh_( mesh )
     {
     }
 
@@ -70,31 +72,65 @@ namespace geode
     SurfaceInspectionResult
         SurfaceMeshInspector< dimension >::inspect_surface() const
     {
+        return inspect_surface( InspectionOptions{} );
+    }
+
+    template < index_t dimension >
+    SurfaceInspectionResult SurfaceMeshInspector< dimension >::inspect_surface(
+        const InspectionOptions& options ) const
+    {
+        const internal::InspectionStop stop{ options };
+        const internal::InspectionStopScope scope{ stop };
+        const internal::InspectionProgressScope progress{ options };
+        internal::CriteriaRunner runner{ options };
+        const auto nb_polygons = mesh_.nb_polygons();
         SurfaceInspectionResult result;
-        async::parallel_invoke(
-            [&result, this] {
-                result.polygon_edges_with_wrong_adjacency =
-                    this->polygon_edges_with_wrong_adjacency();
-            },
-            [&result, this] {
-                result.colocated_points_groups =
-                    this->colocated_points_groups();
-            },
-            [&result, this] {
-                result.degenerated_edges = this->degenerated_edges();
-            },
-            [&result, this] {
-                result.degenerated_polygons = this->degenerated_polygons();
-            },
-            [&result, this] {
-                result.non_manifold_edges = this->non_manifold_edges();
-            },
-            [&result, this] {
-                result.non_manifold_vertices = this->non_manifold_vertices();
-            },
-            [&result, this] {
-                result.intersecting_elements = this->intersecting_elements();
-            } );
+        const auto manifold =
+            options.is_enabled( InspectionCriterion::manifold );
+        runner.run(
+            internal::criterion_task(
+                options.is_enabled( InspectionCriterion::adjacency ),
+                "adjacency", nb_polygons,
+                [&result, this] {
+                    result.polygon_edges_with_wrong_adjacency =
+                        this->polygon_edges_with_wrong_adjacency();
+                } ),
+            internal::criterion_task(
+                options.is_enabled( InspectionCriterion::colocation ),
+                "colocation", mesh_.nb_vertices(),
+                [&result, this] {
+                    result.colocated_points_groups =
+                        this->colocated_points_groups();
+                } ),
+            internal::criterion_task(
+                options.is_enabled( InspectionCriterion::degeneration ),
+                "degeneration", nb_polygons,
+                [&result, this] {
+                    auto degenerations = this->degenerated_edges_and_polygons();
+                    result.degenerated_edges =
+                        std::move( degenerations.degenerated_edges );
+                    result.degenerated_polygons =
+                        std::move( degenerations.degenerated_polygons );
+                } ),
+            internal::criterion_task( manifold, "edge manifold", nb_polygons,
+                [&result, this] {
+                    result.non_manifold_edges = this->non_manifold_edges();
+                } ),
+            internal::criterion_task( manifold, "vertex manifold",
+                mesh_.nb_vertices(),
+                [&result, this] {
+                    result.non_manifold_vertices =
+                        this->non_manifold_vertices();
+                } ),
+            internal::criterion_task(
+                options.is_enabled( InspectionCriterion::intersections ),
+                "intersections", nb_polygons,
+                [&result, this] {
+                    result.intersecting_elements =
+                        this->intersecting_elements();
+                } ) );
+        result.status = stop.status();
+        result.profile = runner.profile();
         return result;
     }
 
@@ -40,36 +40,31 @@
 #include <geode/model/mixin/core/surface.hpp>
 #include <geode/model/representation/core/brep.hpp>
 
+#include <geode/inspector/internal/inspected_components.hpp>
+#include <geode/inspector/internal/parallel.hpp>
+#include <geode/inspector/topology/internal/brep_unique_vertices_summary.hpp>
 #include <geode/inspector/topology/internal/topology_helpers.hpp>
 
 namespace
 {
-    std::vector< geode::uuid > block_boundary_surfaces(
-        const geode::BRep& brep, const geode::Block3D& block )
-    {
-        std::vector< geode::uuid > block_boundary_uuids;
-        block_boundary_uuids.reserve( brep.nb_boundaries( block.id() ) );
-        for( const auto& boundary_surface : brep.boundaries( block ) )
-        {
-            block_boundary_uuids.push_back( boundary_surface.id() );
-        }
-        return block_boundary_uuids;
-    }
+    using ComponentKind =
+        geode::internal::BRepUniqueVerticesSummary::ComponentKind;
+    using VertexComponent =
+        geode::internal::BRepUniqueVerticesSummary::VertexComponent;
 
     bool is_line_incident_to_another_block_boundary_surface(
-        const geode::Line3D& line,
-        const geode::BRep& brep,
-        absl::Span< const geode::uuid > block_boundary_uuids,
-        const geode::uuid& boundary_surface_id )
+        const geode::internal::BRepComponentsRelationships& relationships,
+        geode::index_t line,
+        geode::index_t boundary_surface,
+        geode::index_t block )
     {
-        for( const auto& incident_surface : brep.incidences( line ) )
+        for( const auto incident_surface : relationships.incidences( line ) )
         {
-            if( incident_surface.id() == boundary_surface_id )
+            if( incident_surface == boundary_surface )
             {
                 continue;
             }
-            if( absl::c_find( block_boundary_uuids, incident_surface.id() )
-                != block_boundary_uuids.end() )
+            if( relationships.is_boundary( incident_surface, block ) )
             {
                 return true;
             }
@@ -77,15 +72,15 @@ namespace
         return false;
     }
 
-    bool surface_should_not_be_boundary_to_block( const geode::uuid& bsurf_uuid,
-        const geode::BRep& brep,
-        const std::vector< geode::uuid >& block_boundary_uuids )
+    bool surface_should_not_be_boundary_to_block(
+        const geode::internal::BRepComponentsRelationships& relationships,
+        geode::index_t boundary_surface,
+        geode::index_t block )
     {
-        const auto& surface = brep.surface( bsurf_uuid );
-        for( const auto& line : brep.boundaries( surface ) )
+        for( const auto line : relationships.boundaries( boundary_surface ) )
         {
             if( is_line_incident_to_another_block_boundary_surface(
-                    line, brep, block_boundary_uuids, bsurf_uuid ) )
+                    relationships, line, boundary_surface, block ) )
             {
                 continue;
             }
@@ -94,10 +89,9 @@ namespace
         return false;
     }
 
-    template < typename Condition >
+    template < typename ComponentMeshVertices, typename Condition >
     geode::index_t count_cmvs(
-        absl::Span< const geode::ComponentMeshVertex > cmvs,
-        const Condition& condition )
+        const ComponentMeshVertices& cmvs, const Condition& condition )
     {
         geode::index_t counter{ 0 };
         for( const auto& cmv : cmvs )
@@ -177,6 +171,16 @@ namespace geode
                       unique_vertex_index ) );
     }
 
+    bool BRepBlocksTopology::brep_blocks_topology_is_valid(
+        const internal::BRepUniqueVerticesSummary& summary,
+        index_t unique_vertex_index ) const
+    {
+        return !( unique_vertex_is_part_of_two_blocks_and_no_boundary_surface(
+                      summary, unique_vertex_index )
+                  || unique_vertex_block_cmvs_count_is_incorrect(
+                      summary, unique_vertex_index ) );
+    }
+
     bool BRepBlocksTopology::block_is_meshed( const Block3D& block ) const
     {
         const auto& block_mesh = block.mesh();
@@ -242,6 +246,50 @@ namespace geode
             "surfaces." );
     }
 
+    std::optional< std::string > BRepBlocksTopology::
+        unique_vertex_is_part_of_two_blocks_and_no_boundary_surface(
+            const internal::BRepUniqueVerticesSummary& summary,
+            index_t unique_vertex_index ) const
+    {
+        const auto blocks =
+            summary.components( unique_vertex_index, ComponentKind::block );
+        if( blocks.size() != 2 )
+        {
+            return std::nullopt;
+        }
+        const auto& relationships = summary.relationships();
+        const auto line_cmvs = summary.vertex_components(
+            unique_vertex_index, ComponentKind::line );
+        for( const auto& surface_cmv : summary.vertex_components(
+                 unique_vertex_index, ComponentKind::surface ) )
+        {
+            const auto surface = surface_cmv.component;
+            const auto is_boundary_of_block0 =
+                relationships.is_boundary( surface, blocks[0] );
+            const auto is_boundary_of_block1 =
+                relationships.is_boundary( surface, blocks[1] );
+            if( is_boundary_of_block0 && is_boundary_of_block1 )
+            {
+                return std::nullopt;
+            }
+            if( !is_boundary_of_block0 && !is_boundary_of_block1 )
+            {
+                continue;
+            }
+            for( const auto& line_cmv : line_cmvs )
+            {
+                if( relationships.is_boundary( line_cmv.component, surface ) )
+                {
+                    return std::nullopt;
+                }
+            }
+        }
+        return absl::StrCat( "Unique vertex with index ", unique_vertex_index,
+            " is part of two blocks, but not of a surface boundary to the two "
+            "blocks, nor of a line boundary to one of the blocks incident "
+            "surfaces." );
+    }
+
     std::optional< std::string >
         BRepBlocksTopology::unique_vertex_block_cmvs_count_is_incorrect(
             index_t unique_vertex_index ) const
@@ -405,12 +453,194 @@ namespace geode
         return std::nullopt;
     }
 
+    std::optional< std::string >
+        BRepBlocksTopology::unique_vertex_block_cmvs_count_is_incorrect(
+            const internal::BRepUniqueVerticesSummary& summary,
+            index_t unique_vertex_index ) const
+    {
+        const auto surface_cmvs = summary.vertex_components(
+            unique_vertex_index, ComponentKind::surface );
+        const auto line_cmvs = summary.vertex_components(
+            unique_vertex_index, ComponentKind::line );
+        const auto corner_cmvs = summary.vertex_components(
+            unique_vertex_index, ComponentKind::corner );
+        const auto& relationships = summary.relationships();
+        for( const auto block :
+            summary.components( unique_vertex_index, ComponentKind::block ) )
+        {
+            const auto& block_uuid = relationships.component_id( block ).id();
+            const auto nb_block_cmvs =
+                summary.nb_component_vertices( unique_vertex_index, block );
+
+            const auto nb_internal_surface_cmvs = count_cmvs( surface_cmvs,
+                [&relationships, block]( const VertexComponent& cmv ) {
+                    return relationships.is_internal( cmv.component, block );
+                } );
+
+            const auto nb_boundary_surface_cmvs = count_cmvs( surface_cmvs,
+                [&relationships, block]( const VertexComponent& cmv ) {
+                    return relationships.is_boundary( cmv.component, block );
+                } );
+            const auto nb_boundary_line_cmvs = count_cmvs( line_cmvs,
+                [&relationships, block]( const VertexComponent& cmv ) {
+                    for( const auto surface :
+                        relationships.incidences( cmv.component ) )
+                    {
+                        if( relationships.is_boundary( surface, block ) )
+                        {
+                            return true;
+                        }
+                    }
+                    for( const auto surface :
+                        relationships.embeddings( cmv.component ) )
+                    {
+                        if( relationships.is_kind(
+                                surface, ComponentKind::surface )
+                            && relationships.is_boundary( surface, block ) )
+                        {
+                            return true;
+                        }
+                    }
+                    return false;
+                } );
+            const auto nb_free_line_cmvs = count_cmvs( line_cmvs,
+                [&relationships]( const VertexComponent& cmv ) {
+                    if( relationships.incidences( cmv.component ).size() != 1 )
+                    {
+                        return false;
+                    }
+                    for( const auto embedding :
+                        relationships.embeddings( cmv.component ) )
+                    {
+                        if( relationships.is_kind(
+                                embedding, ComponentKind::surface ) )
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                } );
+            if( corner_cmvs.size() == 1 && nb_internal_surface_cmvs == 0 )
+            {
+                if( nb_boundary_line_cmvs == 1 )
+                {
+                    if( nb_block_cmvs != 1 )
+                    {
+                        return absl::StrCat( "Unique vertex with index ",
+                            unique_vertex_index, " is part of block ",
+                            block_uuid.string(),
+                            " and exactly one corner and one line but "
+                            "has ",
+                            nb_block_cmvs,
+                            " block component mesh vertices (should be "
+                            "1)." );
+                    }
+                    continue;
+                }
+
+                const auto predicted_nb_block_cmvs = nb_boundary_surface_cmvs
+                                                     + corner_cmvs.size()
+                                                     - nb_boundary_line_cmvs;
+                if( nb_block_cmvs != predicted_nb_block_cmvs )
+                {
+                    return absl::StrCat( "Unique vertex with index ",
+                        unique_vertex_index, " is part of the block ",
+                        block_uuid.string(),
+                        ", and of a corner, and of no internal line, ",
+                        "and of ", nb_boundary_surface_cmvs,
+                        " boundary surface(s), and of ", nb_boundary_line_cmvs,
+                        " line(s) on block boundaries, with ", nb_block_cmvs,
+                        " block component mesh vertices (should be ",
+                        predicted_nb_block_cmvs, ")." );
+                }
+                continue;
+            }
+
+            if( nb_internal_surface_cmvs == 0 )
+            {
+                const auto predicted_nb_block_cmvs =
+                    nb_boundary_line_cmvs == 0 ? 1
+                                               : nb_boundary_surface_cmvs / 2;
+                if( nb_block_cmvs != predicted_nb_block_cmvs )
+                {
+                    return absl::StrCat( "Unique vertex with index ",
+                        unique_vertex_index, " is part of the block ",
+                        block_uuid.string(),
+                        " and none of its internal surfaces but has ",
+                        nb_block_cmvs,
+                        " block component mesh vertices (should be ",
+                        predicted_nb_block_cmvs, ")." );
+                }
+                continue;
+            }
+            auto predicted_nb_block_cmvs =
+                nb_internal_surface_cmvs < nb_free_line_cmvs + 1
+                    ? static_cast< index_t >( 1 )
+                    : nb_internal_surface_cmvs - nb_free_line_cmvs;
+            if( nb_internal_surface_cmvs - nb_free_line_cmvs == 1 )
+            {
+                predicted_nb_block_cmvs++;
+            }
+            if( nb_boundary_surface_cmvs > 1 && corner_cmvs.empty() )
+            {
+                predicted_nb_block_cmvs += ( nb_boundary_surface_cmvs - 2 ) / 2;
+            }
+            if( nb_block_cmvs != predicted_nb_block_cmvs )
+            {
+                return absl::StrCat( "Unique vertex with index ",
+                    unique_vertex_index, " is part of the block ",
+                    block_uuid.string(), ", has ", nb_internal_surface_cmvs,
+                    " internal surface(s) component mesh vertices (CMVs), has ",
+                    nb_boundary_surface_cmvs,
+                    " boundary surface(s) CMVs, and has ", nb_free_line_cmvs,
+                    " free line(s) CMVs, with ", nb_block_cmvs,
+                    " block CMVs (should be ", predicted_nb_block_cmvs, ")." );
+            }
+        }
+        return std::nullopt;
+    }
+
+    void BRepBlocksTopology::add_unique_vertex_issues(
+        const internal::BRepUniqueVerticesSummary& summary,
+        index_t unique_vertex_id,
+        BRepBlocksTopologyInspectionResult& result ) const
+    {
+        if( const auto problem_message =
+                unique_vertex_is_part_of_two_blocks_and_no_boundary_surface(
+                    summary, unique_vertex_id ) )
+        {
+            result
+                .unique_vertices_part_of_two_blocks_and_no_boundary_surface
+                .add_issue( unique_vertex_id, problem_message.value() );
+        }
+        if( const auto problem_message =
+                unique_vertex_block_cmvs_count_is_incorrect(
+                    summary, unique_vertex_id ) )
+        {
+            result.unique_vertices_with_incorrect_block_cmvs_count
+                .add_issue( unique_vertex_id, problem_message.value() );
+        }
+    }
+
     BRepBlocksTopologyInspectionResult
         BRepBlocksTopology::inspect_blocks() const
+    {
+        return inspect_blocks(
+            internal::BRepUniqueVerticesSummary{ brep_ },
+            internal::InspectedComponents{} );
+    }
+
+    BRepBlocksTopologyInspectionResult BRepBlocksTopology::inspect_blocks(
+        const internal::BRepUniqueVerticesSummary& summary,
+        const internal::InspectedComponents& components ) const
     {
         BRepBlocksTopologyInspectionResult result;
         for( const auto& block : brep_.blocks() )
         {
+            if( !components.contains( block.id() ) )
+            {
+                continue;
+            }
             if( !block_is_meshed( brep_.block( block.id() ) ) )
             {
                 result.blocks_not_meshed.add_issue(
@@ -429,33 +659,40 @@ namespace geode
                     block.id(), std::move( block_result ) );
             }
         }
-        for( const auto unique_vertex_id : Range{ brep_.nb_unique_vertices() } )
+        auto chunks_results = internal::parallel_chunks_results<
+            BRepBlocksTopologyInspectionResult >( summary.nb_unique_vertices(),
+            [this, &summary]( index_t position,
+                BRepBlocksTopologyInspectionResult& chunk_result ) {
+                add_unique_vertex_issues(
+                    summary, summary.unique_vertex( position ), chunk_result );
+            } );
+        for( auto& chunk_result : chunks_results )
         {
-            if( const auto problem_message =
-                    unique_vertex_is_part_of_two_blocks_and_no_boundary_surface(
-                        unique_vertex_id ) )
-            {
-                result
-                    .unique_vertices_part_of_two_blocks_and_no_boundary_surface
-                    .add_issue( unique_vertex_id, problem_message.value() );
-            }
-            if( const auto problem_message =
-                    unique_vertex_block_cmvs_count_is_incorrect(
-                        unique_vertex_id ) )
-            {
-                result.unique_vertices_with_incorrect_block_cmvs_count
-                    .add_issue( unique_vertex_id, problem_message.value() );
-            }
+            result
+                .unique_vertices_part_of_two_blocks_and_no_boundary_surface
+                .add_issues( std::move(
+                    chunk_result.unique_vertices_part_of_two_blocks_and_no_boundary_surface ) );
+            result.unique_vertices_with_incorrect_block_cmvs_count.add_issues(
+                std::move( chunk_result
+                    .unique_vertices_with_incorrect_block_cmvs_count ) );
+        }
+        const auto& relationships = summary.relationships();
+        if( relationships.scope()
+            != internal::BRepComponentsRelationships::Scope::whole_model )
+        {
+            return result;
         }
         for( const auto& block : brep_.blocks() )
         {
-            const auto block_boundary_uuids =
-                block_boundary_surfaces( brep_, block );
-            for( const auto& bsurf_uuid : block_boundary_uuids )
+            const auto block_index =
+                relationships.component_index( block.id() );
+            for( const auto surface : relationships.boundaries( block_index ) )
             {
                 if( surface_should_not_be_boundary_to_block(
-                        bsurf_uuid, brep_, block_boundary_uuids ) )
+                        relationships, surface, block_index ) )
                 {
+                    const auto& bsurf_uuid =
+                        relationships.component_id( surface ).id();
                     result.wrong_block_boundary_surface.add_issue( bsurf_uuid,
                         absl::StrCat( "Surface ", bsurf_uuid.string(),
                             " should not be boundary of Block ",
@@ -22,6 +22,9 @@
  */
 
 #include <geode/inspector/topology/brep_corners_topology.hpp>
+#include <geode/inspector/internal/inspected_components.hpp>
+#include <geode/inspector/internal/parallel.hpp>
+#include <geode/inspector/topology/internal/brep_unique_vertices_summary.hpp>
 #include <geode/inspector/topology/internal/topology_helpers.hpp>
 
 #include <optional>
@@ -32,6 +35,12 @@
 #include <geode/model/mixin/core/line.hpp>
 #include <geode/model/representation/core/brep.hpp>
 
+namespace
+{
+    using ComponentKind =
+        geode::internal::BRepUniqueVerticesSummary::ComponentKind;
+} // namespace
+
 namespace geode
 {
     index_t BRepCornersTopologyInspectionResult::nb_issues() const
@@ -137,6 +146,43 @@ namespace geode
         return true;
     }
 
+    bool BRepCornersTopology::brep_corner_topology_is_valid(
+        const internal::BRepUniqueVerticesSummary& summary,
+        index_t unique_vertex_index ) const
+    {
+        const auto corner_cmvs = summary.vertex_components(
+            unique_vertex_index, ComponentKind::corner );
+        if( corner_cmvs.empty() )
+        {
+            return true;
+        }
+        if( corner_cmvs.size() > 1 )
+        {
+            return false;
+        }
+        const auto& relationships = summary.relationships();
+        const auto corner = corner_cmvs[0].component;
+        const auto nb_embeddings = relationships.embeddings( corner ).size();
+        const auto nb_incidences = relationships.incidences( corner ).size();
+        if( nb_embeddings > 1 )
+        {
+            return false;
+        }
+        if( nb_embeddings != 1 )
+        {
+            if( nb_incidences < 1 )
+            {
+                return false;
+            }
+        }
+        else if( nb_incidences > 1 )
+        {
+            return false;
+        }
+        return !corner_is_part_of_line_but_not_boundary(
+            summary, unique_vertex_index );
+    }
+
     bool BRepCornersTopology::corner_is_meshed( const Corner3D& corner ) const
     {
         return corner.mesh().nb_vertices() != 0;
@@ -171,6 +217,22 @@ namespace geode
         return std::nullopt;
     }
 
+    std::optional< std::string >
+        BRepCornersTopology::unique_vertex_has_multiple_corners(
+            const internal::BRepUniqueVerticesSummary& summary,
+            index_t unique_vertex_index ) const
+    {
+        if( summary
+                .vertex_components( unique_vertex_index, ComponentKind::corner )
+                .size()
+            > 1 )
+        {
+            return absl::StrCat( "Unique vertex with index ",
+                unique_vertex_index, " is part of several corners." );
+        }
+        return std::nullopt;
+    }
+
     std::optional< std::string >
         BRepCornersTopology::corner_has_multiple_embeddings(
             index_t unique_vertex_index ) const
@@ -190,6 +252,26 @@ namespace geode
         return std::nullopt;
     }
 
+    std::optional< std::string >
+        BRepCornersTopology::corner_has_multiple_embeddings(
+            const internal::BRepUniqueVerticesSummary& summary,
+            index_t unique_vertex_index ) const
+    {
+        const auto& relationships = summary.relationships();
+        for( const auto& cmv : summary.vertex_components(
+                 unique_vertex_index, ComponentKind::corner ) )
+        {
+            if( relationships.embeddings( cmv.component ).size() > 1 )
+            {
+                return absl::StrCat( "Unique vertex with index ",
+                    unique_vertex_index, " is associated to corner with uuid '",
+                    relationships.component_id( cmv.component ).id().string(),
+                    "', which has several embeddings." );
+            }
+        }
+        return std::nullopt;
+    }
+
     std::optional< std::string >
         BRepCornersTopology::corner_is_not_internal_nor_boundary(
             index_t unique_vertex_index ) const
@@ -210,6 +292,27 @@ namespace geode
         return std::nullopt;
     }
 
+    std::optional< std::string >
+        BRepCornersTopology::corner_is_not_internal_nor_boundary(
+            const internal::BRepUniqueVerticesSummary& summary,
+            index_t unique_vertex_index ) const
+    {
+        const auto& relationships = summary.relationships();
+        for( const auto& cmv : summary.vertex_components(
+                 unique_vertex_index, ComponentKind::corner ) )
+        {
+            if( relationships.embeddings( cmv.component ).empty()
+                && relationships.incidences( cmv.component ).empty() )
+            {
+                return absl::StrCat( "Unique vertex with index ",
+                    unique_vertex_index, " is associated to corner with uuid '",
+                    relationships.component_id( cmv.component ).id().string(),
+                    "', which is neither internal nor boundary." );
+            }
+        }
+        return std::nullopt;
+    }
+
     std::optional< std::string >
         BRepCornersTopology::corner_is_part_of_line_but_not_boundary(
             index_t unique_vertex_index ) const
@@ -272,12 +375,113 @@ namespace geode
         return std::nullopt;
     }
 
+    std::optional< std::string >
+        BRepCornersTopology::corner_is_part_of_line_but_not_boundary(
+            const internal::BRepUniqueVerticesSummary& summary,
+            index_t unique_vertex_index ) const
+    {
+        const auto& relationships = summary.relationships();
+        const auto line_cmvs = summary.vertex_components(
+            unique_vertex_index, ComponentKind::line );
+        for( const auto& corner_cmv : summary.vertex_components(
+                 unique_vertex_index, ComponentKind::corner ) )
+        {
+            const auto& corner_uuid =
+                relationships.component_id( corner_cmv.component ).id();
+            for( const auto& line_cmv : line_cmvs )
+            {
+                const auto& line_uuid =
+                    relationships.component_id( line_cmv.component ).id();
+                if( relationships.is_boundary(
+                        corner_cmv.component, line_cmv.component ) )
+                {
+                    continue;
+                }
+                if( relationships.is_internal(
+                        corner_cmv.component, line_cmv.component ) )
+                {
+                    const auto line_vertex_count =
+                        summary.nb_component_vertices(
+                            unique_vertex_index, corner_cmv.component );
+                    if( line_vertex_count != 2 )
+                    {
+                        return absl::StrCat( "Unique vertex with index ",
+                            unique_vertex_index,
+                            " is associated with corner with uuid '",
+                            corner_uuid.string(),
+                            "', which is internal to line with uuid '",
+                            line_uuid.string(),
+                            "', so line should be closed and have two "
+                            "different vertices on unique vertex, but has ",
+                            line_vertex_count, " vertices on it instead." );
+                    }
+                    continue;
+                }
+                return absl::StrCat( "Unique vertex with index ",
+                    unique_vertex_index,
+                    " is associated with corner with uuid '",
+                    corner_uuid.string() + "', part of line with uuid '",
+                    line_uuid.string(),
+                    "', but is neither boundary nor internal of it." );
+            }
+        }
+        return std::nullopt;
+    }
+
+    void BRepCornersTopology::add_unique_vertex_issues(
+        const internal::BRepUniqueVerticesSummary& summary,
+        index_t unique_vertex_id,
+        BRepCornersTopologyInspectionResult& result ) const
+    {
+        if( const auto problem_message = unique_vertex_has_multiple_corners(
+                summary, unique_vertex_id ) )
+        {
+            result.unique_vertices_linked_to_multiple_corners.add_issue(
+                unique_vertex_id, problem_message.value() );
+        }
+        if( const auto problem_message = corner_has_multiple_embeddings(
+                summary, unique_vertex_id ) )
+        {
+            result.unique_vertices_linked_to_multiple_internals_corner
+                .add_issue( unique_vertex_id, problem_message.value() );
+        }
+        if( const auto problem_message =
+                corner_is_not_internal_nor_boundary(
+                    summary, unique_vertex_id ) )
+        {
+            result
+                .unique_vertices_linked_to_not_internal_nor_boundary_corner
+                .add_issue( unique_vertex_id, problem_message.value() );
+        }
+        if( const auto problem_message =
+                corner_is_part_of_line_but_not_boundary(
+                    summary, unique_vertex_id ) )
+        {
+            result.unique_vertices_liked_to_not_boundary_line_corner
+                .add_issue( unique_vertex_id, problem_message.value() );
+        }
+    }
+
     BRepCornersTopologyInspectionResult
         BRepCornersTopology::inspect_corners_topology() const
+    {
+        return inspect_corners_topology(
+            internal::BRepUniqueVerticesSummary{ brep_ },
+            internal::InspectedComponents{} );
+    }
+
+    BRepCornersTopologyInspectionResult
+        BRepCornersTopology::inspect_corners_topology(
+            const internal::BRepUniqueVerticesSummary& summary,
+            const internal::InspectedComponents& components ) const
     {
         BRepCornersTopologyInspectionResult result;
         for( const auto& corner : brep_.corners() )
         {
+            if( !components.contains( corner.id() ) )
+            {
+                continue;
+            }
             if( !corner_is_meshed( brep_.corner( corner.id() ) ) )
             {
                 result.corners_not_meshed.add_issue(
@@ -296,34 +500,29 @@ namespace geode
                     corner.id(), std::move( corner_result ) );
             }
         }
-        for( const auto unique_vertex_id : Range{ brep_.nb_unique_vertices() } )
+        auto chunks_results = internal::parallel_chunks_results<
+            BRepCornersTopologyInspectionResult >( summary.nb_unique_vertices(),
+            [this, &summary]( index_t position,
+                BRepCornersTopologyInspectionResult& chunk_result ) {
+                add_unique_vertex_issues(
+                    summary, summary.unique_vertex( position ), chunk_result );
+            } );
+        for( auto& chunk_result : chunks_results )
         {
-            if( const auto problem_message =
-                    unique_vertex_has_multiple_corners( unique_vertex_id ) )
-            {
-                result.unique_vertices_linked_to_multiple_corners.add_issue(
-                    unique_vertex_id, problem_message.value() );
-            }
-            if( const auto problem_message =
-                    corner_has_multiple_embeddings( unique_vertex_id ) )
-            {
-                result.unique_vertices_linked_to_multiple_internals_corner
-                    .add_issue( unique_vertex_id, problem_message.value() );
-            }
-            if( const auto problem_message =
-                    corner_is_not_internal_nor_boundary( unique_vertex_id ) )
-            {
-                result
-                    .unique_vertices_linked_to_not_internal_nor_boundary_corner
-                    .add_issue( unique_vertex_id, problem_message.value() );
-            }
-            if( const auto problem_message =
-                    corner_is_part_of_line_but_not_boundary(
-                        unique_vertex_id ) )
-            {
-                result.unique_vertices_liked_to_not_boundary_line_corner
-                    .add_issue( unique_vertex_id, problem_message.value() );
-            }
+            result.unique_vertices_linked_to_multiple_corners.add_issues(
+                std::move( chunk_result
+                    .unique_vertices_linked_to_multiple_corners ) );
+            result
+                .unique_vertices_linked_to_multiple_internals_corner
+                .add_issues( std::move(
+                    chunk_result.unique_vertices_linked_to_multiple_internals_corner ) );
+            result
+                .unique_vertices_linked_to_not_internal_nor_boundary_corner
+                .add_issues( std::move(
+                    chunk_result.unique_vertices_linked_to_not_internal_nor_boundary_corner ) );
+            result.unique_vertices_liked_to_not_boundary_line_corner.add_issues(
+                std::move( chunk_result
+                    .unique_vertices_liked_to_not_boundary_line_corner ) );
         }
         return result;
     }
@@ -36,8 +36,17 @@
 #include <geode/model/mixin/core/surface.hpp>
 #include <geode/model/representation/core/brep.hpp>
 
+#include <geode/inspector/internal/inspected_components.hpp>
+#include <geode/inspector/internal/parallel.hpp>
+#include <geode/inspector/topology/internal/brep_unique_vertices_summary.hpp>
 #include <geode/inspector/topology/internal/topology_helpers.hpp>
 
+namespace
+{
+    using ComponentKind =
+        geode::internal::BRepUniqueVerticesSummary::ComponentKind;
+} // namespace
+
 namespace geode
 {
     index_t BRepLinesTopologyInspectionResult::nb_issues() const
@@ -135,6 +144,30 @@ namespace geode
         return true;
     }
 
+    bool BRepLinesTopology::brep_lines_topology_is_valid(
+        const internal::BRepUniqueVerticesSummary& summary,
+        index_t unique_vertex_index ) const
+    {
+        const auto line_cmvs = summary.vertex_components(
+            unique_vertex_index, ComponentKind::line );
+        if( line_cmvs.empty() )
+        {
+            return true;
+        }
+        if( vertex_is_part_of_not_internal_nor_boundary_line(
+                summary, unique_vertex_index )
+            || vertex_is_part_of_invalid_embedded_line(
+                summary, unique_vertex_index )
+            || vertex_is_part_of_invalid_single_line(
+                summary, unique_vertex_index )
+            || vertex_has_lines_but_is_not_a_corner(
+                summary, unique_vertex_index ) )
+        {
+            return false;
+        }
+        return true;
+    }
+
     bool BRepLinesTopology::line_is_meshed( const Line3D& line ) const
     {
         const auto& line_mesh = line.mesh();
@@ -169,6 +202,27 @@ namespace geode
         return std::nullopt;
     }
 
+    std::optional< std::string >
+        BRepLinesTopology::vertex_is_part_of_not_internal_nor_boundary_line(
+            const internal::BRepUniqueVerticesSummary& summary,
+            index_t unique_vertex_index ) const
+    {
+        const auto& relationships = summary.relationships();
+        for( const auto& cmv : summary.vertex_components(
+                 unique_vertex_index, ComponentKind::line ) )
+        {
+            if( relationships.embeddings( cmv.component ).empty()
+                && relationships.incidences( cmv.component ).empty() )
+            {
+                return absl::StrCat( "Unique vertex with index ",
+                    unique_vertex_index, " is part of line with uuid '",
+                    relationships.component_id( cmv.component ).id().string(),
+                    "', which is neither embedded nor incident." );
+            }
+        }
+        return std::nullopt;
+    }
+
     std::optional< std::string >
         BRepLinesTopology::vertex_is_part_of_invalid_embedded_line(
             index_t unique_vertex_index ) const
@@ -218,6 +272,49 @@ namespace geode
         return std::nullopt;
     }
 
+    std::optional< std::string >
+        BRepLinesTopology::vertex_is_part_of_invalid_embedded_line(
+            const internal::BRepUniqueVerticesSummary& summary,
+            index_t unique_vertex_index ) const
+    {
+        const auto& relationships = summary.relationships();
+        for( const auto line : summary.components(
+                 unique_vertex_index, ComponentKind::line ) )
+        {
+            const auto& line_id = relationships.component_id( line ).id();
+            for( const auto embedding : relationships.embeddings( line ) )
+            {
+                const auto& embedding_id =
+                    relationships.component_id( embedding ).id();
+                if( relationships.is_boundary( line, embedding ) )
+                {
+                    return absl::StrCat( "Unique vertex with index ",
+                        unique_vertex_index, " is part of line with uuid '",
+                        line_id.string(),
+                        "', which is both boundary and embedded in "
+                        "surface with uuid '",
+                        embedding_id.string() + "'." );
+                }
+                if( relationships.is_kind( embedding, ComponentKind::block )
+                    && !summary.blocks_are_meshed() )
+                {
+                    continue;
+                }
+                if( !summary.has_component( unique_vertex_index, embedding ) )
+                {
+                    return absl::StrCat( "Unique vertex with index ",
+                        unique_vertex_index, " is part of line with uuid '",
+                        line_id.string(),
+                        "', which is embedded in surface with uuid '",
+                        embedding_id.string(),
+                        "', but the unique vertex is not linked to the "
+                        "surface mesh vertices." );
+                }
+            }
+        }
+        return std::nullopt;
+    }
+
     std::optional< std::string >
         BRepLinesTopology::vertex_is_part_of_invalid_single_line(
             index_t unique_vertex_index ) const
@@ -295,6 +392,86 @@ namespace geode
         return std::nullopt;
     }
 
+    std::optional< std::string >
+        BRepLinesTopology::vertex_is_part_of_invalid_single_line(
+            const internal::BRepUniqueVerticesSummary& summary,
+            index_t unique_vertex_index ) const
+    {
+        const auto lines =
+            summary.components( unique_vertex_index, ComponentKind::line );
+        if( lines.size() != 1 )
+        {
+            return std::nullopt;
+        }
+        const auto& relationships = summary.relationships();
+        const auto line = lines[0];
+        const auto& line_id = relationships.component_id( line ).id();
+        const auto surfaces =
+            summary.components( unique_vertex_index, ComponentKind::surface );
+        const auto blocks =
+            summary.components( unique_vertex_index, ComponentKind::block );
+        if( surfaces.size() == 1 )
+        {
+            const auto surface = surfaces[0];
+            if( !relationships.is_internal( line, surface )
+                && !( !relationships.embeddings( surface ).empty()
+                      && relationships.is_boundary( line, surface ) ) )
+            {
+                return absl::StrCat( "Unique vertex with index ",
+                    unique_vertex_index,
+                    " is part of only one line, with uuid '", line_id.string(),
+                    "', and only one surface, with uuid '",
+                    relationships.component_id( surface ).id().string(),
+                    "', but the line is neither embedded in the surface, nor "
+                    "boundary of the surface while the surface is embedded in "
+                    "a block." );
+            }
+        }
+        else if( surfaces.empty() )
+        {
+            if( !summary.blocks_are_meshed() )
+            {
+                return std::nullopt;
+            }
+            if( blocks.size() != 1 )
+            {
+                return absl::StrCat( "Unique vertex with index ",
+                    unique_vertex_index,
+                    " is part of only one line, with uuid '", line_id.string(),
+                    "', no surfaces, but is part of ", blocks.size(),
+                    " blocks, instead of one." );
+            }
+            if( !relationships.is_internal( line, blocks[0] ) )
+            {
+                return absl::StrCat( "Unique vertex with index ",
+                    unique_vertex_index,
+                    " is part of only one line, with uuid '", line_id.string(),
+                    "', no surfaces, one block, but the line is not "
+                    "internal to the block." );
+            }
+        }
+        else
+        {
+            for( const auto surface : surfaces )
+            {
+                if( !relationships.is_boundary( line, surface )
+                    && !relationships.is_internal( line, surface ) )
+                {
+                    return absl::StrCat( "Unique vertex with index ",
+                        unique_vertex_index,
+                        " is part of only one line, with uuid '",
+                        line_id.string(),
+                        "', and multiple surfaces, but the line is "
+                        "neither internal nor boundary of surface with "
+                        "uuid '",
+                        relationships.component_id( surface ).id().string(),
+                        "', in which the vertex is." );
+                }
+            }
+        }
+        return std::nullopt;
+    }
+
     std::optional< std::string >
         BRepLinesTopology::vertex_has_lines_but_is_not_a_corner(
             index_t unique_vertex_index ) const
@@ -323,12 +500,82 @@ namespace geode
         return std::nullopt;
     }
 
+    std::optional< std::string >
+        BRepLinesTopology::vertex_has_lines_but_is_not_a_corner(
+            const internal::BRepUniqueVerticesSummary& summary,
+            index_t unique_vertex_index ) const
+    {
+        const auto line_cmvs = summary.vertex_components(
+            unique_vertex_index, ComponentKind::line );
+        const auto corner_cmvs = summary.vertex_components(
+            unique_vertex_index, ComponentKind::corner );
+        if( line_cmvs.size() > 1 && corner_cmvs.empty() )
+        {
+            return absl::StrCat( "Unique vertex with index ",
+                unique_vertex_index,
+                " is part of multiple lines but is not a corner." );
+        }
+        return std::nullopt;
+    }
+
+    void BRepLinesTopology::add_unique_vertex_issues(
+        const internal::BRepUniqueVerticesSummary& summary,
+        index_t unique_vertex_id,
+        BRepLinesTopologyInspectionResult& result ) const
+    {
+        if( const auto boundary_nor_internal_line =
+                vertex_is_part_of_not_internal_nor_boundary_line(
+                    summary, unique_vertex_id ) )
+        {
+            result.unique_vertices_linked_to_not_internal_nor_boundary_line
+                .add_issue(
+                    unique_vertex_id, boundary_nor_internal_line.value() );
+        }
+        if( const auto invalid_internal_topology =
+                vertex_is_part_of_invalid_embedded_line(
+                    summary, unique_vertex_id ) )
+        {
+            result.unique_vertices_linked_to_a_line_with_invalid_embeddings
+                .add_issue(
+                    unique_vertex_id, invalid_internal_topology.value() );
+        }
+        if( const auto invalid_unique_line =
+                vertex_is_part_of_invalid_single_line(
+                    summary, unique_vertex_id ) )
+        {
+            result.unique_vertices_linked_to_a_single_and_invalid_line
+                .add_issue( unique_vertex_id, invalid_unique_line.value() );
+        }
+        if( const auto lines_but_is_not_corner =
+                vertex_has_lines_but_is_not_a_corner(
+                    summary, unique_vertex_id ) )
+        {
+            result
+                .unique_vertices_linked_to_several_lines_but_not_linked_to_a_corner
+                .add_issue(
+                    unique_vertex_id, lines_but_is_not_corner.value() );
+        }
+    }
+
     BRepLinesTopologyInspectionResult
         BRepLinesTopology::inspect_lines_topology() const
+    {
+        return inspect_lines_topology(
+            internal::BRepUniqueVerticesSummary{ brep_ },
+            internal::InspectedComponents{} );
+    }
+
+    BRepLinesTopologyInspectionResult BRepLinesTopology::inspect_lines_topology(
+        const internal::BRepUniqueVerticesSummary& summary,
+        const internal::InspectedComponents& components ) const
     {
         BRepLinesTopologyInspectionResult result;
         for( const auto& line : brep_.lines() )
         {
+            if( !components.contains( line.id() ) )
+            {
+                continue;
+            }
             if( !line_is_meshed( brep_.line( line.id() ) ) )
             {
                 result.lines_not_meshed.add_issue(
@@ -347,38 +594,31 @@ namespace geode
                     line.id(), std::move( line_result ) );
             }
         }
-        for( const auto unique_vertex_id : Range{ brep_.nb_unique_vertices() } )
+        auto chunks_results = internal::parallel_chunks_results<
+            BRepLinesTopologyInspectionResult >( summary.nb_unique_vertices(),
+            [this, &summary]( index_t position,
+                BRepLinesTopologyInspectionResult& chunk_result ) {
+                add_unique_vertex_issues(
+                    summary, summary.unique_vertex( position ), chunk_result );
+            } );
+        for( auto& chunk_result : chunks_results )
         {
-            if( const auto boundary_nor_internal_line =
-                    vertex_is_part_of_not_internal_nor_boundary_line(
-                        unique_vertex_id ) )
-            {
-                result.unique_vertices_linked_to_not_internal_nor_boundary_line
-                    .add_issue(
-                        unique_vertex_id, boundary_nor_internal_line.value() );
-            }
-            if( const auto invalid_internal_topology =
-                    vertex_is_part_of_invalid_embedded_line(
-                        unique_vertex_id ) )
-            {
-                result.unique_vertices_linked_to_a_line_with_invalid_embeddings
-                    .add_issue(
-                        unique_vertex_id, invalid_internal_topology.value() );
-            }
-            if( const auto invalid_unique_line =
-                    vertex_is_part_of_invalid_single_line( unique_vertex_id ) )
-            {
-                result.unique_vertices_linked_to_a_single_and_invalid_line
-                    .add_issue( unique_vertex_id, invalid_unique_line.value() );
-            }
-            if( const auto lines_but_is_not_corner =
-                    vertex_has_lines_but_is_not_a_corner( unique_vertex_id ) )
-            {
-                result
-                    .unique_vertices_linked_to_several_lines_but_not_linked_to_a_corner
-                    .add_issue(
-                        unique_vertex_id, lines_but_is_not_corner.value() );
-            }
+            result
+                .unique_vertices_linked_to_not_internal_nor_boundary_line
+                .add_issues( std::move(
+                    chunk_result.unique_vertices_linked_to_not_internal_nor_boundary_line ) );
+            result
+                .unique_vertices_linked_to_a_line_with_invalid_embeddings
+                .add_issues( std::move(
+                    chunk_result.unique_vertices_linked_to_a_line_with_invalid_embeddings ) );
+            result
+                .unique_vertices_linked_to_a_single_and_invalid_line
+                .add_issues( std::move(
+                    chunk_result.unique_vertices_linked_to_a_single_and_invalid_line ) );
+            result
+                .unique_vertices_linked_to_several_lines_but_not_linked_to_a_corner
+                .add_issues( std::move(
+                    chunk_result.unique_vertices_linked_to_several_lines_but_not_linked_to_a_corner ) );
         }
         return result;
     }
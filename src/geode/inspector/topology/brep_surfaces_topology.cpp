@@ -37,10 +37,16 @@
 #include <geode/model/mixin/core/surface.hpp>
 #include <geode/model/representation/core/brep.hpp>
 
+#include <geode/inspector/internal/inspected_components.hpp>
+#include <geode/inspector/internal/parallel.hpp>
+#include <geode/inspector/topology/internal/brep_unique_vertices_summary.hpp>
 #include <geode/inspector/topology/internal/topology_helpers.hpp>
 
 namespace
 {
+    using ComponentKind =
+        geode::internal::BRepUniqueVerticesSummary::ComponentKind;
+
     bool line_is_boundary_of_at_least_two_surfaces_or_one_embedding_surface(
         const geode::BRep& brep,
         const geode::uuid& line_uuid,
@@ -64,6 +70,30 @@ namespace
         }
         return false;
     }
+
+    bool line_is_boundary_of_at_least_two_surfaces_or_one_embedding_surface(
+        const geode::internal::BRepComponentsRelationships& relationships,
+        geode::index_t line,
+        absl::Span< const geode::index_t > surfaces )
+    {
+        geode::local_index_t counter{ 0 };
+        for( const auto surface : surfaces )
+        {
+            if( relationships.is_boundary( line, surface ) )
+            {
+                if( !relationships.embeddings( surface ).empty() )
+                {
+                    return true;
+                }
+                counter++;
+                if( counter > 1 )
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
 } // namespace
 
 namespace geode
@@ -180,6 +210,32 @@ namespace geode
         return true;
     }
 
+    bool BRepSurfacesTopology::brep_surfaces_topology_is_valid(
+        const internal::BRepUniqueVerticesSummary& summary,
+        index_t unique_vertex_index ) const
+    {
+        const auto surface_cmvs = summary.vertex_components(
+            unique_vertex_index, ComponentKind::surface );
+        if( surface_cmvs.empty() )
+        {
+            return true;
+        }
+        if( vertex_is_part_of_not_internal_nor_boundary_surface(
+                summary, unique_vertex_index )
+            || vertex_is_part_of_invalid_embedded_surface(
+                summary, unique_vertex_index )
+            || vertex_is_part_of_invalid_single_surface(
+                summary, unique_vertex_index )
+            || vertex_is_part_of_invalid_multiple_surfaces(
+                summary, unique_vertex_index )
+            || vertex_is_part_of_line_and_not_on_surface_border(
+                summary, unique_vertex_index ) )
+        {
+            return false;
+        }
+        return true;
+    }
+
     bool BRepSurfacesTopology::surface_is_meshed(
         const Surface3D& surface ) const
     {
@@ -218,6 +274,28 @@ namespace geode
         return std::nullopt;
     }
 
+    std::optional< std::string > BRepSurfacesTopology::
+        vertex_is_part_of_not_internal_nor_boundary_surface(
+            const internal::BRepUniqueVerticesSummary& summary,
+            index_t unique_vertex_index ) const
+    {
+        const auto& relationships = summary.relationships();
+        for( const auto& cmv : summary.vertex_components(
+                 unique_vertex_index, ComponentKind::surface ) )
+        {
+            if( relationships.embeddings( cmv.component ).empty()
+                && relationships.incidences( cmv.component ).empty() )
+            {
+                return absl::StrCat( "Unique vertex with index ",
+                    unique_vertex_index, " is part of surface with uuid '",
+                    relationships.component_id( cmv.component ).id().string(),
+                    "', which is neither internal to nor a boundary of "
+                    "a block." );
+            }
+        }
+        return std::nullopt;
+    }
+
     std::optional< std::string >
         BRepSurfacesTopology::vertex_is_part_of_invalid_embedded_surface(
             const index_t unique_vertex_index ) const
@@ -256,6 +334,45 @@ namespace geode
         return std::nullopt;
     }
 
+    std::optional< std::string >
+        BRepSurfacesTopology::vertex_is_part_of_invalid_embedded_surface(
+            const internal::BRepUniqueVerticesSummary& summary,
+            const index_t unique_vertex_index ) const
+    {
+        const auto& relationships = summary.relationships();
+        for( const auto surface : summary.components(
+                 unique_vertex_index, ComponentKind::surface ) )
+        {
+            const auto& surface_id = relationships.component_id( surface ).id();
+            for( const auto embedding : relationships.embeddings( surface ) )
+            {
+                const auto& embedding_id =
+                    relationships.component_id( embedding ).id();
+                if( relationships.is_boundary( surface, embedding ) )
+                {
+                    return absl::StrCat( "Unique vertex with index ",
+                        unique_vertex_index, " is part of surface with uuid '",
+                        surface_id.string(),
+                        "', which is both internal and boundary of ",
+                        "block with uuid '", embedding_id.string(), "'." );
+                }
+                if( summary.blocks_are_meshed()
+                    && !summary.has_component(
+                        unique_vertex_index, embedding ) )
+                {
+                    return absl::StrCat( "Unique vertex with index ",
+                        unique_vertex_index, " is part of surface with uuid '",
+                        surface_id.string(),
+                        "', which is embedded in block with uuid '",
+                        embedding_id.string(),
+                        "', but the unique vertex is not linked to any "
+                        "of the block vertices." );
+                }
+            }
+        }
+        return std::nullopt;
+    }
+
     std::optional< std::string >
         BRepSurfacesTopology::vertex_is_part_of_invalid_single_surface(
             index_t unique_vertex_index ) const
@@ -317,6 +434,70 @@ namespace geode
         return std::nullopt;
     }
 
+    std::optional< std::string >
+        BRepSurfacesTopology::vertex_is_part_of_invalid_single_surface(
+            const internal::BRepUniqueVerticesSummary& summary,
+            index_t unique_vertex_index ) const
+    {
+        const auto surfaces =
+            summary.components( unique_vertex_index, ComponentKind::surface );
+        if( surfaces.size() != 1 )
+        {
+            return std::nullopt;
+        }
+        const auto& relationships = summary.relationships();
+        const auto surface = surfaces[0];
+        const auto& surface_id = relationships.component_id( surface ).id();
+        const auto blocks =
+            summary.components( unique_vertex_index, ComponentKind::block );
+        if( blocks.size() > 2 )
+        {
+            return absl::StrCat( "Unique vertex with index ",
+                unique_vertex_index,
+                " is part of only one surface, but is part of more "
+                "than two blocks." );
+        }
+        if( !relationships.embeddings( surface ).empty() )
+        {
+            if( summary.blocks_are_meshed() )
+            {
+                if( blocks.size() != 1 )
+                {
+                    return absl::StrCat( "Unique vertex with index ",
+                        unique_vertex_index,
+                        " is part of only one surface, which is "
+                        "embedded, but not part of only one block." );
+                }
+                else if( !relationships.is_internal( surface, blocks[0] ) )
+                {
+                    return absl::StrCat( "Unique vertex with index ",
+                        unique_vertex_index,
+                        " is part of only one surface, which is "
+                        "embedded, and one block, but the surface is "
+                        "not internal to the block." );
+                }
+            }
+        }
+        else
+        {
+            for( const auto block : blocks )
+            {
+                if( !relationships.is_boundary( surface, block ) )
+                {
+                    return absl::StrCat( "Unique vertex with index ",
+                        unique_vertex_index,
+                        " is part of only one surface, with uuid'",
+                        surface_id.string(),
+                        "' which is not embedded, but not boundary "
+                        "either of block with uuid '",
+                        relationships.component_id( block ).id().string(),
+                        "', in which the vertex is." );
+                }
+            }
+        }
+        return std::nullopt;
+    }
+
     std::optional< std::string >
         BRepSurfacesTopology::vertex_is_part_of_invalid_multiple_surfaces(
             index_t unique_vertex_index ) const
@@ -400,6 +581,86 @@ namespace geode
         return std::nullopt;
     }
 
+    std::optional< std::string >
+        BRepSurfacesTopology::vertex_is_part_of_invalid_multiple_surfaces(
+            const internal::BRepUniqueVerticesSummary& summary,
+            index_t unique_vertex_index ) const
+    {
+        const auto surfaces =
+            summary.components( unique_vertex_index, ComponentKind::surface );
+        if( surfaces.size() < 2 )
+        {
+            return std::nullopt;
+        }
+        const auto lines =
+            summary.components( unique_vertex_index, ComponentKind::line );
+        if( lines.empty() )
+        {
+            return absl::StrCat( "Unique vertex with index ",
+                unique_vertex_index,
+                " is part of multiple surfaces, but not part of any "
+                "line." );
+        }
+        const auto& relationships = summary.relationships();
+        if( lines.size() == 1 )
+        {
+            const auto line = lines[0];
+            const auto& line_id = relationships.component_id( line ).id();
+            const auto corner_found =
+                !summary
+                     .vertex_components(
+                         unique_vertex_index, ComponentKind::corner )
+                     .empty();
+            const auto nb_cmv_lines =
+                summary
+                    .vertex_components(
+                        unique_vertex_index, ComponentKind::line )
+                    .size();
+            if( corner_found && nb_cmv_lines < 2 )
+            {
+                return absl::StrCat( "Unique vertex with index ",
+                    unique_vertex_index,
+                    " is part of multiple surfaces and only one line, "
+                    "but is a corner." );
+            }
+            for( const auto surface : surfaces )
+            {
+                if( !relationships.is_boundary( line, surface )
+                    && !relationships.is_internal( line, surface ) )
+                {
+                    return absl::StrCat( "Unique vertex with index ",
+                        unique_vertex_index,
+                        " is part of multiple surfaces and only one "
+                        "line, with uuid'",
+                        line_id.string(), "', but surface with uuid '",
+                        relationships.component_id( surface ).id().string(),
+                        "', in which the vertex is, neither incident to nor "
+                        "embedding of the line." );
+                }
+            }
+        }
+        else
+        {
+            for( const auto line : lines )
+            {
+                if( relationships.embeddings( line ).empty()
+                    && !line_is_boundary_of_at_least_two_surfaces_or_one_embedding_surface(
+                        relationships, line, surfaces ) )
+                {
+                    return absl::StrCat( "Unique vertex with index ",
+                        unique_vertex_index,
+                        " is part of multiple surfaces and multiple "
+                        "lines, but line with uuid'",
+                        relationships.component_id( line ).id().string(),
+                        "' is neither internal, nor a boundary of at "
+                        "least two surfaces or one embedding "
+                        "surface." );
+                }
+            }
+        }
+        return std::nullopt;
+    }
+
     std::optional< std::string >
         BRepSurfacesTopology::vertex_is_part_of_line_and_not_on_surface_border(
             index_t unique_vertex_index ) const
@@ -441,12 +702,116 @@ namespace geode
         return std::nullopt;
     }
 
+    std::optional< std::string >
+        BRepSurfacesTopology::vertex_is_part_of_line_and_not_on_surface_border(
+            const internal::BRepUniqueVerticesSummary& summary,
+            index_t unique_vertex_index ) const
+    {
+        const auto lines =
+            summary.components( unique_vertex_index, ComponentKind::line );
+        if( lines.empty() )
+        {
+            return std::nullopt;
+        }
+        const auto& relationships = summary.relationships();
+        for( const auto& cmv : summary.vertex_components(
+                 unique_vertex_index, ComponentKind::surface ) )
+        {
+            const auto& surface_id =
+                relationships.component_id( cmv.component ).id();
+            const auto& surface = brep_.surface( surface_id );
+            if( surface.mesh().is_vertex_on_border( cmv.vertex ) )
+            {
+                continue;
+            }
+            for( const auto line : lines )
+            {
+                if( relationships.is_boundary( line, cmv.component )
+                    || relationships.is_internal( line, cmv.component ) )
+                {
+                    return absl::StrCat( "Unique vertex with index ",
+                        unique_vertex_index,
+                        " is part of a line and of surface with "
+                        "uuid '",
+                        surface_id.string(),
+                        "' but the associated vertex in the "
+                        "surface mesh is not on the mesh border." );
+                }
+            }
+        }
+        return std::nullopt;
+    }
+
+    void BRepSurfacesTopology::add_unique_vertex_issues(
+        const internal::BRepUniqueVerticesSummary& summary,
+        index_t unique_vertex_id,
+        BRepSurfacesTopologyInspectionResult& result ) const
+    {
+        if( const auto not_boundary_nor_internal_surface =
+                vertex_is_part_of_not_internal_nor_boundary_surface(
+                    summary, unique_vertex_id ) )
+        {
+            result
+                .unique_vertices_linked_to_not_internal_nor_boundary_surface
+                .add_issue( unique_vertex_id,
+                    not_boundary_nor_internal_surface.value() );
+        }
+        if( const auto invalid_internal_topology =
+                vertex_is_part_of_invalid_embedded_surface(
+                    summary, unique_vertex_id ) )
+        {
+            result
+                .unique_vertices_linked_to_a_surface_with_invalid_embbedings
+                .add_issue(
+                    unique_vertex_id, invalid_internal_topology.value() );
+        }
+        if( const auto invalid_unique_surface =
+                vertex_is_part_of_invalid_single_surface(
+                    summary, unique_vertex_id ) )
+        {
+            result.unique_vertices_linked_to_a_single_and_invalid_surface
+                .add_issue(
+                    unique_vertex_id, invalid_unique_surface.value() );
+        }
+        if( const auto invalid_multiple_surfaces =
+                vertex_is_part_of_invalid_multiple_surfaces(
+                    summary, unique_vertex_id ) )
+        {
+            result.unique_vertices_linked_to_several_and_invalid_surfaces
+                .add_issue(
+                    unique_vertex_id, invalid_multiple_surfaces.value() );
+        }
+        if( const auto line_and_not_on_surface_border =
+                vertex_is_part_of_line_and_not_on_surface_border(
+                    summary, unique_vertex_id ) )
+        {
+            result
+                .unique_vertices_linked_to_a_line_but_is_not_on_a_surface_border
+                .add_issue( unique_vertex_id,
+                    line_and_not_on_surface_border.value() );
+        }
+    }
+
     BRepSurfacesTopologyInspectionResult
         BRepSurfacesTopology::inspect_surfaces_topology() const
+    {
+        return inspect_surfaces_topology(
+            internal::BRepUniqueVerticesSummary{ brep_ },
+            internal::InspectedComponents{} );
+    }
+
+    BRepSurfacesTopologyInspectionResult
+        BRepSurfacesTopology::inspect_surfaces_topology(
+            const internal::BRepUniqueVerticesSummary& summary,
+            const internal::InspectedComponents& components ) const
     {
         BRepSurfacesTopologyInspectionResult result;
         for( const auto& surface : brep_.surfaces() )
         {
+            if( !components.contains( surface.id() ) )
+            {
+                continue;
+            }
             if( !surface_is_meshed( brep_.surface( surface.id() ) ) )
             {
                 result.surfaces_not_meshed.add_issue(
@@ -465,51 +830,36 @@ namespace geode
                     surface.id(), std::move( surface_result ) );
             }
         }
-        for( const auto unique_vertex_id : Range{ brep_.nb_unique_vertices() } )
+        auto chunks_results = internal::parallel_chunks_results<
+            BRepSurfacesTopologyInspectionResult >(
+            summary.nb_unique_vertices(),
+            [this, &summary]( index_t position,
+                BRepSurfacesTopologyInspectionResult& chunk_result ) {
+                add_unique_vertex_issues(
+                    summary, summary.unique_vertex( position ), chunk_result );
+            } );
+        for( auto& chunk_result : chunks_results )
         {
-            if( const auto not_boundary_nor_internal_surface =
-                    vertex_is_part_of_not_internal_nor_boundary_surface(
-                        unique_vertex_id ) )
-            {
-                result
-                    .unique_vertices_linked_to_not_internal_nor_boundary_surface
-                    .add_issue( unique_vertex_id,
-                        not_boundary_nor_internal_surface.value() );
-            }
-            if( const auto invalid_internal_topology =
-                    vertex_is_part_of_invalid_embedded_surface(
-                        unique_vertex_id ) )
-            {
-                result
-                    .unique_vertices_linked_to_a_surface_with_invalid_embbedings
-                    .add_issue(
-                        unique_vertex_id, invalid_internal_topology.value() );
-            }
-            if( const auto invalid_unique_surface =
-                    vertex_is_part_of_invalid_single_surface(
-                        unique_vertex_id ) )
-            {
-                result.unique_vertices_linked_to_a_single_and_invalid_surface
-                    .add_issue(
-                        unique_vertex_id, invalid_unique_surface.value() );
-            }
-            if( const auto invalid_multiple_surfaces =
-                    vertex_is_part_of_invalid_multiple_surfaces(
-                        unique_vertex_id ) )
-            {
-                result.unique_vertices_linked_to_several_and_invalid_surfaces
-                    .add_issue(
-                        unique_vertex_id, invalid_multiple_surfaces.value() );
-            }
-            if( const auto line_and_not_on_surface_border =
-                    vertex_is_part_of_line_and_not_on_surface_border(
-                        unique_vertex_id ) )
-            {
-                result
-                    .unique_vertices_linked_to_a_line_but_is_not_on_a_surface_border
-                    .add_issue( unique_vertex_id,
-                        line_and_not_on_surface_border.value() );
-            }
+            result
+                .unique_vertices_linked_to_not_internal_nor_boundary_surface
+                .add_issues( std::move(
+                    chunk_result.unique_vertices_linked_to_not_internal_nor_boundary_surface ) );
+            result
+                .unique_vertices_linked_to_a_surface_with_invalid_embbedings
+                .add_issues( std::move(
+                    chunk_result.unique_vertices_linked_to_a_surface_with_invalid_embbedings ) );
+            result
+                .unique_vertices_linked_to_a_single_and_invalid_surface
+                .add_issues( std::move(
+                    chunk_result.unique_vertices_linked_to_a_single_and_invalid_surface ) );
+            result
+                .unique_vertices_linked_to_several_and_invalid_surfaces
+                .add_issues( std::move(
+                    chunk_result.unique_vertices_linked_to_several_and_invalid_surfaces ) );
+            result
+                .unique_vertices_linked_to_a_line_but_is_not_on_a_surface_border
+                .add_issues( std::move(
+                    chunk_result.unique_vertices_linked_to_a_line_but_is_not_on_a_surface_border ) );
         }
         return result;
     }
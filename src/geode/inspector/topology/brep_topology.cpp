@@ -23,8 +23,6 @@
 
 #include <geode/inspector/topology/brep_topology.hpp>
 
-#include <async++.h>
-
 #include <geode/basic/logger.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 
@@ -39,6 +37,72 @@
 #include <geode/model/mixin/core/surface.hpp>
 #include <geode/model/representation/core/brep.hpp>
 
+#include <geode/inspector/internal/inspected_components.hpp>
+#include <geode/inspector/internal/parallel.hpp>
+#include <geode/inspector/internal/trace_scope.hpp>
+#include <geode/inspector/topology/internal/brep_unique_vertices_summary.hpp>
+
+namespace
+{
+    /*!
+     * Type and number of mesh vertices of the BRep components, indexed by
+     * the dense component indices of a unique vertices summary. Components
+     * unknown to the BRep have no vertex.
+     */
+    class BRepComponentsVertices
+    {
+    public:
+        explicit BRepComponentsVertices( const geode::BRep& brep,
+            const geode::internal::BRepComponentsRelationships& relationships )
+            : relationships_( relationships ),
+              components_( relationships.nb_components() )
+        {
+            add_components( brep.corners() );
+            add_components( brep.lines() );
+            add_components( brep.surfaces() );
+            add_components( brep.blocks() );
+        }
+
+        /*!
+         * Returns true if the component mesh vertex, whose component has the
+         * given dense index, exists in the BRep.
+         */
+        bool contains( const geode::ComponentMeshVertex& cmv,
+            geode::index_t component ) const
+        {
+            const auto& component_vertices = components_[component];
+            return cmv.vertex < component_vertices.nb_vertices
+                   && component_vertices.type == cmv.component_id.type();
+        }
+
+    private:
+        struct ComponentVertices
+        {
+            geode::ComponentType type;
+            geode::index_t nb_vertices{ 0 };
+        };
+
+        template < typename ComponentRange >
+        void add_components( const ComponentRange& components )
+        {
+            for( const auto& component : components )
+            {
+                const auto component_index =
+                    relationships_.component_index( component.id() );
+                if( component_index != geode::NO_ID )
+                {
+                    components_[component_index] = { component.component_type(),
+                        component.mesh().nb_vertices() };
+                }
+            }
+        }
+
+    private:
+        const geode::internal::BRepComponentsRelationships& relationships_;
+        std::vector< ComponentVertices > components_;
+    };
+} // namespace
+
 namespace geode
 {
     index_t BRepTopologyInspectionResult::nb_issues() const
@@ -73,70 +137,70 @@ namespace geode
             brep_unique_vertices_are_bijectively_linked_to_an_existing_component_vertex()
                 const
         {
-            for( const auto uv_id : Range{ brep_.nb_unique_vertices() } )
-            {
-                const auto& unique_vertex_cmvs =
-                    brep_.component_mesh_vertices( uv_id );
-                if( unique_vertex_cmvs.empty() )
-                {
-                    return false;
-                }
-                for( const auto& cmv : unique_vertex_cmvs )
-                {
-                    if( cmv_exists_in_brep( cmv ) )
+            return brep_unique_vertices_are_bijectively_linked_to_an_existing_component_vertex(
+                internal::BRepUniqueVerticesSummary{ brep_ } );
+        }
+
+        bool
+            brep_unique_vertices_are_bijectively_linked_to_an_existing_component_vertex(
+                const internal::BRepUniqueVerticesSummary& summary ) const
+        {
+            const BRepComponentsVertices components_vertices{ brep_,
+                summary.relationships() };
+            return !internal::parallel_any_of( brep_.nb_unique_vertices(),
+                [this, &summary, &components_vertices]( index_t uv_id ) {
+                    const auto& unique_vertex_cmvs =
+                        brep_.component_mesh_vertices( uv_id );
+                    if( unique_vertex_cmvs.empty() )
                     {
-                        if( brep_.unique_vertex( cmv ) != uv_id )
+                        return true;
+                    }
+                    const auto components = summary.cmv_components( uv_id );
+                    for( const auto cmv_id : Indices{ unique_vertex_cmvs } )
+                    {
+                        const auto& cmv = unique_vertex_cmvs[cmv_id];
+                        if( !components_vertices.contains(
+                                cmv, components[cmv_id] )
+                            || brep_.unique_vertex( cmv ) != uv_id )
                         {
-                            return false;
+                            return true;
                         }
-                        continue;
                     }
                     return false;
-                }
-            }
-            return true;
+                } );
         }
 
         void add_unique_vertices_with_wrong_cmv_link(
+            const internal::BRepUniqueVerticesSummary& summary,
             BRepTopologyInspectionResult& brep_issues ) const
         {
-            auto& not_linked_result =
-                brep_issues.unique_vertices_not_linked_to_any_component;
-            auto& linked_to_inexistant_result =
-                brep_issues.unique_vertices_linked_to_inexistant_cmv;
-            auto& linked_to_nonbijective_result =
-                brep_issues.unique_vertices_nonbijectively_linked_to_cmv;
-            for( const auto uv_id : Range{ brep_.nb_unique_vertices() } )
-            {
-                const auto& unique_vertex_cmvs =
-                    brep_.component_mesh_vertices( uv_id );
-                if( unique_vertex_cmvs.empty() )
-                {
-                    not_linked_result.add_issue( uv_id,
-                        absl::StrCat( "Unique vertex with id ", uv_id,
-                            " is not linked to any component mesh vertex." ) );
-                    continue;
-                }
-                for( const auto& cmv : unique_vertex_cmvs )
-                {
-                    if( cmv_exists_in_brep( cmv ) )
+            const internal::TraceScope trace{ "topology",
+                "unique vertices links" };
+            const BRepComponentsVertices components_vertices{ brep_,
+                summary.relationships() };
+            std::vector< CmvLinkIssues > chunks_issues(
+                internal::nb_parallel_chunks( summary.nb_unique_vertices() ) );
+            internal::parallel_for_chunks( summary.nb_unique_vertices(),
+                [this, &summary, &components_vertices, &chunks_issues](
+                    index_t chunk_id, index_t begin, index_t end ) {
+                    auto& chunk_issues = chunks_issues[chunk_id];
+                    for( const auto position : Range{ begin, end } )
                     {
-                        if( brep_.unique_vertex( cmv ) != uv_id )
-                        {
-                            linked_to_nonbijective_result.add_issue( uv_id,
-                                absl::StrCat( "Unique vertex with id ", uv_id,
-                                    " is linked to inexistant component "
-                                    "mesh vertex [",
-                                    cmv.string(), "]." ) );
-                        }
-                        continue;
+                        add_unique_vertex_with_wrong_cmv_link( summary,
+                            components_vertices,
+                            summary.unique_vertex( position ), chunk_issues );
                     }
-                    linked_to_inexistant_result.add_issue(
-                        uv_id, absl::StrCat( "Unique vertex with id ", uv_id,
-                                   " is linked to inexistant component "
-                                   "mesh vertex [",
-                                   cmv.string(), "]." ) );
-                }
+                } );
+            for( auto& chunk_issues : chunks_issues )
+            {
+                brep_issues.unique_vertices_not_linked_to_any_component
+                    .add_issues( std::move( chunk_issues.not_linked ) );
+                brep_issues.unique_vertices_linked_to_inexistant_cmv
+                    .add_issues(
+                        std::move( chunk_issues.linked_to_inexistant ) );
+                brep_issues.unique_vertices_nonbijectively_linked_to_cmv
+                    .add_issues(
+                        std::move( chunk_issues.linked_to_nonbijective ) );
             }
         }
 
@@ -152,96 +216,129 @@ namespace geode
             {
                 return false;
             }
-            if( !brep_unique_vertices_are_bijectively_linked_to_an_existing_component_vertex() )
+            const internal::BRepUniqueVerticesSummary summary{ brep_ };
+            if( !brep_unique_vertices_are_bijectively_linked_to_an_existing_component_vertex(
+                    summary ) )
             {
                 return false;
             }
-            for( const auto unique_vertex_id :
-                Range{ brep_.nb_unique_vertices() } )
-            {
-                if( !brep_topology_inspector.brep_corner_topology_is_valid(
-                        unique_vertex_id )
-                    || !brep_topology_inspector.brep_lines_topology_is_valid(
-                        unique_vertex_id )
-                    || !brep_topology_inspector.brep_surfaces_topology_is_valid(
-                        unique_vertex_id )
-                    || !brep_topology_inspector.brep_blocks_topology_is_valid(
-                        unique_vertex_id ) )
-                {
-                    return false;
-                }
-            }
-            return true;
+            return !internal::parallel_any_of( brep_.nb_unique_vertices(),
+                [&brep_topology_inspector, &summary](
+                    index_t unique_vertex_id ) {
+                    return !brep_topology_inspector
+                                .brep_corner_topology_is_valid(
+                                    summary, unique_vertex_id )
+                           || !brep_topology_inspector
+                                   .brep_lines_topology_is_valid(
+                                       summary, unique_vertex_id )
+                           || !brep_topology_inspector
+                                   .brep_surfaces_topology_is_valid(
+                                       summary, unique_vertex_id )
+                           || !brep_topology_inspector
+                                   .brep_blocks_topology_is_valid(
+                                       summary, unique_vertex_id );
+                } );
         }
 
         BRepTopologyInspectionResult inspect_brep_topology(
             const BRepTopologyInspector& brep_topology_inspector ) const
+        {
+            return inspect_brep_topology( brep_topology_inspector,
+                internal::BRepUniqueVerticesSummary{ brep_ },
+                internal::InspectedComponents{} );
+        }
+
+        BRepTopologyInspectionResult inspect_brep_topology(
+            const BRepTopologyInspector& brep_topology_inspector,
+            absl::Span< const uuid > components,
+            absl::Span< const index_t > unique_vertices ) const
+        {
+            return inspect_brep_topology( brep_topology_inspector,
+                internal::BRepUniqueVerticesSummary{ brep_,
+                    internal::components_unique_vertices(
+                        brep_, components, unique_vertices ) },
+                internal::InspectedComponents{ components } );
+        }
+
+    private:
+        BRepTopologyInspectionResult inspect_brep_topology(
+            const BRepTopologyInspector& brep_topology_inspector,
+            const internal::BRepUniqueVerticesSummary& summary,
+            const internal::InspectedComponents& components ) const
         {
             BRepTopologyInspectionResult result;
-            async::parallel_invoke(
-                [&result, &brep_topology_inspector] {
+            internal::parallel_invoke(
+                [&result, &brep_topology_inspector, &summary, &components] {
+                    const internal::TraceScope trace{ "topology", "corners" };
                     result.corners =
-                        brep_topology_inspector.inspect_corners_topology();
+                        brep_topology_inspector.inspect_corners_topology(
+                            summary, components );
                 },
-                [&result, &brep_topology_inspector] {
+                [&result, &brep_topology_inspector, &summary, &components] {
+                    const internal::TraceScope trace{ "topology", "lines" };
                     result.lines =
-                        brep_topology_inspector.inspect_lines_topology();
+                        brep_topology_inspector.inspect_lines_topology(
+                            summary, components );
                 },
-                [&result, &brep_topology_inspector] {
+                [&result, &brep_topology_inspector, &summary, &components] {
+                    const internal::TraceScope trace{ "topology", "surfaces" };
                     result.surfaces =
-                        brep_topology_inspector.inspect_surfaces_topology();
+                        brep_topology_inspector.inspect_surfaces_topology(
+                            summary, components );
                 },
-                [&result, &brep_topology_inspector] {
-                    result.blocks = brep_topology_inspector.inspect_blocks();
+                [&result, &brep_topology_inspector, &summary, &components] {
+                    const internal::TraceScope trace{ "topology", "blocks" };
+                    result.blocks = brep_topology_inspector.inspect_blocks(
+                        summary, components );
                 } );
-            add_unique_vertices_with_wrong_cmv_link( result );
+            add_unique_vertices_with_wrong_cmv_link( summary, result );
             return result;
         }
 
-    private:
-        bool cmv_exists_in_brep( const ComponentMeshVertex& cmv ) const
+        struct CmvLinkIssues
         {
-            if( cmv.component_id.type() == Corner3D::component_type_static() )
+            InspectionIssues< index_t > not_linked;
+            InspectionIssues< index_t > linked_to_inexistant;
+            InspectionIssues< index_t > linked_to_nonbijective;
+        };
+
+        void add_unique_vertex_with_wrong_cmv_link(
+            const internal::BRepUniqueVerticesSummary& summary,
+            const BRepComponentsVertices& components_vertices,
+            index_t uv_id,
+            CmvLinkIssues& issues ) const
+        {
+            const auto& unique_vertex_cmvs =
+                brep_.component_mesh_vertices( uv_id );
+            if( unique_vertex_cmvs.empty() )
             {
-                if( brep_.has_corner( cmv.component_id.id() )
-                    && cmv.vertex < brep_.corner( cmv.component_id.id() )
-                               .mesh()
-                               .nb_vertices() )
-                {
-                    return true;
-                }
+                issues.not_linked.add_issue( uv_id,
+                    absl::StrCat( "Unique vertex with id ", uv_id,
+                        " is not linked to any component mesh vertex." ) );
+                return;
             }
-            if( cmv.component_id.type() == Line3D::component_type_static() )
+            const auto components = summary.cmv_components( uv_id );
+            for( const auto cmv_id : Indices{ unique_vertex_cmvs } )
             {
-                if( brep_.has_line( cmv.component_id.id() )
-                    && cmv.vertex < brep_.line( cmv.component_id.id() )
-                               .mesh()
-                               .nb_vertices() )
+                const auto& cmv = unique_vertex_cmvs[cmv_id];
+                if( components_vertices.contains( cmv, components[cmv_id] ) )
                 {
-                    return true;
-                }
-            }
-            if( cmv.component_id.type() == Surface3D::component_type_static() )
-            {
-                if( brep_.has_surface( cmv.component_id.id() )
-                    && cmv.vertex < brep_.surface( cmv.component_id.id() )
-                               .mesh()
-                               .nb_vertices() )
-                {
-                    return true;
-                }
-            }
-            if( cmv.component_id.type() == Block3D::component_type_static() )
-            {
-                if( brep_.has_block( cmv.component_id.id() )
-                    && cmv.vertex < brep_.block( cmv.component_id.id() )
-                               .mesh()
-                               .nb_vertices() )
-                {
-                    return true;
+                    if( brep_.unique_vertex( cmv ) != uv_id )
+                    {
+                        issues.linked_to_nonbijective.add_issue( uv_id,
+                            absl::StrCat( "Unique vertex with id ", uv_id,
+                                " is linked to inexistant component "
+                                "mesh vertex [",
+                                cmv.string(), "]." ) );
+                    }
+                    continue;
                 }
+                issues.linked_to_inexistant.add_issue(
+                    uv_id, absl::StrCat( "Unique vertex with id ", uv_id,
+                               " is linked to inexistant component "
+                               "mesh vertex [",
+                               cmv.string(), "]." ) );
             }
-            return false;
         }
 
         bool brep_meshed_components_are_linked_to_unique_vertices(
@@ -323,4 +420,18 @@ namespace geode
     {
         return impl_->inspect_brep_topology( *this );
     }
+
+    BRepTopologyInspectionResult BRepTopologyInspector::inspect_brep_topology(
+        absl::Span< const uuid > components ) const
+    {
+        return inspect_brep_topology( components, {} );
+    }
+
+    BRepTopologyInspectionResult BRepTopologyInspector::inspect_brep_topology(
+        absl::Span< const uuid > components,
+        absl::Span< const index_t > unique_vertices ) const
+    {
+        return impl_->inspect_brep_topology(
+            *this, components, unique_vertices );
+    }
 } // namespace geode
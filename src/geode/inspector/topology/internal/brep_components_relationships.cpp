@@ -0,0 +1,415 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/inspector/topology/internal/brep_components_relationships.hpp>
+
+#include <algorithm>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/flat_hash_set.h>
+
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/corner.hpp>
+#include <geode/model/mixin/core/line.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+#include <geode/model/representation/core/brep.hpp>
+
+#include <geode/inspector/internal/parallel.hpp>
+
+namespace
+{
+    using ComponentsRelationships =
+        geode::internal::BRepComponentsRelationships;
+
+    ComponentsRelationships::ComponentKind component_kind(
+        const geode::ComponentType& type )
+    {
+        if( type == geode::Corner3D::component_type_static() )
+        {
+            return ComponentsRelationships::ComponentKind::corner;
+        }
+        if( type == geode::Line3D::component_type_static() )
+        {
+            return ComponentsRelationships::ComponentKind::line;
+        }
+        if( type == geode::Surface3D::component_type_static() )
+        {
+            return ComponentsRelationships::ComponentKind::surface;
+        }
+        if( type == geode::Block3D::component_type_static() )
+        {
+            return ComponentsRelationships::ComponentKind::block;
+        }
+        return ComponentsRelationships::ComponentKind::other;
+    }
+
+    bool brep_has_component(
+        const geode::BRep& brep, const geode::ComponentID& component_id )
+    {
+        switch( component_kind( component_id.type() ) )
+        {
+        case ComponentsRelationships::ComponentKind::corner:
+            return brep.has_corner( component_id.id() );
+        case ComponentsRelationships::ComponentKind::line:
+            return brep.has_line( component_id.id() );
+        case ComponentsRelationships::ComponentKind::surface:
+            return brep.has_surface( component_id.id() );
+        case ComponentsRelationships::ComponentKind::block:
+            return brep.has_block( component_id.id() );
+        default:
+            return false;
+        }
+    }
+
+    template < typename ComponentRange >
+    void add_components_ids( const ComponentRange& components,
+        std::vector< geode::ComponentID >& components_ids )
+    {
+        for( const auto& component : components )
+        {
+            components_ids.push_back( component.component_id() );
+        }
+    }
+
+    /*!
+     * Calls related_functor( related_component_id ) on every component which
+     * is a boundary, an incidence, an internal or an embedding of the given
+     * one.
+     */
+    template < typename RelatedFunctor >
+    void for_each_related_component( const geode::BRep& brep,
+        const geode::uuid& component_id,
+        const RelatedFunctor& related_functor )
+    {
+        for( const auto& boundary :
+            brep.Relationships::boundaries( component_id ) )
+        {
+            related_functor( boundary );
+        }
+        for( const auto& incidence :
+            brep.Relationships::incidences( component_id ) )
+        {
+            related_functor( incidence );
+        }
+        for( const auto& internal :
+            brep.Relationships::internals( component_id ) )
+        {
+            related_functor( internal );
+        }
+        for( const auto& embedding :
+            brep.Relationships::embeddings( component_id ) )
+        {
+            related_functor( embedding );
+        }
+    }
+} // namespace
+
+namespace geode
+{
+    namespace internal
+    {
+        BRepComponentsRelationships::BRepComponentsRelationships(
+            const BRep& brep,
+            absl::Span< const ComponentID > components,
+            Scope scope )
+            : scope_{ scope }
+        {
+            std::vector< ComponentID > recorded;
+            std::vector< ComponentID > indexed{ components.begin(),
+                components.end() };
+            if( scope == Scope::whole_model )
+            {
+                recorded.reserve( brep.nb_corners() + brep.nb_lines()
+                                  + brep.nb_surfaces() + brep.nb_blocks() );
+                add_components_ids( brep.corners(), recorded );
+                add_components_ids( brep.lines(), recorded );
+                add_components_ids( brep.surfaces(), recorded );
+                add_components_ids( brep.blocks(), recorded );
+            }
+            else
+            {
+                absl::flat_hash_set< uuid > known_components;
+                const auto record = [&recorded, &known_components](
+                                        const ComponentID& component_id ) {
+                    if( known_components.insert( component_id.id() ).second )
+                    {
+                        recorded.push_back( component_id );
+                    }
+                };
+                for( const auto& component_id : components )
+                {
+                    if( brep_has_component( brep, component_id ) )
+                    {
+                        record( component_id );
+                        for_each_related_component(
+                            brep, component_id.id(), record );
+                    }
+                }
+                for( const auto& component_id : recorded )
+                {
+                    for_each_related_component( brep, component_id.id(),
+                        [&indexed]( const ComponentID& related ) {
+                            indexed.push_back( related );
+                        } );
+                }
+            }
+            indexed.insert( indexed.end(), recorded.begin(), recorded.end() );
+            index_components( std::move( indexed ) );
+
+            std::vector< std::vector< Relation > > chunks_boundaries(
+                nb_parallel_chunks( recorded.size() ) );
+            std::vector< std::vector< Relation > > chunks_internals(
+                nb_parallel_chunks( recorded.size() ) );
+            parallel_for_chunks( recorded.size(),
+                [this, &brep, &recorded, &chunks_boundaries,
+                    &chunks_internals](
+                    index_t chunk_id, index_t begin, index_t end ) {
+                    auto& chunk_boundaries = chunks_boundaries[chunk_id];
+                    auto& chunk_internals = chunks_internals[chunk_id];
+                    for( const auto recorded_id : Range{ begin, end } )
+                    {
+                        const auto& id = recorded[recorded_id].id();
+                        const auto component = component_indices_.at( id );
+                        for( const auto& boundary :
+                            brep.Relationships::boundaries( id ) )
+                        {
+                            chunk_boundaries.emplace_back(
+                                component_indices_.at( boundary.id() ),
+                                component );
+                        }
+                        for( const auto& incidence :
+                            brep.Relationships::incidences( id ) )
+                        {
+                            chunk_boundaries.emplace_back( component,
+                                component_indices_.at( incidence.id() ) );
+                        }
+                        for( const auto& internal :
+                            brep.Relationships::internals( id ) )
+                        {
+                            chunk_internals.emplace_back(
+                                component_indices_.at( internal.id() ),
+                                component );
+                        }
+                        for( const auto& embedding :
+                            brep.Relationships::embeddings( id ) )
+                        {
+                            chunk_internals.emplace_back( component,
+                                component_indices_.at( embedding.id() ) );
+                        }
+                    }
+                } );
+            std::vector< Relation > boundary_relations;
+            for( const auto& chunk_boundaries : chunks_boundaries )
+            {
+                boundary_relations.insert( boundary_relations.end(),
+                    chunk_boundaries.begin(), chunk_boundaries.end() );
+            }
+            std::vector< Relation > internal_relations;
+            for( const auto& chunk_internals : chunks_internals )
+            {
+                internal_relations.insert( internal_relations.end(),
+                    chunk_internals.begin(), chunk_internals.end() );
+            }
+            incidences_ =
+                build_adjacency( nb_components(), boundary_relations );
+            embeddings_ =
+                build_adjacency( nb_components(), internal_relations );
+            for( auto& relation : boundary_relations )
+            {
+                std::swap( relation.first, relation.second );
+            }
+            for( auto& relation : internal_relations )
+            {
+                std::swap( relation.first, relation.second );
+            }
+            boundaries_ =
+                build_adjacency( nb_components(), boundary_relations );
+            internals_ =
+                build_adjacency( nb_components(), internal_relations );
+        }
+
+        void BRepComponentsRelationships::index_components(
+            std::vector< ComponentID > components )
+        {
+            absl::flat_hash_set< uuid > known_components;
+            std::vector< std::pair< ComponentKind, ComponentID > > sorted;
+            sorted.reserve( components.size() );
+            for( auto& component_id : components )
+            {
+                if( known_components.insert( component_id.id() ).second )
+                {
+                    const auto kind = component_kind( component_id.type() );
+                    sorted.emplace_back( kind, std::move( component_id ) );
+                }
+            }
+            absl::c_sort( sorted, []( const auto& lhs, const auto& rhs ) {
+                if( lhs.first != rhs.first )
+                {
+                    return lhs.first < rhs.first;
+                }
+                return lhs.second.id() < rhs.second.id();
+            } );
+            components_.reserve( sorted.size() );
+            component_indices_.reserve( sorted.size() );
+            for( auto& component : sorted )
+            {
+                component_indices_.emplace( component.second.id(),
+                    static_cast< index_t >( components_.size() ) );
+                kinds_begin_[static_cast< index_t >( component.first ) + 1]++;
+                components_.push_back( std::move( component.second ) );
+            }
+            for( const auto kind : LRange{ 5 } )
+            {
+                kinds_begin_[kind + 1] += kinds_begin_[kind];
+            }
+        }
+
+        BRepComponentsRelationships::Adjacency
+            BRepComponentsRelationships::build_adjacency(
+                index_t nb_components, absl::Span< const Relation > relations )
+        {
+            std::vector< Relation > sorted{ relations.begin(),
+                relations.end() };
+            parallel_sort( sorted.begin(), sorted.end(),
+                []( const Relation& lhs, const Relation& rhs ) {
+                    return lhs < rhs;
+                } );
+            sorted.erase(
+                std::unique( sorted.begin(), sorted.end() ), sorted.end() );
+            Adjacency adjacency;
+            adjacency.offsets.assign( nb_components + 1, 0 );
+            adjacency.values.reserve( sorted.size() );
+            for( const auto& relation : sorted )
+            {
+                adjacency.offsets[relation.first + 1]++;
+                adjacency.values.push_back( relation.second );
+            }
+            for( const auto component : Range{ nb_components } )
+            {
+                adjacency.offsets[component + 1] +=
+                    adjacency.offsets[component];
+            }
+            return adjacency;
+        }
+
+        absl::Span< const index_t >
+            BRepComponentsRelationships::Adjacency::related(
+                index_t component ) const
+        {
+            return absl::MakeConstSpan( values ).subspan( offsets[component],
+                offsets[component + 1] - offsets[component] );
+        }
+
+        BRepComponentsRelationships::Scope
+            BRepComponentsRelationships::scope() const
+        {
+            return scope_;
+        }
+
+        index_t BRepComponentsRelationships::nb_components() const
+        {
+            return components_.size();
+        }
+
+        const ComponentID& BRepComponentsRelationships::component_id(
+            index_t component ) const
+        {
+            return components_[component];
+        }
+
+        index_t BRepComponentsRelationships::component_index(
+            const uuid& component_id ) const
+        {
+            const auto it = component_indices_.find( component_id );
+            if( it == component_indices_.end() )
+            {
+                return NO_ID;
+            }
+            return it->second;
+        }
+
+        index_t BRepComponentsRelationships::kind_begin(
+            ComponentKind kind ) const
+        {
+            return kinds_begin_[static_cast< index_t >( kind )];
+        }
+
+        index_t BRepComponentsRelationships::kind_end(
+            ComponentKind kind ) const
+        {
+            return kinds_begin_[static_cast< index_t >( kind ) + 1];
+        }
+
+        bool BRepComponentsRelationships::is_kind(
+            index_t component, ComponentKind kind ) const
+        {
+            return component >= kind_begin( kind )
+                   && component < kind_end( kind );
+        }
+
+        BRepComponentsRelationships::ComponentKind
+            BRepComponentsRelationships::kind( index_t component ) const
+        {
+            const auto next_kind = std::upper_bound(
+                kinds_begin_.begin(), kinds_begin_.end(), component );
+            return static_cast< ComponentKind >(
+                std::distance( kinds_begin_.begin(), next_kind ) - 1 );
+        }
+
+        absl::Span< const index_t > BRepComponentsRelationships::boundaries(
+            index_t component ) const
+        {
+            return boundaries_.related( component );
+        }
+
+        absl::Span< const index_t > BRepComponentsRelationships::incidences(
+            index_t component ) const
+        {
+            return incidences_.related( component );
+        }
+
+        absl::Span< const index_t > BRepComponentsRelationships::internals(
+            index_t component ) const
+        {
+            return internals_.related( component );
+        }
+
+        absl::Span< const index_t > BRepComponentsRelationships::embeddings(
+            index_t component ) const
+        {
+            return embeddings_.related( component );
+        }
+
+        bool BRepComponentsRelationships::is_boundary(
+            index_t boundary, index_t incidence ) const
+        {
+            return absl::c_binary_search( incidences( boundary ), incidence );
+        }
+
+        bool BRepComponentsRelationships::is_internal(
+            index_t internal, index_t embedding ) const
+        {
+            return absl::c_binary_search( embeddings( internal ), embedding );
+        }
+    } // namespace internal
+} // namespace geode
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/inspector/topology/internal/brep_unique_vertices_summary.hpp>
+
+#include <algorithm>
+
+#include <absl/container/flat_hash_set.h>
+
+#include <geode/model/representation/core/brep.hpp>
+
+#include <geode/inspector/internal/parallel.hpp>
+#include <geode/inspector/topology/internal/topology_helpers.hpp>
+
+namespace geode
+{
+    namespace internal
+    {
+        BRepUniqueVerticesSummary::BRepUniqueVerticesSummary(
+            const BRep& brep )
+        {
+            build( brep, brep.nb_unique_vertices(),
+                []( index_t unique_vertex ) {
+                    return unique_vertex;
+                } );
+        }
+
+        BRepUniqueVerticesSummary::BRepUniqueVerticesSummary(
+            const BRep& brep, absl::Span< const index_t > unique_vertices )
+            : all_unique_vertices_{ false },
+              unique_vertices_( unique_vertices.begin(), unique_vertices.end() )
+        {
+            positions_.reserve( unique_vertices.size() );
+            for( const auto position : Indices{ unique_vertices } )
+            {
+                positions_.emplace( unique_vertices[position], position );
+            }
+            build( brep, unique_vertices.size(),
+                [&unique_vertices]( index_t position ) {
+                    return unique_vertices[position];
+                } );
+        }
+
+        template < typename UniqueVertexFunctor >
+        void BRepUniqueVerticesSummary::build( const BRep& brep,
+            index_t nb_vertices,
+            const UniqueVertexFunctor& unique_vertex )
+        {
+            offsets_.assign( nb_vertices + 1, 0 );
+            std::vector< std::vector< ComponentID > > chunks_components(
+                nb_parallel_chunks( nb_vertices ) );
+            parallel_for_chunks( nb_vertices,
+                [this, &brep, &unique_vertex, &chunks_components](
+                    index_t chunk_id, index_t begin, index_t end ) {
+                    absl::flat_hash_set< uuid > chunk_uuids;
+                    auto& chunk_components = chunks_components[chunk_id];
+                    for( const auto vertex : Range{ begin, end } )
+                    {
+                        const auto& cmvs = brep.component_mesh_vertices(
+                            unique_vertex( vertex ) );
+                        offsets_[vertex + 1] = cmvs.size();
+                        for( const auto& cmv : cmvs )
+                        {
+                            if( chunk_uuids.insert( cmv.component_id.id() )
+                                    .second )
+                            {
+                                chunk_components.push_back( cmv.component_id );
+                            }
+                        }
+                    }
+                } );
+            std::vector< ComponentID > components;
+            for( const auto& chunk_components : chunks_components )
+            {
+                components.insert( components.end(), chunk_components.begin(),
+                    chunk_components.end() );
+            }
+            relationships_.emplace( brep, components,
+                all_unique_vertices_
+                    ? BRepComponentsRelationships::Scope::whole_model
+                    : BRepComponentsRelationships::Scope::neighborhood );
+            for( const auto vertex : Range{ nb_vertices } )
+            {
+                offsets_[vertex + 1] += offsets_[vertex];
+            }
+            vertex_components_.resize( offsets_.back() );
+            cmv_components_.resize( offsets_.back() );
+            parallel_for_chunks( nb_vertices,
+                [this, &brep, &unique_vertex](
+                    index_t /*chunk_id*/, index_t begin, index_t end ) {
+                    for( const auto vertex : Range{ begin, end } )
+                    {
+                        auto current = offsets_[vertex];
+                        for( const auto& cmv : brep.component_mesh_vertices(
+                                 unique_vertex( vertex ) ) )
+                        {
+                            const auto component =
+                                relationships_->component_index(
+                                    cmv.component_id.id() );
+                            cmv_components_[current] = component;
+                            vertex_components_[current++] = { component,
+                                cmv.vertex };
+                        }
+                        std::stable_sort(
+                            vertex_components_.begin() + offsets_[vertex],
+                            vertex_components_.begin() + current,
+                            [this]( const VertexComponent& lhs,
+                                const VertexComponent& rhs ) {
+                                return relationships_->kind( lhs.component )
+                                       < relationships_->kind(
+                                           rhs.component );
+                            } );
+                    }
+                } );
+            blocks_are_meshed_ = brep_blocks_are_meshed( brep );
+        }
+
+        index_t BRepUniqueVerticesSummary::nb_unique_vertices() const
+        {
+            return offsets_.size() - 1;
+        }
+
+        index_t BRepUniqueVerticesSummary::unique_vertex(
+            index_t position ) const
+        {
+            if( all_unique_vertices_ )
+            {
+                return position;
+            }
+            return unique_vertices_[position];
+        }
+
+        bool BRepUniqueVerticesSummary::blocks_are_meshed() const
+        {
+            return blocks_are_meshed_;
+        }
+
+        const BRepComponentsRelationships&
+            BRepUniqueVerticesSummary::relationships() const
+        {
+            return *relationships_;
+        }
+
+        absl::Span< const BRepUniqueVerticesSummary::VertexComponent >
+            BRepUniqueVerticesSummary::vertex_components(
+                index_t unique_vertex ) const
+        {
+            const auto vertex = position( unique_vertex );
+            return absl::MakeConstSpan( vertex_components_ )
+                .subspan( offsets_[vertex],
+                    offsets_[vertex + 1] - offsets_[vertex] );
+        }
+
+        absl::Span< const index_t > BRepUniqueVerticesSummary::cmv_components(
+            index_t unique_vertex ) const
+        {
+            const auto vertex = position( unique_vertex );
+            return absl::MakeConstSpan( cmv_components_ )
+                .subspan( offsets_[vertex],
+                    offsets_[vertex + 1] - offsets_[vertex] );
+        }
+
+        absl::Span< const BRepUniqueVerticesSummary::VertexComponent >
+            BRepUniqueVerticesSummary::vertex_components(
+                index_t unique_vertex, ComponentKind kind ) const
+        {
+            const auto all = vertex_components( unique_vertex );
+            const auto is_before = []( const VertexComponent& vertex_component,
+                                       index_t component_index ) {
+                return vertex_component.component < component_index;
+            };
+            const auto begin = std::lower_bound( all.begin(), all.end(),
+                relationships_->kind_begin( kind ), is_before );
+            const auto end = std::lower_bound(
+                begin, all.end(), relationships_->kind_end( kind ), is_before );
+            return all.subspan( begin - all.begin(), end - begin );
+        }
+
+        absl::InlinedVector< index_t, 4 >
+            BRepUniqueVerticesSummary::components(
+                index_t unique_vertex, ComponentKind kind ) const
+        {
+            absl::InlinedVector< index_t, 4 > result;
+            for( const auto& vertex_component :
+                vertex_components( unique_vertex, kind ) )
+            {
+                result.push_back( vertex_component.component );
+            }
+            std::sort( result.begin(), result.end() );
+            result.erase(
+                std::unique( result.begin(), result.end() ), result.end() );
+            return result;
+        }
+
+        index_t BRepUniqueVerticesSummary::nb_component_vertices(
+            index_t unique_vertex, index_t component_index ) const
+        {
+            const auto kind_components = vertex_components(
+                unique_vertex, relationships_->kind( component_index ) );
+            return static_cast< index_t >( std::count_if(
+                kind_components.begin(), kind_components.end(),
+                [component_index]( const VertexComponent& vertex_component ) {
+                    return vertex_component.component == component_index;
+                } ) );
+        }
+
+        bool BRepUniqueVerticesSummary::has_component(
+            index_t unique_vertex, index_t component_index ) const
+        {
+            return nb_component_vertices( unique_vertex, component_index ) != 0;
+        }
+
+        index_t BRepUniqueVerticesSummary::position(
+            index_t unique_vertex ) const
+        {
+            if( all_unique_vertices_ )
+            {
+                return unique_vertex;
+            }
+            return positions_.at( unique_vertex );
+        }
+    } // namespace internal
+} // namespace geode
@@ -35,6 +35,8 @@
 #include <geode/model/mixin/core/surface.hpp>
 #include <geode/model/representation/core/section.hpp>
 
+#include <geode/inspector/internal/parallel.hpp>
+
 namespace geode
 {
     index_t SectionTopologyInspectionResult::nb_issues() const
@@ -68,28 +70,24 @@ namespace geode
             section_unique_vertices_are_bijectively_linked_to_an_existing_component_vertex()
                 const
         {
-            for( const auto uv_id : Range{ section_.nb_unique_vertices() } )
-            {
-                const auto& unique_vertex_cmvs =
-                    section_.component_mesh_vertices( uv_id );
-                if( unique_vertex_cmvs.empty() )
-                {
-                    return false;
-                }
-                for( const auto& cmv : unique_vertex_cmvs )
-                {
-                    if( cmv_exists_in_section( cmv ) )
+            return !internal::parallel_any_of(
+                section_.nb_unique_vertices(), [this]( index_t uv_id ) {
+                    const auto& unique_vertex_cmvs =
+                        section_.component_mesh_vertices( uv_id );
+                    if( unique_vertex_cmvs.empty() )
                     {
-                        if( section_.unique_vertex( cmv ) != uv_id )
+                        return true;
+                    }
+                    for( const auto& cmv : unique_vertex_cmvs )
+                    {
+                        if( !cmv_exists_in_section( cmv )
+                            || section_.unique_vertex( cmv ) != uv_id )
                         {
-                            return false;
+                            return true;
                         }
-                        continue;
                     }
                     return false;
-                }
-            }
-            return true;
+                } );
         }
 
         void add_unique_vertices_with_wrong_cmv_link(
@@ -151,21 +149,18 @@ namespace geode
             {
                 return false;
             }
-            for( const auto unique_vertex_id :
-                Range{ section_.nb_unique_vertices() } )
-            {
-                if( !section_topology_inspector
-                        .section_corner_topology_is_valid( unique_vertex_id )
-                    || !section_topology_inspector
-                        .section_lines_topology_is_valid( unique_vertex_id )
-                    || !section_topology_inspector
-                        .section_vertex_surfaces_topology_is_valid(
-                            unique_vertex_id ) )
-                {
-                    return false;
-                }
-            }
-            return true;
+            return !internal::parallel_any_of( section_.nb_unique_vertices(),
+                [&section_topology_inspector]( index_t unique_vertex_id ) {
+                    return !section_topology_inspector
+                                .section_corner_topology_is_valid(
+                                    unique_vertex_id )
+                           || !section_topology_inspector
+                                   .section_lines_topology_is_valid(
+                                       unique_vertex_id )
+                           || !section_topology_inspector
+                                   .section_vertex_surfaces_topology_is_valid(
+                                       unique_vertex_id );
+                } );
         }
 
         SectionTopologyInspectionResult inspect_section_topology(
@@ -23,14 +23,38 @@
 
 #include <geode/tests_config.hpp>
 
+#include <absl/algorithm/container.h>
+#include <absl/strings/match.h>
+
+#include <async++.h>
+
 #include <geode/basic/assert.hpp>
 #include <geode/basic/logger.hpp>
+#include <geode/basic/range.hpp>
+
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/builder/surface_mesh_builder.hpp>
+#include <geode/mesh/builder/tetrahedral_solid_builder.hpp>
+#include <geode/mesh/builder/triangulated_surface_builder.hpp>
+#include <geode/mesh/core/geode/geode_tetrahedral_solid.hpp>
+#include <geode/mesh/core/geode/geode_triangulated_surface.hpp>
+#include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
 
+#include <geode/model/helpers/component_mesh_polygons.hpp>
 #include <geode/model/helpers/convert_model_meshes.hpp>
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+#include <geode/model/representation/builder/brep_builder.hpp>
 #include <geode/model/representation/core/brep.hpp>
 #include <geode/model/representation/io/brep_input.hpp>
 
 #include <geode/inspector/brep_inspector.hpp>
+#include <geode/inspector/criterion/adjacency/solid_adjacency.hpp>
+#include <geode/inspector/defects_injection.hpp>
+#include <geode/inspector/inspection_context.hpp>
+#include <geode/inspector/inspection_trace.hpp>
 
 geode::index_t corners_topological_validity(
     const geode::BRepCornersTopologyInspectionResult& result, bool string )
@@ -320,6 +344,542 @@ void check_model_a1( bool string )
     OPENGEODE_EXCEPTION( nb_component_meshes_issues == 13494,
         "[Test] model_A1 has ", nb_component_meshes_issues,
         " meshes problems instead of 13494." );
+    OPENGEODE_EXCEPTION(
+        !brep_inspector.is_valid(), "[Test] model_A1 should not be valid." );
+}
+
+void check_model_a1_options( const geode::BRep& model_brep )
+{
+    const geode::BRepInspector brep_inspector{ model_brep };
+    auto options = geode::InspectionOptions::no_criterion();
+    options.enable( geode::InspectionCriterion::topology )
+        .enable( geode::InspectionCriterion::adjacency );
+    const auto result = brep_inspector.inspect_brep( options );
+
+    const auto nb_topological_issues =
+        launch_topological_validity_checks( result.topology, false );
+    OPENGEODE_EXCEPTION( nb_topological_issues == 267, "[Test] model_A1 has ",
+        nb_topological_issues, " topological problems instead of 267." );
+    const auto& meshes = result.meshes;
+    OPENGEODE_EXCEPTION( meshes.meshes_intersections.nb_issues() == 0
+                             && meshes.meshes_colocation.nb_issues() == 0,
+        "[Test] model_A1 disabled criteria should not be inspected." );
+    const auto nb_adjacency_issues =
+        meshes_adjacencies_validity( result.meshes.meshes_adjacencies, false );
+    const auto full_result = brep_inspector.inspect_brep_meshes();
+    OPENGEODE_EXCEPTION( nb_adjacency_issues
+                             == full_result.meshes_adjacencies.nb_issues(),
+        "[Test] model_A1 has ", nb_adjacency_issues,
+        " adjacency problems instead of ",
+        full_result.meshes_adjacencies.nb_issues(), "." );
+}
+
+void check_model_a1_deadline( const geode::BRep& model_brep )
+{
+    const geode::BRepInspector brep_inspector{ model_brep };
+    geode::InspectionOptions options;
+    options.set_time_limit( std::chrono::hours{ 1 } );
+    const auto result = brep_inspector.inspect_brep( options );
+    OPENGEODE_EXCEPTION( result.status == geode::InspectionStatus::complete
+                             && result.meshes.status
+                                    == geode::InspectionStatus::complete,
+        "[Test] model_A1 inspection should be complete." );
+    OPENGEODE_EXCEPTION( result.topology.nb_issues()
+                             == brep_inspector.inspect_brep_topology()
+                                    .nb_issues(),
+        "[Test] model_A1 complete inspection should find every issue." );
+
+    geode::InspectionCancellation cancellation;
+    cancellation.cancel();
+    geode::InspectionOptions cancelled_options;
+    cancelled_options.set_cancellation( cancellation );
+    const auto cancelled_result =
+        brep_inspector.inspect_brep( cancelled_options );
+    OPENGEODE_EXCEPTION(
+        cancelled_result.status == geode::InspectionStatus::truncated,
+        "[Test] model_A1 cancelled inspection should be truncated." );
+    OPENGEODE_EXCEPTION( cancelled_result.nb_issues() < result.nb_issues(),
+        "[Test] model_A1 cancelled inspection should find less issues." );
+
+    geode::InspectionOptions expired_options;
+    expired_options.set_deadline( std::chrono::steady_clock::now() );
+    const auto expired_result =
+        brep_inspector.inspect_brep_meshes( expired_options );
+    OPENGEODE_EXCEPTION(
+        expired_result.status == geode::InspectionStatus::truncated,
+        "[Test] model_A1 inspection after its deadline should be "
+        "truncated." );
+}
+
+void check_model_a1_profile( const geode::BRep& model_brep )
+{
+    const geode::BRepInspector brep_inspector{ model_brep };
+    const auto result =
+        brep_inspector.inspect_brep( geode::InspectionOptions{} );
+    OPENGEODE_EXCEPTION( result.profile.empty(),
+        "[Test] model_A1 inspection should not be profiled by default." );
+
+    geode::InspectionOptions options;
+    options.set_profiled( true );
+    const auto profiled_result = brep_inspector.inspect_brep( options );
+    OPENGEODE_EXCEPTION( profiled_result.profile.criteria().size() == 8,
+        "[Test] model_A1 profile should have one entry per criterion." );
+    std::size_t nb_profiled_components{ 0 };
+    for( const auto& criterion : profiled_result.profile.criteria() )
+    {
+        OPENGEODE_EXCEPTION(
+            criterion.wall_time >= 0 && criterion.nb_elements > 0,
+            "[Test] model_A1 profile of ", criterion.criterion,
+            " is wrong." );
+        OPENGEODE_EXCEPTION(
+            absl::c_is_sorted( criterion.components,
+                []( const geode::ComponentProfile& lhs,
+                    const geode::ComponentProfile& rhs ) {
+                    return lhs.wall_time > rhs.wall_time;
+                } ),
+            "[Test] model_A1 components profile of ", criterion.criterion,
+            " should be sorted by decreasing wall time." );
+        for( const auto& component : criterion.components )
+        {
+            OPENGEODE_EXCEPTION(
+                component.wall_time >= 0 && !component.task.empty(),
+                "[Test] model_A1 profile of ", criterion.criterion,
+                " component ", component.component.string(), " is wrong." );
+        }
+        OPENGEODE_EXCEPTION( criterion.components.empty()
+                                 || criterion.critical_path
+                                        == criterion.components.front()
+                                               .wall_time,
+            "[Test] model_A1 critical path of ", criterion.criterion,
+            " should be its longest component task." );
+        OPENGEODE_EXCEPTION( criterion.critical_path <= criterion.wall_time,
+            "[Test] model_A1 critical path of ", criterion.criterion,
+            " should not exceed its wall time." );
+        nb_profiled_components += criterion.components.size();
+    }
+    OPENGEODE_EXCEPTION( nb_profiled_components > 0,
+        "[Test] model_A1 profile should have component entries." );
+    OPENGEODE_EXCEPTION( profiled_result.nb_issues() == result.nb_issues(),
+        "[Test] model_A1 profiled inspection should find the same "
+        "issues." );
+}
+
+void check_model_a1_trace( const geode::BRep& model_brep )
+{
+    const geode::BRepInspector brep_inspector{ model_brep };
+    geode::start_inspection_trace();
+    const auto result = brep_inspector.inspect_brep();
+    const auto trace = geode::stop_inspection_trace();
+    for( const auto* event : { "\"cat\":\"criterion\"",
+             "\"cat\":\"topology\"", "\"cat\":\"component\"" } )
+    {
+        OPENGEODE_EXCEPTION( absl::StrContains( trace, event ),
+            "[Test] model_A1 trace should contain ", event, " events." );
+    }
+    const auto stopped_trace = geode::stop_inspection_trace();
+    OPENGEODE_EXCEPTION( !absl::StrContains( stopped_trace, "\"ph\":\"X\"" ),
+        "[Test] Stopped trace should not record events." );
+}
+
+void check_model_a1_progress( const geode::BRep& model_brep )
+{
+    const geode::BRepInspector brep_inspector{ model_brep };
+    std::vector< std::string > criteria;
+    bool valid_counts{ true };
+    bool final_reported{ false };
+    geode::InspectionOptions options;
+    options.set_progress_callback(
+        [&criteria, &valid_counts, &final_reported](
+            const geode::InspectionProgress& progress ) {
+            criteria.emplace_back( progress.criterion );
+            valid_counts = valid_counts
+                           && progress.nb_processed <= progress.nb_elements;
+            final_reported = final_reported
+                             || progress.nb_processed == progress.nb_elements;
+        } );
+    const auto result = brep_inspector.inspect_brep( options );
+    OPENGEODE_EXCEPTION( !criteria.empty(),
+        "[Test] model_A1 inspection should report its progress." );
+    OPENGEODE_EXCEPTION( final_reported,
+        "[Test] model_A1 inspection should report the end of its loops." );
+    OPENGEODE_EXCEPTION( valid_counts,
+        "[Test] model_A1 progress should not exceed the number of "
+        "elements." );
+    for( const auto& criterion : criteria )
+    {
+        OPENGEODE_EXCEPTION( !criterion.empty(),
+            "[Test] model_A1 progress should name its criterion." );
+    }
+}
+
+void check_model_a1_context( const geode::BRep& model_brep )
+{
+    const geode::BRepInspectionContext context{ model_brep };
+    for( const auto& surface : model_brep.surfaces() )
+    {
+        const auto unique_vertices =
+            context.component_unique_vertices( surface.component_id() );
+        OPENGEODE_EXCEPTION(
+            unique_vertices.size() == surface.mesh().nb_vertices(),
+            "[Test] model_A1 context has a wrong number of vertices." );
+        for( const auto vertex : geode::Indices{ unique_vertices } )
+        {
+            OPENGEODE_EXCEPTION( unique_vertices[vertex]
+                                     == model_brep.unique_vertex(
+                                         { surface.component_id(), vertex } ),
+                "[Test] model_A1 context has a wrong unique vertex." );
+        }
+    }
+    const geode::BRepInspector brep_inspector{ model_brep };
+    const auto result = brep_inspector.inspect_brep_meshes();
+    OPENGEODE_EXCEPTION(
+        brep_inspector.inspect_intersections( context ).nb_issues()
+            == result.meshes_intersections.nb_issues(),
+        "[Test] model_A1 intersections differ with a shared context." );
+    OPENGEODE_EXCEPTION(
+        brep_inspector.inspect_brep_manifold( context ).nb_issues()
+            == result.meshes_non_manifolds.nb_issues(),
+        "[Test] model_A1 manifold issues differ with a shared context." );
+}
+
+void check_model_a1_validity_early_return( const geode::BRep& model_brep )
+{
+    const geode::BRepInspector brep_inspector{ model_brep };
+    const auto result = brep_inspector.inspect_brep_meshes();
+    OPENGEODE_EXCEPTION( brep_inspector.model_has_wrong_adjacencies()
+                             == ( result.meshes_adjacencies.nb_issues() != 0 ),
+        "[Test] model_A1 adjacency predicate differs from inspection." );
+    OPENGEODE_EXCEPTION(
+        brep_inspector.model_has_degenerated_elements()
+            == ( result.meshes_degenerations.nb_issues() != 0 ),
+        "[Test] model_A1 degeneration predicate differs from inspection." );
+    OPENGEODE_EXCEPTION(
+        brep_inspector.model_has_negative_elements()
+            == ( result.meshes_negative_elements.nb_issues() != 0 ),
+        "[Test] model_A1 negative elements predicate differs from "
+        "inspection." );
+    OPENGEODE_EXCEPTION(
+        brep_inspector.model_has_non_manifold_elements()
+            == ( result.meshes_non_manifolds.nb_issues() != 0 ),
+        "[Test] model_A1 manifold predicate differs from inspection." );
+    OPENGEODE_EXCEPTION( brep_inspector.model_has_colocated_points()
+                             == ( result.meshes_colocation.nb_issues() != 0 ),
+        "[Test] model_A1 colocation predicate differs from inspection." );
+
+    geode::InspectionCancellation cancellation;
+    cancellation.cancel();
+    geode::InspectionOptions cancelled_options;
+    cancelled_options.set_cancellation( cancellation );
+    geode::start_inspection_trace();
+    const auto is_valid = brep_inspector.is_valid( cancelled_options );
+    const auto trace = geode::stop_inspection_trace();
+    OPENGEODE_EXCEPTION(
+        !is_valid, "[Test] model_A1 cancelled validation should be false." );
+    OPENGEODE_EXCEPTION( !absl::StrContains( trace, "\"cat\":\"component\"" ),
+        "[Test] model_A1 cancelled validation should not inspect any "
+        "component mesh." );
+}
+
+void check_model_a1_concurrent_context( const geode::BRep& model_brep )
+{
+    const geode::BRepInspector brep_inspector{ model_brep };
+    const auto result = brep_inspector.inspect_brep_meshes();
+    for( const auto repetition : geode::Range{ 5 } )
+    {
+        const geode::BRepInspectionContext context{ model_brep };
+        geode::index_t nb_intersections{ 0 };
+        geode::index_t nb_non_manifolds{ 0 };
+        geode::index_t nb_adjacencies{ 0 };
+        geode::index_t nb_other_adjacencies{ 0 };
+        async::parallel_invoke(
+            [&] {
+                nb_intersections =
+                    brep_inspector.inspect_intersections( context )
+                        .nb_issues();
+            },
+            [&] {
+                nb_non_manifolds =
+                    brep_inspector.inspect_brep_manifold( context )
+                        .nb_issues();
+            },
+            [&] {
+                nb_adjacencies =
+                    brep_inspector.inspect_brep_meshes_adjacencies( context )
+                        .nb_issues();
+            },
+            [&] {
+                nb_other_adjacencies =
+                    brep_inspector.inspect_brep_meshes_adjacencies( context )
+                        .nb_issues();
+            } );
+        OPENGEODE_EXCEPTION(
+            nb_intersections == result.meshes_intersections.nb_issues(),
+            "[Test] model_A1 concurrent intersections differ at repetition ",
+            repetition, "." );
+        OPENGEODE_EXCEPTION(
+            nb_non_manifolds == result.meshes_non_manifolds.nb_issues(),
+            "[Test] model_A1 concurrent manifold issues differ at "
+            "repetition ",
+            repetition, "." );
+        OPENGEODE_EXCEPTION(
+            nb_adjacencies == result.meshes_adjacencies.nb_issues()
+                && nb_other_adjacencies == nb_adjacencies,
+            "[Test] model_A1 concurrent adjacencies differ at repetition ",
+            repetition, "." );
+    }
+}
+
+void check_same_issues( std::string_view criterion,
+    geode::index_t nb_incremental_issues, geode::index_t nb_issues )
+{
+    OPENGEODE_EXCEPTION( nb_incremental_issues == nb_issues,
+        "[Test] model_A1 incremental inspection has ", nb_incremental_issues,
+        " ", criterion, " issues instead of ", nb_issues, "." );
+}
+
+void check_same_results( const geode::BRepInspectionResult& incremental_result,
+    const geode::BRepInspectionResult& full_result )
+{
+    const auto& topology = incremental_result.topology;
+    const auto& full_topology = full_result.topology;
+    check_same_issues( "corners topology",
+        corners_topological_validity( topology.corners, false ),
+        corners_topological_validity( full_topology.corners, false ) );
+    check_same_issues( "lines topology",
+        lines_topological_validity( topology.lines, false ),
+        lines_topological_validity( full_topology.lines, false ) );
+    check_same_issues( "surfaces topology",
+        surfaces_topological_validity( topology.surfaces, false ),
+        surfaces_topological_validity( full_topology.surfaces, false ) );
+    check_same_issues( "blocks topology",
+        blocks_topological_validity( topology.blocks, false ),
+        blocks_topological_validity( full_topology.blocks, false ) );
+    check_same_issues( "unique vertices not linked to any component",
+        topology.unique_vertices_not_linked_to_any_component.nb_issues(),
+        full_topology.unique_vertices_not_linked_to_any_component
+            .nb_issues() );
+    check_same_issues( "unique vertices linked to inexistant cmv",
+        topology.unique_vertices_linked_to_inexistant_cmv.nb_issues(),
+        full_topology.unique_vertices_linked_to_inexistant_cmv.nb_issues() );
+    check_same_issues( "unique vertices non bijectively linked to cmv",
+        topology.unique_vertices_nonbijectively_linked_to_cmv.nb_issues(),
+        full_topology.unique_vertices_nonbijectively_linked_to_cmv
+            .nb_issues() );
+    const auto& meshes = incremental_result.meshes;
+    const auto& full_meshes = full_result.meshes;
+    check_same_issues( "meshes adjacencies",
+        meshes_adjacencies_validity( meshes.meshes_adjacencies, false ),
+        meshes_adjacencies_validity( full_meshes.meshes_adjacencies, false ) );
+    check_same_issues( "meshes degenerations",
+        meshes_degenerations_validity( meshes.meshes_degenerations, false ),
+        meshes_degenerations_validity(
+            full_meshes.meshes_degenerations, false ) );
+    check_same_issues( "meshes intersections",
+        meshes_intersections_validity( meshes.meshes_intersections, false ),
+        meshes_intersections_validity(
+            full_meshes.meshes_intersections, false ) );
+    check_same_issues( "meshes non manifolds",
+        meshes_manifolds_validity( meshes.meshes_non_manifolds, false ),
+        meshes_manifolds_validity( full_meshes.meshes_non_manifolds, false ) );
+    check_same_issues( "meshes colocations",
+        meshes_colocations_validity( meshes.meshes_colocation, false ),
+        meshes_colocations_validity( full_meshes.meshes_colocation, false ) );
+    check_same_issues( "unique vertices colocations",
+        meshes_unique_vertices_validity(
+            meshes.unique_vertices_colocation, false ),
+        meshes_unique_vertices_validity(
+            full_meshes.unique_vertices_colocation, false ) );
+    check_same_issues(
+        "total", incremental_result.nb_issues(), full_result.nb_issues() );
+}
+
+void check_model_a1_incremental()
+{
+    auto model_brep = geode::load_brep(
+        absl::StrCat( geode::DATA_PATH, "model_A1.og_brep" ) );
+    const geode::BRepInspector brep_inspector{ model_brep };
+    const auto result = brep_inspector.inspect_brep();
+    std::vector< std::pair< geode::uuid, geode::index_t > >
+        surfaces_nb_vertices;
+    for( const auto& surface : model_brep.surfaces() )
+    {
+        surfaces_nb_vertices.emplace_back(
+            surface.id(), surface.mesh().nb_vertices() );
+    }
+    geode::InjectedDefects defects;
+    defects.nb_degenerated_elements = 1;
+    defects.seed = 6;
+    geode::inject_brep_defects( model_brep, defects );
+    std::vector< geode::uuid > modified_components;
+    for( const auto& [surface_id, nb_vertices] : surfaces_nb_vertices )
+    {
+        if( model_brep.surface( surface_id ).mesh().nb_vertices()
+            != nb_vertices )
+        {
+            modified_components.push_back( surface_id );
+        }
+    }
+    OPENGEODE_EXCEPTION( modified_components.size() == 1,
+        "[Test] model_A1 should have exactly one modified surface." );
+
+    const auto full_result = brep_inspector.inspect_brep();
+    OPENGEODE_EXCEPTION(
+        meshes_degenerations_validity( full_result.meshes.meshes_degenerations,
+            false )
+            == meshes_degenerations_validity(
+                   result.meshes.meshes_degenerations, false )
+                   + 1,
+        "[Test] model_A1 modified surface should have one more degenerated "
+        "polygon." );
+    check_same_results(
+        brep_inspector.inspect_brep( modified_components, result ),
+        full_result );
+}
+
+void check_model_a1_incremental_deleted_vertex()
+{
+    auto model_brep = geode::load_brep(
+        absl::StrCat( geode::DATA_PATH, "model_A1.og_brep" ) );
+    const geode::BRepInspector brep_inspector{ model_brep };
+    const auto result = brep_inspector.inspect_brep();
+    std::vector< geode::uuid > modified_components;
+    for( const auto& surface : model_brep.surfaces() )
+    {
+        if( surface.mesh().nb_polygons() != 0 )
+        {
+            modified_components.push_back( surface.id() );
+            break;
+        }
+    }
+    const auto previous_unique_vertices =
+        brep_inspector.components_unique_vertices( modified_components );
+    const auto& surface = model_brep.surface( modified_components.front() );
+    const auto nb_vertices = surface.mesh().nb_vertices();
+    {
+        geode::BRepBuilder builder{ model_brep };
+        std::vector< bool > polygons_to_delete(
+            surface.mesh().nb_polygons(), false );
+        for( const auto& polygon_vertex :
+            surface.mesh().polygons_around_vertex( 0 ) )
+        {
+            polygons_to_delete[polygon_vertex.polygon_id] = true;
+        }
+        auto mesh_builder = builder.surface_mesh_builder( surface.id() );
+        mesh_builder->delete_polygons( polygons_to_delete );
+        const auto old2new = mesh_builder->delete_isolated_vertices();
+        builder.update_unique_vertices( surface.component_id(), old2new );
+    }
+    OPENGEODE_EXCEPTION( surface.mesh().nb_vertices() < nb_vertices,
+        "[Test] model_A1 modified surface should have less vertices." );
+
+    check_same_results(
+        brep_inspector.inspect_brep(
+            modified_components, previous_unique_vertices, result ),
+        brep_inspector.inspect_brep() );
+}
+
+geode::BRep create_meshed_block_brep()
+{
+    geode::BRep brep;
+    geode::BRepBuilder builder{ brep };
+    const auto surface_id = builder.add_surface(
+        geode::OpenGeodeTriangulatedSurface3D::impl_name_static() );
+    const auto& surface = brep.surface( surface_id );
+    {
+        auto mesh_builder =
+            builder.surface_mesh_builder< geode::TriangulatedSurface3D >(
+                surface_id );
+        mesh_builder->create_point( geode::Point3D{ { 0., 0., 0. } } );
+        mesh_builder->create_point( geode::Point3D{ { 1., 0., 0. } } );
+        mesh_builder->create_point( geode::Point3D{ { 0., 1., 0. } } );
+        mesh_builder->create_triangle( { 0, 1, 2 } );
+    }
+    const auto block_id = builder.add_block(
+        geode::OpenGeodeTetrahedralSolid3D::impl_name_static() );
+    const auto& block = brep.block( block_id );
+    {
+        auto mesh_builder =
+            builder.block_mesh_builder< geode::TetrahedralSolid3D >(
+                block_id );
+        mesh_builder->create_point( geode::Point3D{ { 0., 0., 0. } } );
+        mesh_builder->create_point( geode::Point3D{ { 1., 0., 0. } } );
+        mesh_builder->create_point( geode::Point3D{ { 0., 1., 0. } } );
+        mesh_builder->create_point( geode::Point3D{ { 0., 0., 1. } } );
+        mesh_builder->create_tetrahedron( { 0, 1, 2, 3 } );
+    }
+    const auto nb_block_vertices = block.mesh().nb_vertices();
+    const auto first_unique_vertex =
+        builder.create_unique_vertices( nb_block_vertices );
+    for( const auto vertex : geode::Range{ surface.mesh().nb_vertices() } )
+    {
+        builder.set_unique_vertex(
+            { surface.component_id(), vertex }, first_unique_vertex + vertex );
+    }
+    for( const auto vertex : geode::Range{ nb_block_vertices } )
+    {
+        builder.set_unique_vertex(
+            { block.component_id(), vertex }, first_unique_vertex + vertex );
+    }
+    return brep;
+}
+
+void check_blocks_adjacencies()
+{
+    const auto brep = create_meshed_block_brep();
+    const geode::BRepComponentMeshesAdjacency adjacency_inspector{ brep };
+    const auto result = adjacency_inspector.inspect_brep_meshes_adjacencies();
+    const auto& blocks_issues =
+        result.blocks_facets_with_wrong_adjacencies.issues_map();
+    geode::index_t nb_border_facets{ 0 };
+    geode::index_t nb_facets_not_on_a_surface{ 0 };
+    for( const auto& block : brep.blocks() )
+    {
+        const auto& mesh = block.mesh();
+        const geode::SolidMeshAdjacency3D solid_inspector{ mesh };
+        auto nb_expected_issues =
+            solid_inspector.polyhedron_facets_with_wrong_adjacency()
+                .nb_issues();
+        for( const auto polyhedron_id : geode::Range{ mesh.nb_polyhedra() } )
+        {
+            for( const auto facet_id :
+                geode::LRange{ mesh.nb_polyhedron_facets( polyhedron_id ) } )
+            {
+                const geode::PolyhedronFacet facet{ polyhedron_id, facet_id };
+                if( !mesh.is_polyhedron_facet_on_border( facet ) )
+                {
+                    continue;
+                }
+                nb_border_facets++;
+                const auto facet_unique_vertices =
+                    geode::polygon_unique_vertices( brep, block, facet );
+                if( absl::c_contains( facet_unique_vertices, geode::NO_ID ) )
+                {
+                    continue;
+                }
+                if( geode::detail::surface_component_mesh_polygons(
+                        brep, facet_unique_vertices )
+                        .empty() )
+                {
+                    nb_expected_issues++;
+                    nb_facets_not_on_a_surface++;
+                }
+            }
+        }
+        const auto block_issues = blocks_issues.find( block.id() );
+        const auto nb_issues = block_issues == blocks_issues.end()
+                                   ? 0
+                                   : block_issues->second.nb_issues();
+        OPENGEODE_EXCEPTION( nb_issues == nb_expected_issues, "[Test] Block ",
+            block.id().string(), " has ", nb_issues,
+            " facets with wrong adjacencies instead of ", nb_expected_issues,
+            "." );
+    }
+    OPENGEODE_EXCEPTION( nb_border_facets == 4,
+        "[Test] Block should have 4 border facets instead of ",
+        nb_border_facets, "." );
+    OPENGEODE_EXCEPTION( nb_facets_not_on_a_surface == 3,
+        "[Test] Block should have 3 facets not on a surface instead of ",
+        nb_facets_not_on_a_surface, "." );
 }
 
 void check_model_a1_valid( bool string )
@@ -343,6 +903,12 @@ void check_model_a1_valid( bool string )
     OPENGEODE_EXCEPTION( nb_component_meshes_issues == 13494,
         "[Test] model_A1_valid has ", nb_component_meshes_issues,
         " meshes problems instead of 13494." );
+
+    geode::InspectionOptions options;
+    options.set_time_limit( std::chrono::milliseconds{ 1 } );
+    OPENGEODE_EXCEPTION( !brep_inspector.is_valid( options ),
+        "[Test] model_A1_valid validation stopped by its deadline should be "
+        "false." );
 }
 
 void check_model_mss( bool string )
@@ -421,6 +987,19 @@ int main()
     {
         geode::InspectorInspectorLibrary::initialize();
         check_model_a1( false );
+        const auto model_a1 = geode::load_brep(
+            absl::StrCat( geode::DATA_PATH, "model_A1.og_brep" ) );
+        check_model_a1_options( model_a1 );
+        check_model_a1_deadline( model_a1 );
+        check_model_a1_profile( model_a1 );
+        check_model_a1_trace( model_a1 );
+        check_model_a1_progress( model_a1 );
+        check_model_a1_context( model_a1 );
+        check_model_a1_validity_early_return( model_a1 );
+        check_model_a1_concurrent_context( model_a1 );
+        check_model_a1_incremental();
+        check_model_a1_incremental_deleted_vertex();
+        check_blocks_adjacencies();
         check_model_a1_valid( false );
         check_model_mss( false );
         check_model_D( false );
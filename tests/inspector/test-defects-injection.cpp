@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/tests_config.hpp>
+
+#include <absl/strings/str_cat.h>
+
+#include <geode/basic/assert.hpp>
+#include <geode/basic/logger.hpp>
+#include <geode/basic/range.hpp>
+
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/builder/tetrahedral_solid_builder.hpp>
+#include <geode/mesh/builder/triangulated_surface_builder.hpp>
+#include <geode/mesh/core/geode/geode_tetrahedral_solid.hpp>
+#include <geode/mesh/core/geode/geode_triangulated_surface.hpp>
+#include <geode/mesh/core/tetrahedral_solid.hpp>
+#include <geode/mesh/core/triangulated_surface.hpp>
+
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+#include <geode/model/representation/builder/brep_builder.hpp>
+#include <geode/model/representation/core/brep.hpp>
+#include <geode/model/representation/io/brep_input.hpp>
+
+#include <geode/inspector/criterion/brep_meshes_inspector.hpp>
+#include <geode/inspector/criterion/colocation/solid_colocation.hpp>
+#include <geode/inspector/criterion/colocation/surface_colocation.hpp>
+#include <geode/inspector/criterion/degeneration/solid_degeneration.hpp>
+#include <geode/inspector/criterion/degeneration/surface_degeneration.hpp>
+#include <geode/inspector/criterion/intersections/surface_intersections.hpp>
+#include <geode/inspector/criterion/manifold/solid_facet_manifold.hpp>
+#include <geode/inspector/criterion/manifold/surface_edge_manifold.hpp>
+#include <geode/inspector/criterion/negative_elements/solid_negative_elements.hpp>
+#include <geode/inspector/criterion/negative_elements/surface_negative_elements.hpp>
+#include <geode/inspector/defects_injection.hpp>
+#include <geode/inspector/topology/brep_topology.hpp>
+
+void check_surface2D_defects()
+{
+    auto surface = geode::TriangulatedSurface2D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder2D::create( *surface );
+    builder->create_vertices( 4 );
+    builder->set_point( 0, geode::Point2D{ { 0., 0. } } );
+    builder->set_point( 1, geode::Point2D{ { 1., 0. } } );
+    builder->set_point( 2, geode::Point2D{ { 1., 1. } } );
+    builder->set_point( 3, geode::Point2D{ { 0., 1. } } );
+    builder->create_triangle( { 0, 1, 2 } );
+    builder->create_triangle( { 0, 2, 3 } );
+    builder->set_polygon_adjacent( { 0, 2 }, 1 );
+    builder->set_polygon_adjacent( { 1, 0 }, 0 );
+
+    geode::InjectedDefects defects;
+    defects.nb_colocated_points = 2;
+    defects.nb_degenerated_elements = 3;
+    defects.nb_negative_elements = 4;
+    defects.nb_intersections = 5;
+    defects.seed = 1;
+    geode::inject_surface_defects( *surface, defects );
+
+    const geode::SurfaceMeshColocation2D colocation{ *surface };
+    OPENGEODE_EXCEPTION( colocation.colocated_points_groups().nb_issues() == 2,
+        "[Test] Wrong number of injected colocated points in 2D surface." );
+    const geode::SurfaceMeshDegeneration2D degeneration{ *surface };
+    OPENGEODE_EXCEPTION( degeneration.degenerated_polygons().nb_issues() == 3,
+        "[Test] Wrong number of injected degenerated polygons in 2D "
+        "surface." );
+    OPENGEODE_EXCEPTION( degeneration.degenerated_edges().nb_issues() == 0,
+        "[Test] Degenerated edges were injected in 2D surface." );
+    const geode::SurfaceMeshNegativeElements2D negative_elements{ *surface };
+    OPENGEODE_EXCEPTION(
+        negative_elements.negative_polygons().nb_issues() == 4,
+        "[Test] Wrong number of injected negative polygons in 2D surface." );
+    const geode::SurfaceMeshIntersections2D intersections{ *surface };
+    OPENGEODE_EXCEPTION( intersections.intersecting_elements().nb_issues() == 5,
+        "[Test] Wrong number of injected intersections in 2D surface." );
+}
+
+void check_surface3D_defects()
+{
+    auto surface = geode::TriangulatedSurface3D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *surface );
+    builder->create_vertices( 4 );
+    builder->set_point( 0, geode::Point3D{ { 0., 0., 0. } } );
+    builder->set_point( 1, geode::Point3D{ { 1., 0., 0. } } );
+    builder->set_point( 2, geode::Point3D{ { 1., 1., 0. } } );
+    builder->set_point( 3, geode::Point3D{ { 0., 1., 0. } } );
+    builder->create_triangle( { 0, 1, 2 } );
+    builder->create_triangle( { 0, 2, 3 } );
+    builder->set_polygon_adjacent( { 0, 2 }, 1 );
+    builder->set_polygon_adjacent( { 1, 0 }, 0 );
+
+    geode::InjectedDefects defects;
+    defects.nb_colocated_points = 1;
+    defects.nb_degenerated_elements = 1;
+    defects.nb_non_manifold_elements = 2;
+    defects.nb_intersections = 3;
+    defects.seed = 2;
+    geode::inject_surface_defects( *surface, defects );
+
+    const geode::SurfaceMeshColocation3D colocation{ *surface };
+    OPENGEODE_EXCEPTION( colocation.colocated_points_groups().nb_issues() == 1,
+        "[Test] Wrong number of injected colocated points in 3D surface." );
+    const geode::SurfaceMeshDegeneration3D degeneration{ *surface };
+    OPENGEODE_EXCEPTION( degeneration.degenerated_polygons().nb_issues() == 1,
+        "[Test] Wrong number of injected degenerated polygons in 3D "
+        "surface." );
+    const geode::SurfaceMeshEdgeManifold3D manifold{ *surface };
+    OPENGEODE_EXCEPTION( manifold.non_manifold_edges().nb_issues() == 2,
+        "[Test] Wrong number of injected non manifold edges in 3D surface." );
+    const geode::SurfaceMeshIntersections3D intersections{ *surface };
+    OPENGEODE_EXCEPTION( intersections.intersecting_elements().nb_issues() == 3,
+        "[Test] Wrong number of injected intersections in 3D surface." );
+}
+
+void check_solid_defects()
+{
+    auto solid = geode::TetrahedralSolid3D::create();
+    auto builder = geode::TetrahedralSolidBuilder3D::create( *solid );
+    builder->create_vertices( 4 );
+    builder->set_point( 0, geode::Point3D{ { 0., 0., 0. } } );
+    builder->set_point( 1, geode::Point3D{ { 1., 0., 0. } } );
+    builder->set_point( 2, geode::Point3D{ { 0., 1., 0. } } );
+    builder->set_point( 3, geode::Point3D{ { 0., 0., 1. } } );
+    builder->create_tetrahedron( { 0, 1, 2, 3 } );
+
+    geode::InjectedDefects defects;
+    defects.nb_colocated_points = 1;
+    defects.nb_degenerated_elements = 2;
+    defects.nb_negative_elements = 3;
+    defects.nb_non_manifold_elements = 1;
+    defects.seed = 3;
+    geode::inject_solid_defects( *solid, defects );
+
+    const geode::SolidMeshColocation3D colocation{ *solid };
+    OPENGEODE_EXCEPTION( colocation.colocated_points_groups().nb_issues() == 1,
+        "[Test] Wrong number of injected colocated points in solid." );
+    const geode::SolidMeshDegeneration3D degeneration{ *solid };
+    OPENGEODE_EXCEPTION( degeneration.degenerated_polyhedra().nb_issues() == 2,
+        "[Test] Wrong number of injected degenerated polyhedra in solid." );
+    const geode::SolidMeshNegativeElements3D negative_elements{ *solid };
+    OPENGEODE_EXCEPTION(
+        negative_elements.negative_polyhedra().nb_issues() == 3,
+        "[Test] Wrong number of injected negative polyhedra in solid." );
+    const geode::SolidMeshFacetManifold3D manifold{ *solid };
+    OPENGEODE_EXCEPTION( manifold.non_manifold_facets().nb_issues() == 1,
+        "[Test] Wrong number of injected non manifold facets in solid." );
+}
+
+geode::BRep create_brep()
+{
+    geode::BRep brep;
+    geode::BRepBuilder builder{ brep };
+    const auto surface_id = builder.add_surface(
+        geode::OpenGeodeTriangulatedSurface3D::impl_name_static() );
+    const auto& surface = brep.surface( surface_id );
+    {
+        auto mesh_builder =
+            builder.surface_mesh_builder< geode::TriangulatedSurface3D >(
+                surface_id );
+        mesh_builder->create_point( geode::Point3D{ { 0., 0., 0. } } );
+        mesh_builder->create_point( geode::Point3D{ { 1., 0., 0. } } );
+        mesh_builder->create_point( geode::Point3D{ { 1., 1., 0. } } );
+        mesh_builder->create_point( geode::Point3D{ { 0., 1., 0. } } );
+        mesh_builder->create_triangle( { 0, 1, 2 } );
+        mesh_builder->create_triangle( { 0, 2, 3 } );
+        mesh_builder->set_polygon_adjacent( { 0, 2 }, 1 );
+        mesh_builder->set_polygon_adjacent( { 1, 0 }, 0 );
+    }
+    const auto block_id = builder.add_block(
+        geode::OpenGeodeTetrahedralSolid3D::impl_name_static() );
+    const auto& block = brep.block( block_id );
+    {
+        auto mesh_builder =
+            builder.block_mesh_builder< geode::TetrahedralSolid3D >(
+                block_id );
+        mesh_builder->create_point( geode::Point3D{ { 0., 0., 1. } } );
+        mesh_builder->create_point( geode::Point3D{ { 1., 0., 1. } } );
+        mesh_builder->create_point( geode::Point3D{ { 0., 1., 1. } } );
+        mesh_builder->create_point( geode::Point3D{ { 0., 0., 2. } } );
+        mesh_builder->create_tetrahedron( { 0, 1, 2, 3 } );
+    }
+    const auto nb_surface_vertices = surface.mesh().nb_vertices();
+    const auto nb_block_vertices = block.mesh().nb_vertices();
+    const auto first_unique_vertex = builder.create_unique_vertices(
+        nb_surface_vertices + nb_block_vertices );
+    for( const auto vertex : geode::Range{ nb_surface_vertices } )
+    {
+        builder.set_unique_vertex(
+            { surface.component_id(), vertex }, first_unique_vertex + vertex );
+    }
+    for( const auto vertex : geode::Range{ nb_block_vertices } )
+    {
+        builder.set_unique_vertex( { block.component_id(), vertex },
+            first_unique_vertex + nb_surface_vertices + vertex );
+    }
+    return brep;
+}
+
+void check_brep_defects()
+{
+    auto brep = create_brep();
+    const auto before =
+        geode::BRepMeshesInspector{ brep }.inspect_brep_meshes();
+
+    geode::InjectedDefects defects;
+    defects.nb_colocated_points = 1;
+    defects.nb_degenerated_elements = 1;
+    defects.nb_negative_elements = 1;
+    defects.nb_non_manifold_elements = 1;
+    defects.nb_intersections = 2;
+    defects.seed = 4;
+    geode::inject_brep_defects( brep, defects );
+
+    const auto after = geode::BRepMeshesInspector{ brep }.inspect_brep_meshes();
+    OPENGEODE_EXCEPTION(
+        before.meshes_colocation.colocated_points_groups.nb_issues() == 0
+            && after.meshes_colocation.colocated_points_groups.nb_issues()
+                   == 1,
+        "[Test] Wrong number of BRep surfaces with injected colocated "
+        "points." );
+    OPENGEODE_EXCEPTION(
+        before.meshes_degenerations.degenerated_polygons.nb_issues() == 0
+            && after.meshes_degenerations.degenerated_polygons.nb_issues()
+                   == 1,
+        "[Test] Wrong number of BRep surfaces with injected degenerated "
+        "polygons." );
+    OPENGEODE_EXCEPTION(
+        before.meshes_negative_elements.negative_polyhedra.nb_issues() == 0
+            && after.meshes_negative_elements.negative_polyhedra.nb_issues()
+                   == 1,
+        "[Test] Wrong number of BRep blocks with injected negative "
+        "polyhedra." );
+    OPENGEODE_EXCEPTION(
+        before.meshes_non_manifolds.meshes_non_manifold_edges.nb_issues() == 0
+            && after.meshes_non_manifolds.meshes_non_manifold_edges
+                       .nb_issues()
+                   == 1,
+        "[Test] Wrong number of BRep surfaces with injected non manifold "
+        "edges." );
+    const auto nb_intersections = after.meshes_intersections.nb_issues()
+                                  - before.meshes_intersections.nb_issues();
+    OPENGEODE_EXCEPTION( nb_intersections == 2, "[Test] BRep has ",
+        nb_intersections, " injected intersections instead of 2." );
+}
+
+void check_brep_topology_violations()
+{
+    auto model_brep = geode::load_brep(
+        absl::StrCat( geode::DATA_PATH, "model_A1_valid.og_brep" ) );
+    const auto before = geode::BRepTopologyInspector{ model_brep }
+                            .inspect_brep_topology();
+
+    geode::InjectedDefects defects;
+    defects.nb_topology_violations = 3;
+    defects.seed = 5;
+    geode::inject_brep_defects( model_brep, defects );
+
+    const auto after = geode::BRepTopologyInspector{ model_brep }
+                           .inspect_brep_topology();
+    const auto nb_surfaces_without_line_vertices =
+        after.surfaces.unique_vertices_linked_to_several_and_invalid_surfaces
+            .nb_issues()
+        - before.surfaces
+              .unique_vertices_linked_to_several_and_invalid_surfaces
+              .nb_issues();
+    OPENGEODE_EXCEPTION( nb_surfaces_without_line_vertices == 3,
+        "[Test] model_A1_valid has ", nb_surfaces_without_line_vertices,
+        " new unique vertices part of several surfaces and no line instead "
+        "of 3." );
+    const auto nb_topology_issues = after.nb_issues() - before.nb_issues();
+    OPENGEODE_EXCEPTION( nb_topology_issues == 3, "[Test] model_A1_valid has ",
+        nb_topology_issues, " topology issues instead of 3." );
+}
+
+int main()
+{
+    try
+    {
+        geode::InspectorInspectorLibrary::initialize();
+        check_surface2D_defects();
+        check_surface3D_defects();
+        check_solid_defects();
+        check_brep_defects();
+        check_brep_topology_violations();
+        geode::Logger::info( "TEST SUCCESS" );
+        return 0;
+    }
+    catch( ... )
+    {
+        return geode::geode_lippincott();
+    }
+}
@@ -276,6 +276,16 @@ void check_section( bool string )
         launch_component_meshes_validity_checks( result.meshes, string );
     OPENGEODE_EXCEPTION( nb_component_meshes_issues == 0, "[Test] model_D has ",
         nb_component_meshes_issues, " meshes problems instead of 0." );
+    OPENGEODE_EXCEPTION( section_inspector.is_valid(),
+        "[Test] vertical_lines section should be valid." );
+
+    geode::InspectionCancellation cancellation;
+    cancellation.cancel();
+    geode::InspectionOptions cancelled_options;
+    cancelled_options.set_cancellation( cancellation );
+    OPENGEODE_EXCEPTION( !section_inspector.is_valid( cancelled_options ),
+        "[Test] vertical_lines cancelled validation should stop before "
+        "proving the section valid." );
 }
 
 void check_section_test()
@@ -162,6 +162,65 @@ void check_non_adjacency_inversed_tetrahedron()
         "an inversed tetrahedron." );
 }
 
+void check_adjacency_rotated_facets()
+{
+    auto solid = geode::TetrahedralSolid3D::create();
+    auto builder = geode::TetrahedralSolidBuilder3D::create( *solid );
+    builder->create_vertices( 5 );
+    builder->set_point( 0, geode::Point3D{ { 0., 0., 2. } } );
+    builder->set_point( 1, geode::Point3D{ { 3., .5, 0. } } );
+    builder->set_point( 2, geode::Point3D{ { .5, 3., .5 } } );
+    builder->set_point( 3, geode::Point3D{ { 2., 1.5, 3. } } );
+    builder->set_point( 4, geode::Point3D{ { 3.5, 2.5, -.5 } } );
+    builder->create_tetrahedron( { 0, 1, 2, 3 } );
+    builder->create_tetrahedron( { 2, 3, 1, 4 } );
+    builder->set_polyhedron_adjacent( { 0, 0 }, 1 );
+    builder->set_polyhedron_adjacent( { 1, 3 }, 0 );
+
+    const geode::SolidMeshInspector3D adjacency_inspector{ *solid };
+    OPENGEODE_EXCEPTION( !adjacency_inspector.mesh_has_wrong_adjacencies(),
+        "[Test] Solid shows wrong adjacencies on opposite facets starting "
+        "from different vertices." );
+    OPENGEODE_EXCEPTION(
+        adjacency_inspector.polyhedron_facets_with_wrong_adjacency().nb_issues()
+            == 0,
+        "[Test] Solid shows wrong adjacencies on opposite facets starting "
+        "from different vertices." );
+}
+
+void check_non_adjacency_rotated_facets_same_orientation()
+{
+    auto solid = geode::TetrahedralSolid3D::create();
+    auto builder = geode::TetrahedralSolidBuilder3D::create( *solid );
+    builder->create_vertices( 5 );
+    builder->set_point( 0, geode::Point3D{ { 0., 0., 2. } } );
+    builder->set_point( 1, geode::Point3D{ { 3., .5, 0. } } );
+    builder->set_point( 2, geode::Point3D{ { .5, 3., .5 } } );
+    builder->set_point( 3, geode::Point3D{ { 2., 1.5, 3. } } );
+    builder->set_point( 4, geode::Point3D{ { 3.5, 2.5, -.5 } } );
+    builder->create_tetrahedron( { 0, 1, 2, 3 } );
+    builder->create_tetrahedron( { 3, 2, 1, 4 } );
+    builder->set_polyhedron_adjacent( { 0, 0 }, 1 );
+    builder->set_polyhedron_adjacent( { 1, 3 }, 0 );
+
+    const geode::SolidMeshInspector3D adjacency_inspector{ *solid };
+    OPENGEODE_EXCEPTION( adjacency_inspector.mesh_has_wrong_adjacencies(),
+        "[Test] Solid should have wrong adjacencies due to facets with the "
+        "same orientation." );
+    const auto wrong_adjacencies =
+        adjacency_inspector.polyhedron_facets_with_wrong_adjacency();
+    OPENGEODE_EXCEPTION( wrong_adjacencies.nb_issues() == 2,
+        "[Test] Solid should have two wrong adjacencies due to facets with "
+        "the same orientation." );
+    const geode::PolyhedronFacet polyhedron_facet1{ 0, 0 };
+    const geode::PolyhedronFacet polyhedron_facet2{ 1, 3 };
+    OPENGEODE_EXCEPTION( wrong_adjacencies.issues()[0] == polyhedron_facet1
+                             && wrong_adjacencies.issues()[1]
+                                    == polyhedron_facet2,
+        "[Test] Solid shows wrong facets with adjacency problems due to "
+        "facets with the same orientation." );
+}
+
 int main()
 {
     try
@@ -171,6 +230,8 @@ int main()
         check_non_adjacency_no_bijection();
         check_non_adjacency_wrong_facet();
         check_non_adjacency_inversed_tetrahedron();
+        check_adjacency_rotated_facets();
+        check_non_adjacency_rotated_facets_same_orientation();
 
         geode::Logger::info( "TEST SUCCESS" );
         return 0;
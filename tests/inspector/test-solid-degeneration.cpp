@@ -51,6 +51,8 @@ void check_non_degeneration()
     OPENGEODE_EXCEPTION(
         degeneration_inspector.degenerated_edges().nb_issues() == 0,
         "[Test] Solid has more degenerated edges than it should." );
+    OPENGEODE_EXCEPTION( !solid->are_edges_enabled(),
+        "[Test] Solid edges should not be enabled by the inspection." );
 }
 
 void check_degeneration_by_colocalisation()
@@ -103,6 +105,13 @@ void check_degeneration_by_point_multiple_presence()
     OPENGEODE_EXCEPTION( degeneration_inspector.degenerated_edges().issues()[0]
                              == solid->edges().edge_from_vertices( { 1, 1 } ),
         "[Test] Solid shows the wrong degenerated edges." );
+    const auto degenerations =
+        degeneration_inspector.degenerated_edges_and_polyhedra();
+    OPENGEODE_EXCEPTION( degenerations.degenerated_edges.nb_issues() == 1
+                             && degenerations.degenerated_polyhedra.nb_issues()
+                                    == 1,
+        "[Test] Solid has the wrong number of degenerated edges and "
+        "polyhedra." );
 }
 
 int main()
@@ -54,12 +54,55 @@ void check_negative_elements()
         "[Test] Solid negative polyhedron should be 1." );
 }
 
+void check_negative_elements_in_blocks()
+{
+    auto solid = geode::TetrahedralSolid3D::create();
+    auto builder = geode::TetrahedralSolidBuilder3D::create( *solid );
+    builder->create_vertices( 7 );
+    builder->set_point( 0, geode::Point3D{ { 0., 0., 0. } } );
+    builder->set_point( 1, geode::Point3D{ { 3., 3., -0.5 } } );
+    builder->set_point( 2, geode::Point3D{ { -0.5, 4., -1. } } );
+    builder->set_point( 3, geode::Point3D{ { 1., 3., 3. } } );
+    builder->set_point( 4, geode::Point3D{ { 1., 2., -3. } } );
+    builder->set_point( 5, geode::Point3D{ { 1., 1., 0. } } );
+    builder->set_point( 6, geode::Point3D{ { 2., 2., 0. } } );
+
+    geode::index_t nb_negative{ 0 };
+    for( const auto tetrahedron_id : geode::Range{ 10000 } )
+    {
+        if( tetrahedron_id % 97 == 0 )
+        {
+            builder->create_tetrahedron( { 0, 1, 2, 4 } );
+            nb_negative++;
+        }
+        else
+        {
+            builder->create_tetrahedron( { 0, 1, 2, 3 } );
+        }
+    }
+    builder->create_tetrahedron( { 0, 5, 6, 3 } );
+
+    const geode::SolidMeshNegativeElements3D inspector{ *solid };
+    OPENGEODE_EXCEPTION( inspector.mesh_has_negative_elements(),
+        "[Test] Large solid should have negative elements." );
+    const auto issues = inspector.negative_polyhedra();
+    OPENGEODE_EXCEPTION( issues.nb_issues() == nb_negative,
+        "[Test] Large solid has wrong number of negative polyhedra." );
+    for( const auto issue_id : geode::Range{ 1, issues.nb_issues() } )
+    {
+        OPENGEODE_EXCEPTION(
+            issues.issues()[issue_id - 1] < issues.issues()[issue_id],
+            "[Test] Large solid negative polyhedra should be sorted." );
+    }
+}
+
 int main()
 {
     try
     {
         geode::InspectorInspectorLibrary::initialize();
         check_negative_elements();
+        check_negative_elements_in_blocks();
 
         geode::Logger::info( "TEST SUCCESS" );
         return 0;
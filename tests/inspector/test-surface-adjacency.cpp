@@ -286,6 +286,58 @@ void check_non_adjacency_inversed_triangle3D()
         "to an inversed triangle.." );
 }
 
+void check_non_adjacency_large_surface()
+{
+    auto surface = geode::TriangulatedSurface2D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder2D::create( *surface );
+    constexpr geode::index_t nb_points{ 60 };
+    builder->create_vertices( nb_points * nb_points );
+    for( const auto i : geode::Range{ nb_points } )
+    {
+        for( const auto j : geode::Range{ nb_points } )
+        {
+            builder->set_point( i * nb_points + j,
+                geode::Point2D{ { static_cast< double >( i ),
+                    static_cast< double >( j ) } } );
+        }
+    }
+    for( const auto i : geode::Range{ nb_points - 1 } )
+    {
+        for( const auto j : geode::Range{ nb_points - 1 } )
+        {
+            const auto v00 = i * nb_points + j;
+            const auto v10 = v00 + nb_points;
+            builder->create_triangle( { v00, v10, v10 + 1 } );
+            builder->create_triangle( { v00, v10 + 1, v00 + 1 } );
+        }
+    }
+    builder->compute_polygon_adjacencies();
+
+    const geode::SurfaceMeshAdjacency2D adjacency_inspector{ *surface };
+    OPENGEODE_EXCEPTION( !adjacency_inspector.mesh_has_wrong_adjacencies(),
+        "[Test] Large surface has wrong adjacencies when it should have "
+        "none." );
+
+    const geode::index_t wrong_polygon{ 6000 };
+    for( const auto edge_id : geode::LRange{ 3 } )
+    {
+        if( surface->polygon_adjacent( { wrong_polygon, edge_id } ) )
+        {
+            builder->set_polygon_adjacent( { wrong_polygon, edge_id }, 0 );
+            break;
+        }
+    }
+    OPENGEODE_EXCEPTION( adjacency_inspector.mesh_has_wrong_adjacencies(),
+        "[Test] Large surface should have wrong adjacencies." );
+    const auto issues =
+        adjacency_inspector.polygon_edges_with_wrong_adjacency();
+    OPENGEODE_EXCEPTION( issues.nb_issues() == 2,
+        "[Test] Large surface should have two wrong adjacencies." );
+    OPENGEODE_EXCEPTION(
+        issues.issues()[0].polygon_id < issues.issues()[1].polygon_id,
+        "[Test] Large surface wrong adjacencies are not sorted." );
+}
+
 int main()
 {
     try
@@ -299,6 +351,7 @@ int main()
         check_non_adjacency_no_bijection3D();
         check_non_adjacency_wrong_edge3D();
         check_non_adjacency_inversed_triangle3D();
+        check_non_adjacency_large_surface();
 
         geode::Logger::info( "TEST SUCCESS" );
         return 0;
@@ -72,6 +72,8 @@ void check_degeneration_by_colocalisation2D()
     OPENGEODE_EXCEPTION(
         degeneration_inspector.degenerated_edges().nb_issues() == 1,
         "[Test] Surface has wrong number of degenerated edges." );
+    OPENGEODE_EXCEPTION( !surface->are_edges_enabled(),
+        "[Test] Surface edges should not be enabled by the inspection." );
     surface->enable_edges();
     OPENGEODE_EXCEPTION( degeneration_inspector.degenerated_edges().issues()[0]
                              == surface->edges().edge_from_vertices( { 1, 3 } ),
@@ -96,6 +98,13 @@ void check_degeneration_by_point_multiple_presence2D()
     OPENGEODE_EXCEPTION(
         degeneration_inspector.degenerated_edges().nb_issues() == 1,
         "[Test] Surface has the wrong number of degenerated edges." );
+    const auto degenerations =
+        degeneration_inspector.degenerated_edges_and_polygons();
+    OPENGEODE_EXCEPTION( degenerations.degenerated_edges.nb_issues() == 1
+                             && degenerations.degenerated_polygons.nb_issues()
+                                    == 1,
+        "[Test] Surface has the wrong number of degenerated edges and "
+        "polygons." );
     surface->enable_edges();
     OPENGEODE_EXCEPTION( degeneration_inspector.degenerated_edges().issues()[0]
                              == surface->edges().edge_from_vertices( { 1, 1 } ),
@@ -53,12 +53,54 @@ void check_negative_elements()
         "[Test] Surface negative element should be 1." );
 }
 
+void check_negative_elements_in_blocks()
+{
+    auto surface = geode::TriangulatedSurface2D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder2D::create( *surface );
+    builder->create_vertices( 6 );
+    builder->set_point( 0, geode::Point2D{ { 0., 2. } } );
+    builder->set_point( 1, geode::Point2D{ { 2., 0. } } );
+    builder->set_point( 2, geode::Point2D{ { 1., 4. } } );
+    builder->set_point( 3, geode::Point2D{ { 3., 3. } } );
+    builder->set_point( 4, geode::Point2D{ { 1., 1. } } );
+    builder->set_point( 5, geode::Point2D{ { 2., 2. } } );
+
+    geode::index_t nb_negative{ 0 };
+    for( const auto triangle_id : geode::Range{ 10000 } )
+    {
+        if( triangle_id % 97 == 0 )
+        {
+            builder->create_triangle( { 2, 3, 1 } );
+            nb_negative++;
+        }
+        else
+        {
+            builder->create_triangle( { 0, 1, 2 } );
+        }
+    }
+    builder->create_triangle( { 4, 5, 3 } );
+
+    const geode::SurfaceMeshNegativeElements2D inspector{ *surface };
+    OPENGEODE_EXCEPTION( inspector.mesh_has_negative_elements(),
+        "[Test] Large surface should have negative elements." );
+    const auto issues = inspector.negative_polygons();
+    OPENGEODE_EXCEPTION( issues.nb_issues() == nb_negative,
+        "[Test] Large surface has wrong number of negative polygons." );
+    for( const auto issue_id : geode::Range{ 1, issues.nb_issues() } )
+    {
+        OPENGEODE_EXCEPTION(
+            issues.issues()[issue_id - 1] < issues.issues()[issue_id],
+            "[Test] Large surface negative polygons should be sorted." );
+    }
+}
+
 int main()
 {
     try
     {
         geode::InspectorInspectorLibrary::initialize();
         check_negative_elements();
+        check_negative_elements_in_blocks();
 
         geode::Logger::info( "TEST SUCCESS" );
         return 0;